@@ -26,6 +26,10 @@
 #define MOE_x64
 #endif
 
+#if defined MOE_x64 || defined __SSE2__ || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define MOE_SSE2
+#endif
+
 #if defined _MSC_VER
 #define MOE_MSVC
 MOE_STATIC_ASSERT(_MSC_VER >= 1700, "Old version of msvc is not supported.");
@@ -36,6 +40,17 @@ MOE_STATIC_ASSERT(false, "Only support msvc and gcc.");
 #endif
 
 
+/**
+ * @brief compile one function for an instruction set that the whole program is not compiled for,
+ * the function must only be called after InstructionSet reports the instruction set
+ * @example: MOE_TARGET("avx2") inline void kernel() {...}
+ */
+#if defined MOE_GCC
+#define MOE_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#define MOE_TARGET(ISA)
+#endif
+
 #if defined MOE_MSVC
 #include <intrin.h>
 #elif defined MOE_GCC
@@ -132,6 +147,17 @@ namespace MoeLP
 			#endif
 		}
 
+		static muint64 xgetbv()
+		{
+			#if defined(MOE_GCC)
+			unsigned int eax, edx;
+			__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return ((muint64)edx << 32) | eax;
+			#elif defined(MOE_MSVC)
+			return _xgetbv(0);
+			#endif
+		}
+
 		struct InstructionSet_Internal
 		{
 			InstructionSet_Internal()
@@ -140,6 +166,12 @@ namespace MoeLP
 				isIntel_{ false },
 				isAMD_{ false },
 				f_1_ECX_{ 0 },
+				f_1_EDX_{ 0 },
+				f_7_EBX_{ 0 },
+				f_7_ECX_{ 0 },
+				f_81_ECX_{ 0 },
+				osYmm_{ false },
+				osZmm_{ false },
 				data_{},
 				extdata_{}
 			{
@@ -177,6 +209,22 @@ namespace MoeLP
 				if (nIds_ >= 1)
 				{
 					f_1_ECX_ = data_[1][2];
+					f_1_EDX_ = data_[1][3];
+				}
+
+				// load bitset with flags for function 0x00000007  
+				if (nIds_ >= 7)
+				{
+					f_7_EBX_ = data_[7][1];
+					f_7_ECX_ = data_[7][2];
+				}
+
+				// the ymm and zmm registers are only usable if the operating system saves them  
+				if (f_1_ECX_[27])
+				{
+					muint64 xcr0 = xgetbv();
+					osYmm_ = (xcr0 & 0x6) == 0x6;
+					osZmm_ = (xcr0 & 0xE6) == 0xE6;
 				}
 
 				// Calling __cpuid with 0x80000000 as the function_id argument  
@@ -187,12 +235,18 @@ namespace MoeLP
 				char brand[0x40];
 				memset(brand, 0, sizeof(brand));
 
-				for (int i = 0x80000000; i <= nExIds_; ++i)
+				for (unsigned int i = 0x80000000; i <= nExIds_; ++i)
 				{
 					cpuidex((unsigned int*)cpui.data(), i, 0);
 					extdata_.push_back(cpui);
 				}
 
+				// load bitset with flags for function 0x80000001  
+				if (nExIds_ >= 0x80000001)
+				{
+					f_81_ECX_ = extdata_[1][2];
+				}
+
 				// Interpret CPU brand string if reported  
 				if (nExIds_ >= 0x80000004)
 				{
@@ -204,32 +258,66 @@ namespace MoeLP
 			};
 
 			int nIds_;
-			int nExIds_;
+			unsigned int nExIds_;
 			std::string vendor_;
 			std::string brand_;
 			bool isIntel_;
 			bool isAMD_;
 			std::bitset<32> f_1_ECX_;
+			std::bitset<32> f_1_EDX_;
+			std::bitset<32> f_7_EBX_;
+			std::bitset<32> f_7_ECX_;
+			std::bitset<32> f_81_ECX_;
+			bool osYmm_;
+			bool osZmm_;
 			std::vector<std::array<int, 4>> data_;
 			std::vector<std::array<int, 4>> extdata_;
 		};
 
+		/**
+		 * @brief the cpu, read on first use so that it is ready for the static initializers of every file
+		 */
+		static const InstructionSet_Internal& CPU_Rep()
+		{
+			static const InstructionSet_Internal rep;
+			return rep;
+		}
+
 	public:
 		// getters  
-		static std::string Vendor() { return CPU_Rep.vendor_; }
-		static std::string Brand() { return CPU_Rep.brand_; }
-
-		static bool SSE3()	{ return CPU_Rep.f_1_ECX_[0]; }
-		static bool SSE41() { return CPU_Rep.f_1_ECX_[19]; }
-		static bool SSE42() { return CPU_Rep.f_1_ECX_[20]; }
-		static bool AVX()	{ return CPU_Rep.f_1_ECX_[28]; }
-
-	private:
-		static const InstructionSet_Internal CPU_Rep;
+		static std::string Vendor() { return CPU_Rep().vendor_; }
+		static std::string Brand() { return CPU_Rep().brand_; }
+		static bool Intel()	{ return CPU_Rep().isIntel_; }
+		static bool AMD()	{ return CPU_Rep().isAMD_; }
+
+		static bool SSE()	{ return CPU_Rep().f_1_EDX_[25]; }
+		static bool SSE2()	{ return CPU_Rep().f_1_EDX_[26]; }
+		static bool SSE3()	{ return CPU_Rep().f_1_ECX_[0]; }
+		static bool PCLMULQDQ() { return CPU_Rep().f_1_ECX_[1]; }
+		static bool SSSE3() { return CPU_Rep().f_1_ECX_[9]; }
+		static bool FMA()	{ return CPU_Rep().f_1_ECX_[12] && CPU_Rep().osYmm_; }
+		static bool SSE41() { return CPU_Rep().f_1_ECX_[19]; }
+		static bool SSE42() { return CPU_Rep().f_1_ECX_[20]; }
+		static bool MOVBE() { return CPU_Rep().f_1_ECX_[22]; }
+		static bool POPCNT() { return CPU_Rep().f_1_ECX_[23]; }
+		static bool OSXSAVE() { return CPU_Rep().f_1_ECX_[27]; }
+		static bool AVX()	{ return CPU_Rep().f_1_ECX_[28] && CPU_Rep().osYmm_; }
+		static bool F16C()	{ return CPU_Rep().f_1_ECX_[29] && CPU_Rep().osYmm_; }
+		static bool LZCNT() { return CPU_Rep().f_81_ECX_[5]; }
+
+		static bool BMI1()	{ return CPU_Rep().f_7_EBX_[3]; }
+		static bool AVX2()	{ return CPU_Rep().f_7_EBX_[5] && CPU_Rep().osYmm_; }
+		static bool BMI2()	{ return CPU_Rep().f_7_EBX_[8]; }
+		static bool AVX512F() { return CPU_Rep().f_7_EBX_[16] && CPU_Rep().osZmm_; }
+		static bool AVX512DQ() { return CPU_Rep().f_7_EBX_[17] && CPU_Rep().osZmm_; }
+		static bool AVX512CD() { return CPU_Rep().f_7_EBX_[28] && CPU_Rep().osZmm_; }
+		static bool AVX512BW() { return CPU_Rep().f_7_EBX_[30] && CPU_Rep().osZmm_; }
+		static bool AVX512VL() { return CPU_Rep().f_7_EBX_[31] && CPU_Rep().osZmm_; }
+		static bool AVX512VBMI() { return CPU_Rep().f_7_ECX_[1] && CPU_Rep().osZmm_; }
+		static bool AVX512VBMI2() { return CPU_Rep().f_7_ECX_[6] && CPU_Rep().osZmm_; }
+		static bool AVX512VPOPCNTDQ() { return CPU_Rep().f_7_ECX_[14] && CPU_Rep().osZmm_; }
 	};
 
-	const InstructionSet::InstructionSet_Internal InstructionSet::CPU_Rep;
-
 	class Exception
 	{
 	private:
@@ -0,0 +1,158 @@
+#ifndef MoeLP_Base_CpuDispatch
+#define MoeLP_Base_CpuDispatch
+
+#include "Base.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace MoeLP
+{
+	/**
+	 * @brief the instruction set levels the kernels are written for
+	 * @detail a level includes the ones below it. They follow the x86-64 micro-architecture
+	 * levels: SSE42 also has SSSE3, SSE4.1 and POPCNT, AVX2 also has AVX, FMA, BMI1, BMI2
+	 * and LZCNT, AVX512 has the F, BW, CD, DQ and VL subsets.
+	 */
+	enum class CpuTier : muint8
+	{
+		Scalar,
+		SSE2,
+		SSE42,
+		AVX2,
+		AVX512
+	};
+
+	namespace CpuDispatch_Internal
+	{
+		const mint tierCount = (mint)CpuTier::AVX512 + 1;
+
+		inline const char* tierName(CpuTier tier)
+		{
+			static const char* names[tierCount] = { "scalar", "sse2", "sse4.2", "avx2", "avx512" };
+			return names[(mint)tier];
+		}
+
+		inline CpuTier detectTier()
+		{
+			if (!InstructionSet::SSE2())
+				return CpuTier::Scalar;
+			if (!(InstructionSet::SSSE3() && InstructionSet::SSE41() && InstructionSet::SSE42() && InstructionSet::POPCNT()))
+				return CpuTier::SSE2;
+			if (!(InstructionSet::AVX2() && InstructionSet::FMA() && InstructionSet::BMI1() && InstructionSet::BMI2() && InstructionSet::LZCNT()))
+				return CpuTier::SSE42;
+			if (!(InstructionSet::AVX512F() && InstructionSet::AVX512BW() && InstructionSet::AVX512CD()
+				&& InstructionSet::AVX512DQ() && InstructionSet::AVX512VL()))
+				return CpuTier::AVX2;
+			return CpuTier::AVX512;
+		}
+
+		/**
+		 * @brief the tier of the cpu, lowered by the environment variable MOELP_CPU_TIER
+		 * @detail the variable is one of scalar, sse2, sse4.2, avx2 and avx512. It can only
+		 * lower the tier, a tier the cpu does not have is ignored.
+		 */
+		inline CpuTier resolveTier()
+		{
+			CpuTier tier = detectTier();
+			const char* name = getenv("MOELP_CPU_TIER");
+			if (name)
+			{
+				for (mint i = 0; i < tierCount; i++)
+				{
+					if (strcmp(name, tierName((CpuTier)i)) == 0 && (CpuTier)i < tier)
+						tier = (CpuTier)i;
+				}
+			}
+			return tier;
+		}
+	}
+
+	/**
+	 * @brief return the tier the kernels run at, decided once per process
+	 */
+	inline CpuTier cpuTier()
+	{
+		static const CpuTier tier = CpuDispatch_Internal::resolveTier();
+		return tier;
+	}
+
+	/**
+	 * @brief return the name of a tier, the same as the values of MOELP_CPU_TIER
+	 */
+	inline const char* cpuTierName(CpuTier tier)
+	{
+		return CpuDispatch_Internal::tierName(tier);
+	}
+
+	template<typename Signature>
+	class CpuDispatch;
+
+	/**
+	 * @brief a function with one variant per cpu tier, resolved when it is built
+	 * @example:
+	 * inline size_t count(const char* p, size_t n)
+	 * {
+	 *     static const CpuDispatch<size_t(const char*, size_t)> kernel = CpuDispatch<size_t(const char*, size_t)>(countScalar)
+	 *         .add(CpuTier::SSE42, countSse42)
+	 *         .add(CpuTier::AVX2, countAvx2);
+	 *     return kernel(p, n);
+	 * }
+	 * @detail the variant of the highest tier that is not above cpuTier() is kept, so the
+	 * call is one indirect call. A variant compiled with MOE_TARGET must only be added with
+	 * the tier of its instruction set. Being a local static, it is built once and safely
+	 * even when the first calls come from several threads.
+	 */
+	template<typename R, typename... Args>
+	class CpuDispatch<R(Args...)>
+	{
+	public:
+		typedef R (*Function)(Args...);
+
+		/**
+		 * @brief create a dispatch with the variant that runs everywhere
+		 */
+		explicit CpuDispatch(Function scalar)
+			: function(scalar),
+			level(CpuTier::Scalar)
+		{
+		}
+
+		/**
+		 * @brief add a variant, it replaces the current one if the cpu has its tier and it is higher
+		 */
+		CpuDispatch& add(CpuTier tier, Function variant)
+		{
+			if (tier <= cpuTier() && tier >= level)
+			{
+				function = variant;
+				level = tier;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief return the tier of the chosen variant
+		 */
+		CpuTier tier() const
+		{
+			return level;
+		}
+
+		Function get() const
+		{
+			return function;
+		}
+
+		R operator()(Args... args) const
+		{
+			return function(args...);
+		}
+
+	private:
+		Function	function;
+		CpuTier		level;
+	};
+}
+
+#endif
@@ -0,0 +1,574 @@
+#ifndef MoeLP_Base_AsyncFileStream
+#define MoeLP_Base_AsyncFileStream
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "../Text/Text.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "FileStream.hpp"
+
+#include <future>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#if defined MOE_MSVC
+#include <windows.h>
+#elif defined MOE_GCC
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined __has_include
+#if __has_include(<linux/io_uring.h>) && defined __NR_io_uring_setup
+#include <linux/io_uring.h>
+#define MOE_IO_URING
+#endif
+#endif
+#endif
+
+namespace MoeLP
+{
+	namespace AsyncFileStream_Internal
+	{
+		using FileStream_Internal::Handle;
+		using FileStream_Internal::Operation;
+		using FileStream_Internal::Read;
+		using FileStream_Internal::Write;
+		using FileStream_Internal::transfer;
+
+		/**
+		 * @brief a queued operation, completed by its promise or its callback
+		 */
+		struct Request
+		{
+			Operation					operation;
+			mint64						offset;
+			char*						buffer;
+			size_t						size;
+			size_t						done;
+			std::promise<mint>			promise;
+			std::function<void(mint)>	callback;
+		};
+
+		#if defined MOE_IO_URING
+		/**
+		 * @brief an io_uring driven by raw system calls
+		 * @detail the submission and completion rings are shared with the kernel, the tails and
+		 * heads are published with release stores and read with acquire loads.
+		 */
+		class Ring
+		{
+			MOE_DISALLOW_COPY_AND_ASSIGN(Ring)
+
+		public:
+			Ring()
+				: ringFd(-1),
+				sqRing(MAP_FAILED),
+				cqRing(MAP_FAILED),
+				sqes(MAP_FAILED)
+			{
+			}
+
+			~Ring()
+			{
+				close();
+			}
+
+			/**
+			 * @brief create the ring, false if the kernel does not have io_uring or it is not allowed
+			 */
+			bool open(unsigned entries)
+			{
+				io_uring_params params;
+				memset(&params, 0, sizeof(params));
+				ringFd = (int)syscall(__NR_io_uring_setup, entries, &params);
+				if (ringFd < 0)
+					return false;
+
+				// IORING_OP_READ and IORING_OP_WRITE come with the same kernel as IORING_FEAT_RW_CUR_POS
+				if (!(params.features & IORING_FEAT_RW_CUR_POS) || !(params.features & IORING_FEAT_NODROP))
+				{
+					close();
+					return false;
+				}
+
+				sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+				cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+				const bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+				if (single && cqRingSize > sqRingSize)
+					sqRingSize = cqRingSize;
+				sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+				sqRing = mmap(0, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+				if (sqRing == MAP_FAILED)
+				{
+					close();
+					return false;
+				}
+				cqRing = single ? sqRing : mmap(0, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+				sqes = mmap(0, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+				if (cqRing == MAP_FAILED || sqes == MAP_FAILED)
+				{
+					close();
+					return false;
+				}
+
+				char* sq = (char*)sqRing;
+				sqHead = (unsigned*)(sq + params.sq_off.head);
+				sqTail = (unsigned*)(sq + params.sq_off.tail);
+				sqMask = *(unsigned*)(sq + params.sq_off.ring_mask);
+				sqArray = (unsigned*)(sq + params.sq_off.array);
+				sqEntries = params.sq_entries;
+				char* cq = (char*)cqRing;
+				cqHead = (unsigned*)(cq + params.cq_off.head);
+				cqTail = (unsigned*)(cq + params.cq_off.tail);
+				cqMask = *(unsigned*)(cq + params.cq_off.ring_mask);
+				cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+				cqEntries = params.cq_entries;
+				return true;
+			}
+
+			void close()
+			{
+				if (sqes != MAP_FAILED)
+					munmap(sqes, sqesSize);
+				if (cqRing != MAP_FAILED && cqRing != sqRing)
+					munmap(cqRing, cqRingSize);
+				if (sqRing != MAP_FAILED)
+					munmap(sqRing, sqRingSize);
+				if (ringFd >= 0)
+					::close(ringFd);
+				sqes = cqRing = sqRing = MAP_FAILED;
+				ringFd = -1;
+			}
+
+			/**
+			 * @brief return the number of operations that can be in flight without filling the completions
+			 */
+			unsigned capacity() const
+			{
+				return cqEntries;
+			}
+
+			/**
+			 * @brief queue an operation and tell the kernel, the caller serializes the submissions
+			 * @param userData: given back with the completion, 0 is a no operation
+			 */
+			bool submit(int fd, Operation operation, mint64 offset, char* buffer, size_t size, muint64 userData)
+			{
+				unsigned tail = *sqTail;
+				if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+					return false;
+
+				unsigned index = tail & sqMask;
+				io_uring_sqe* sqe = (io_uring_sqe*)sqes + index;
+				memset(sqe, 0, sizeof(*sqe));
+				sqe->opcode = userData == 0 ? IORING_OP_NOP : operation == Read ? IORING_OP_READ : IORING_OP_WRITE;
+				sqe->fd = userData == 0 ? -1 : fd;
+				sqe->off = (muint64)offset;
+				sqe->addr = (muint64)(size_t)buffer;
+				sqe->len = (muint32)size;
+				sqe->user_data = userData;
+				sqArray[index] = index;
+				__atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+				for (;;)
+				{
+					int result = (int)syscall(__NR_io_uring_enter, ringFd, 1, 0, 0, 0, 0);
+					if (result >= 0)
+						return true;
+					if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+						return false;
+				}
+			}
+
+			/**
+			 * @brief wait for the next completion
+			 */
+			void next(muint64& userData, mint& result)
+			{
+				for (;;)
+				{
+					unsigned head = *cqHead;
+					if (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE))
+					{
+						io_uring_cqe* cqe = cqes + (head & cqMask);
+						userData = cqe->user_data;
+						result = cqe->res;
+						__atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+						return;
+					}
+					syscall(__NR_io_uring_enter, ringFd, 0, 1, IORING_ENTER_GETEVENTS, 0, 0);
+				}
+			}
+
+		private:
+			int				ringFd;
+			void*			sqRing;
+			void*			cqRing;
+			void*			sqes;
+			size_t			sqRingSize;
+			size_t			cqRingSize;
+			size_t			sqesSize;
+			unsigned*		sqHead;
+			unsigned*		sqTail;
+			unsigned*		sqArray;
+			unsigned		sqMask;
+			unsigned		sqEntries;
+			unsigned*		cqHead;
+			unsigned*		cqTail;
+			unsigned		cqMask;
+			unsigned		cqEntries;
+			io_uring_cqe*	cqes;
+		};
+		#endif
+	}
+
+	/**
+	 * @brief a file read and written at positions in the background
+	 * @example:
+	 * AsyncFileStream file(L"corpus.txt", FileStream::ReadOnly);
+	 * std::future<mint> next = file.read(0, blocks[0], blockSize);
+	 * for (mint64 i = 0; ; i++)
+	 * {
+	 *     mint read = next.get();
+	 *     next = file.read((i + 1) * blockSize, blocks[(i + 1) % 2], blockSize);	// read the next block while this one is decoded
+	 *     decode(blocks[i % 2], read);
+	 * }
+	 * @detail the operations are run by io_uring on linux kernels that have it, and by a few
+	 * threads with positional reads and writes elsewhere. An operation returns at once, its
+	 * result is the number of bytes, fewer than asked only at the end of the file, or -1 on
+	 * error. The buffer must stay valid until the operation completes. Callbacks are called on
+	 * the thread that completes the operation, they should be short and must not throw. The
+	 * place of an operation is freed before its callback is called, so a callback can queue the
+	 * next operation, but one that queues several may wait for a place that only its own thread
+	 * can free.
+	 * Operations are not ordered, a read of a range that is being written must wait for the
+	 * write. The destructor waits for all the operations.
+	 */
+	class AsyncFileStream
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(AsyncFileStream)
+
+	public:
+		enum Backend
+		{
+			IoUring,
+			Threads
+		};
+
+		/**
+		 * @brief open a file
+		 * @param accessRight: as for FileStream, with Append every write goes to the end whatever its offset
+		 * @param depth: the largest number of operations in flight, more operations wait for a place
+		 * @param allowIoUring: false to use the threads even where io_uring is available
+		 */
+		AsyncFileStream(const Text& fileName, FileStream::AccessRight accessRight, size_t depth = 64, bool allowIoUring = true)
+			: accessRight(accessRight),
+			pending(0),
+			unfinished(0),
+			maxPending(depth),
+			mode(Threads)
+		{
+			MOE_ERROR(depth > 0, "AsyncFileStream::AsyncFileStream(const Text& fileName, FileStream::AccessRight accessRight, size_t depth, bool allowIoUring): Argument depth out of range.");
+
+			#if defined MOE_MSVC
+			const DWORD access = accessRight == FileStream::ReadOnly ? GENERIC_READ
+				: accessRight == FileStream::ReadWrite ? GENERIC_READ | GENERIC_WRITE
+				: accessRight == FileStream::Append ? FILE_APPEND_DATA : GENERIC_WRITE;
+			const DWORD creation = accessRight == FileStream::ReadOnly ? OPEN_EXISTING
+				: accessRight == FileStream::Append ? OPEN_ALWAYS : CREATE_ALWAYS;
+			handle = CreateFileW(fileName.c_str(), access, FILE_SHARE_READ, 0, creation, FILE_ATTRIBUTE_NORMAL, 0);
+			if (handle == INVALID_HANDLE_VALUE)
+				return;
+			#elif defined MOE_GCC
+			int flags = O_CLOEXEC;
+			switch (accessRight)
+			{
+			case FileStream::ReadOnly:
+				flags |= O_RDONLY;
+				break;
+			case FileStream::WriteOnly:
+				flags |= O_WRONLY | O_CREAT | O_TRUNC;
+				break;
+			case FileStream::ReadWrite:
+				flags |= O_RDWR | O_CREAT | O_TRUNC;
+				break;
+			case FileStream::Append:
+				flags |= O_WRONLY | O_CREAT | O_APPEND;
+				break;
+			}
+			mint len = wtoa(fileName.c_str(), 0, 0);
+			char* buffer = (char*)cpuAllocate(sizeof(char)*len);
+			memset(buffer, 0, len * sizeof(*buffer));
+			wtoa(fileName.c_str(), buffer, (int)len);
+			handle = ::open(buffer, flags, 0666);
+			cpuDeallocate(buffer, sizeof(char)*len);
+			if (handle < 0)
+				return;
+			#endif
+
+			#if defined MOE_IO_URING
+			if (allowIoUring && ring.open((unsigned)(depth < 4096 ? depth : 4096)))
+			{
+				mode = IoUring;
+				if (maxPending > ring.capacity())
+					maxPending = ring.capacity();
+				completer = std::thread([this]() { complete(); });
+				return;
+			}
+			#endif
+			workers.reset(new ThreadPool(depth < 4 ? depth : 4));
+		}
+
+		~AsyncFileStream()
+		{
+			close();
+		}
+
+		bool available() const
+		{
+			#if defined MOE_MSVC
+			return handle != INVALID_HANDLE_VALUE;
+			#elif defined MOE_GCC
+			return handle >= 0;
+			#endif
+		}
+
+		/**
+		 * @brief return how the operations are run
+		 */
+		Backend backend() const
+		{
+			return mode;
+		}
+
+		/**
+		 * @brief wait for the operations and close the file
+		 */
+		void close()
+		{
+			if (!available())
+				return;
+			wait();
+
+			#if defined MOE_IO_URING
+			if (mode == IoUring)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					ring.submit(-1, AsyncFileStream_Internal::Read, 0, 0, 0, 0);
+				}
+				completer.join();
+				ring.close();
+			}
+			#endif
+			workers.reset();
+
+			#if defined MOE_MSVC
+			CloseHandle(handle);
+			handle = INVALID_HANDLE_VALUE;
+			#elif defined MOE_GCC
+			::close(handle);
+			handle = -1;
+			#endif
+		}
+
+		/**
+		 * @brief read bytes at a position
+		 * @return the number of bytes read, -1 on error
+		 */
+		std::future<mint> read(mint64 offset, void* buffer, size_t size)
+		{
+			MOE_ERROR(accessRight == FileStream::ReadOnly || accessRight == FileStream::ReadWrite, "AsyncFileStream::read(mint64 offset, void* buffer, size_t size): The file is not readable.");
+			return queue(AsyncFileStream_Internal::Read, offset, (char*)buffer, size, nullptr);
+		}
+
+		/**
+		 * @brief read bytes at a position and call a function with the number of bytes read, or -1
+		 */
+		void read(mint64 offset, void* buffer, size_t size, std::function<void(mint)> callback)
+		{
+			MOE_ERROR(accessRight == FileStream::ReadOnly || accessRight == FileStream::ReadWrite, "AsyncFileStream::read(mint64 offset, void* buffer, size_t size, std::function<void(mint)> callback): The file is not readable.");
+			MOE_ERROR(callback != nullptr, "AsyncFileStream::read(mint64 offset, void* buffer, size_t size, std::function<void(mint)> callback): Argument callback is null.");
+			queue(AsyncFileStream_Internal::Read, offset, (char*)buffer, size, std::move(callback));
+		}
+
+		/**
+		 * @brief write bytes at a position
+		 * @return the number of bytes written, -1 on error
+		 */
+		std::future<mint> write(mint64 offset, const void* buffer, size_t size)
+		{
+			MOE_ERROR(accessRight != FileStream::ReadOnly, "AsyncFileStream::write(mint64 offset, const void* buffer, size_t size): The file is not writable.");
+			return queue(AsyncFileStream_Internal::Write, offset, (char*)buffer, size, nullptr);
+		}
+
+		/**
+		 * @brief write bytes at a position and call a function with the number of bytes written, or -1
+		 */
+		void write(mint64 offset, const void* buffer, size_t size, std::function<void(mint)> callback)
+		{
+			MOE_ERROR(accessRight != FileStream::ReadOnly, "AsyncFileStream::write(mint64 offset, const void* buffer, size_t size, std::function<void(mint)> callback): The file is not writable.");
+			MOE_ERROR(callback != nullptr, "AsyncFileStream::write(mint64 offset, const void* buffer, size_t size, std::function<void(mint)> callback): Argument callback is null.");
+			queue(AsyncFileStream_Internal::Write, offset, (char*)buffer, size, std::move(callback));
+		}
+
+		/**
+		 * @brief wait until all the operations queued so far have completed and their callbacks returned
+		 */
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return unfinished == 0; });
+		}
+
+	private:
+		FileStream::AccessRight					accessRight;
+		AsyncFileStream_Internal::Handle		handle;
+		size_t									pending;
+		size_t									unfinished;
+		size_t									maxPending;
+		Backend									mode;
+		std::mutex								mutex;
+		std::condition_variable					condition;
+		std::unique_ptr<ThreadPool>				workers;
+		#if defined MOE_IO_URING
+		AsyncFileStream_Internal::Ring			ring;
+		std::thread								completer;
+		#endif
+
+		std::future<mint> queue(AsyncFileStream_Internal::Operation operation, mint64 offset, char* buffer, size_t size, std::function<void(mint)> callback)
+		{
+			MOE_ERROR(available(), "AsyncFileStream::queue(Operation operation, mint64 offset, char* buffer, size_t size, std::function<void(mint)> callback): The file is not available.");
+			MOE_ERROR(offset >= 0, "AsyncFileStream::queue(Operation operation, mint64 offset, char* buffer, size_t size, std::function<void(mint)> callback): Argument offset out of range.");
+
+			AsyncFileStream_Internal::Request* request = new AsyncFileStream_Internal::Request();
+			request->operation = operation;
+			request->offset = offset;
+			request->buffer = buffer;
+			request->size = size;
+			request->done = 0;
+			request->callback = std::move(callback);
+			std::future<mint> result = request->promise.get_future();
+
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return pending < maxPending; });
+			pending++;
+			unfinished++;
+
+			#if defined MOE_IO_URING
+			if (mode == IoUring)
+			{
+				if (!submit(request))
+				{
+					lock.unlock();
+					finish(request, -1);
+				}
+				return result;
+			}
+			#endif
+
+			lock.unlock();
+			const AsyncFileStream_Internal::Handle file = handle;
+			workers->add([this, request, file]()
+			{
+				finish(request, AsyncFileStream_Internal::transfer(file, request->operation, request->offset, request->buffer, request->size));
+			});
+			return result;
+		}
+
+		/**
+		 * @brief free the place of a request before its callback, which may queue another operation
+		 */
+		void finish(AsyncFileStream_Internal::Request* request, mint result)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				pending--;
+				condition.notify_all();
+			}
+
+			if (request->callback)
+				request->callback(result);
+			else
+				request->promise.set_value(result);
+			delete request;
+
+			// wait() returns only after the callback, the stream may be destroyed as soon as the mutex is released
+			std::lock_guard<std::mutex> lock(mutex);
+			unfinished--;
+			condition.notify_all();
+		}
+
+		#if defined MOE_IO_URING
+		/**
+		 * @brief submit the part of a request that is not done yet, called with the mutex held
+		 */
+		bool submit(AsyncFileStream_Internal::Request* request)
+		{
+			// the length of an io_uring operation is 32 bits
+			size_t size = request->size - request->done;
+			if (size > 0x40000000)
+				size = 0x40000000;
+			return ring.submit(handle, request->operation, request->offset + request->done,
+				request->buffer + request->done, size, (muint64)(size_t)request);
+		}
+
+		/**
+		 * @brief take the completions until the no operation sent by close()
+		 */
+		void complete()
+		{
+			for (;;)
+			{
+				muint64 userData;
+				mint result;
+				ring.next(userData, result);
+				if (userData == 0)
+					return;
+
+				// the request was submitted under the mutex, taking it orders its fields before they are read
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+				}
+				AsyncFileStream_Internal::Request* request = (AsyncFileStream_Internal::Request*)(size_t)userData;
+				if (result == -EINTR || result == -EAGAIN)
+					result = 0;
+				else if (result < 0)
+				{
+					finish(request, request->done > 0 ? (mint)request->done : -1);
+					continue;
+				}
+				else if (result == 0 && request->done < request->size)
+				{
+					// the end of the file
+					finish(request, (mint)request->done);
+					continue;
+				}
+
+				// a short read or write goes on from where it stopped
+				request->done += (size_t)result;
+				if (request->done < request->size)
+				{
+					bool submitted;
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						submitted = submit(request);
+					}
+					if (!submitted)
+						finish(request, (mint)request->done);
+					continue;
+				}
+				finish(request, (mint)request->done);
+			}
+		}
+		#endif
+	};
+}
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef MoeLP_Base_BufferedFileWriter
+#define MoeLP_Base_BufferedFileWriter
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "../Text/Text.hpp"
+#include "../Text/ITextWriter.hpp"
+#include "../Text/CodeConvert.hpp"
+#include "FileSystem.hpp"
+#include "FileStream.hpp"
+
+#include <chrono>
+
+namespace MoeLP
+{
+	/**
+	 * @brief write texts to a file through a buffer
+	 * @example:
+	 * BufferedFileWriter writer(L"tagged.txt", File::utf8, false);
+	 * writer.setFlushInterval(1000);
+	 * for (...) writer.writeLine(...);
+	 * @detail the file is kept open and the texts are encoded into the buffer, which is written
+	 * when it is full, when the flush interval has passed since the last write to the file, when
+	 * flush() is called and when the writer is destroyed. Unlike File no bom is written. A writer
+	 * must not be used by several threads at once.
+	 */
+	class BufferedFileWriter : public ITextWriter
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(BufferedFileWriter)
+
+	public:
+		static const size_t defaultBufferSize = 1 << 20;
+
+		/**
+		 * @brief open a file
+		 * @param charset: the charset, File::withBom takes it from the bom of the file when appending
+		 * @param append: true to write after the content of the file, false to clear it first
+		 * @param bufferSize: the number of bytes kept before they are written, at least 64
+		 */
+		BufferedFileWriter(const FilePath& filePath, File::Charset charset = File::withBom, bool append = true, size_t bufferSize = defaultBufferSize)
+			: fileCharset(resolveCharset(filePath, charset, append)),
+			stream(filePath.toText(), append ? FileStream::Append : FileStream::WriteOnly),
+			buffer(0),
+			capacity(bufferSize),
+			used(0),
+			interval(0),
+			lastFlush(std::chrono::steady_clock::now())
+		{
+			MOE_ERROR(bufferSize >= 64, "BufferedFileWriter::BufferedFileWriter(const FilePath& filePath, File::Charset charset, bool append, size_t bufferSize): Argument bufferSize out of range.");
+			buffer = (char*)cpuAllocate(sizeof(char) * capacity);
+		}
+
+		~BufferedFileWriter()
+		{
+			if (stream.available())
+				flush();
+			cpuDeallocate(buffer, sizeof(char) * capacity);
+		}
+
+		bool available() const
+		{
+			return stream.available();
+		}
+
+		File::Charset charset() const
+		{
+			return fileCharset;
+		}
+
+		/**
+		 * @brief write the buffer when a write comes this many milliseconds after the last time it was written
+		 * @param milliseconds: the interval, 0 writes the buffer only when it is full or flushed
+		 */
+		void setFlushInterval(mint milliseconds)
+		{
+			MOE_ERROR(milliseconds >= 0, "BufferedFileWriter::setFlushInterval(mint milliseconds): Argument milliseconds out of range.");
+			interval = milliseconds;
+		}
+
+		/**
+		 * @brief write the buffer and give it to the system
+		 */
+		void flush()
+		{
+			MOE_ERROR(stream.available(), "BufferedFileWriter::flush(): The file is not available.");
+			writeBuffer();
+			stream.flush();
+		}
+
+	protected:
+		virtual void writeText(const Text& text)
+		{
+			if (text.length() == 0)
+				return;
+			MOE_ERROR(stream.available(), "BufferedFileWriter::writeText(const Text& text): The file is not available.");
+
+			if (fileCharset == File::ansi)
+			{
+				mint len = wtoa(text.c_str(), nullptr, 0);
+				char* local = (char*)cpuAllocate(sizeof(char) * len);
+				memset(local, 0, len * sizeof(char));
+				wtoa(text.c_str(), local, len);
+				writeBytes(local, len - 1);
+				cpuDeallocate(local, sizeof(char) * len);
+			}
+			else
+			{
+				// the characters are encoded right into the buffer, a slice never ends inside a surrogate pair
+				const size_t unitBytes = fileCharset == File::utf8 ? 3 : fileCharset == File::gb18030 ? 4 : 2;
+				const muint16* p = text.data();
+				size_t length = text.length();
+				while (length > 0)
+				{
+					size_t count = (capacity - used) / unitBytes;
+					if (count >= length)
+						count = length;
+					else if (count > 0 && p[count - 1] >= 0xD800 && p[count - 1] < 0xDC00)
+						count--;
+					if (count == 0)
+					{
+						writeBuffer();
+						continue;
+					}
+
+					char* out = buffer + used;
+					switch (fileCharset)
+					{
+					case File::utf8:
+						used += utf16ToUtf8(p, count, out);
+						break;
+					case File::gb18030:
+						used += utf16ToGb18030(p, count, out);
+						break;
+					case File::utf16be:
+						swapBytes16(p, count, (muint16*)out);
+						used += sizeof(muint16) * count;
+						break;
+					default:
+						memcpy(out, p, sizeof(muint16) * count);
+						used += sizeof(muint16) * count;
+						break;
+					}
+					p += count;
+					length -= count;
+				}
+			}
+
+			if (interval > 0 && std::chrono::steady_clock::now() - lastFlush >= std::chrono::milliseconds(interval))
+				flush();
+		}
+
+	private:
+		File::Charset							fileCharset;
+		FileStream								stream;
+		char*									buffer;
+		size_t									capacity;
+		size_t									used;
+		mint									interval;
+		std::chrono::steady_clock::time_point	lastFlush;
+
+		static File::Charset resolveCharset(const FilePath& filePath, File::Charset charset, bool append)
+		{
+			muint8 bom[3] = { 0 };
+			if (append && charset == File::withBom)
+			{
+				FileStream fs(filePath.toText(), FileStream::ReadOnly);
+				if (fs.available())
+					fs.read(bom, 3);
+			}
+			File::detectBom(bom, charset);
+			return charset;
+		}
+
+		void writeBytes(const char* bytes, size_t length)
+		{
+			if (used + length > capacity)
+				writeBuffer();
+			if (length > capacity)
+			{
+				stream.write((void*)bytes, length);
+				return;
+			}
+			memcpy(buffer + used, bytes, length);
+			used += length;
+		}
+
+		void writeBuffer()
+		{
+			if (used > 0)
+				stream.write(buffer, used);
+			used = 0;
+			lastFlush = std::chrono::steady_clock::now();
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef MoeLP_Base_CorpusReader
+#define MoeLP_Base_CorpusReader
+
+#include "../Base.hpp"
+#include "../Text/Text.hpp"
+#include "../Text/TextView.hpp"
+#include "../Text/TextBuilder.hpp"
+#include "../Text/CodeConvert.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "FileSystem.hpp"
+#include "MappedFile.hpp"
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <thread>
+#include <type_traits>
+
+namespace MoeLP
+{
+	namespace CorpusReader_Internal
+	{
+		/**
+		 * @brief the indices of the chunks whose tasks have finished, in the order they finished
+		 */
+		class CompletionQueue
+		{
+		public:
+			void push(size_t index)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					indices.push(index);
+				}
+				condition.notify_one();
+			}
+
+			size_t pop()
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				condition.wait(lock, [this] { return !indices.empty(); });
+				size_t index = indices.front();
+				indices.pop();
+				return index;
+			}
+
+		private:
+			std::queue<size_t>		indices;
+			std::mutex				mutex;
+			std::condition_variable	condition;
+		};
+
+		/**
+		 * @brief push the index of a chunk when the task ends, even by an exception
+		 */
+		struct Completion
+		{
+			CompletionQueue&	queue;
+			size_t				index;
+
+			~Completion()
+			{
+				queue.push(index);
+			}
+		};
+	}
+
+	/**
+	 * @brief process a large text file by chunks of whole lines on a thread pool
+	 * @example:
+	 * CorpusReader corpus(L"corpus.txt", File::utf8);
+	 * corpus.run(
+	 *     [](const CorpusReader::Chunk& chunk, const TextView& text) { return countTokens(text); },
+	 *     [&](size_t index, size_t tokens) { total += tokens; },
+	 *     &pool);
+	 * @detail the file is mapped into memory and cut into chunks of about chunkSize bytes that
+	 * end after a line break, so no line is split. A worker decodes its chunk into utf-16 and
+	 * gives it to process. The results are given to consume on the calling thread, in the order
+	 * of the chunks or in the order they are ready. Only a few chunks are in flight at once, so
+	 * the memory used does not depend on the size of the file.
+	 */
+	class CorpusReader
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(CorpusReader)
+
+	public:
+		static const size_t defaultChunkSize = 16 << 20;
+
+		enum Order
+		{
+			Ordered,
+			Unordered
+		};
+
+		/**
+		 * @brief a range of bytes that holds whole lines
+		 */
+		struct Chunk
+		{
+			size_t	index;
+			size_t	offset;
+			size_t	length;
+		};
+
+		/**
+		 * @brief map a file and cut it into chunks
+		 * @param charset: the charset, File::withBom finds it as File does
+		 * @param chunkSize: the number of bytes of a chunk before it is extended to the next line break
+		 */
+		CorpusReader(const FilePath& filePath, File::Charset charset = File::withBom, size_t chunkSize = defaultChunkSize)
+			: fileCharset(charset)
+		{
+			MOE_ERROR(chunkSize > 0, "CorpusReader::CorpusReader(const FilePath& filePath, File::Charset charset, size_t chunkSize): Argument chunkSize out of range.");
+			if (!file.open(filePath.toText(), MappedFile::Sequential))
+				return;
+
+			muint8 bom[3] = { 0 };
+			if (file.length() > 0)
+				memcpy(bom, file.data(), file.length() < 3 ? file.length() : 3);
+			split((size_t)File::detectBom(bom, fileCharset), chunkSize);
+		}
+
+		bool available() const
+		{
+			return file.isOpen();
+		}
+
+		/**
+		 * @brief return the charset of the file, File::withBom is replaced by the charset found
+		 */
+		File::Charset charset() const
+		{
+			return fileCharset;
+		}
+
+		const std::vector<Chunk>& chunks() const
+		{
+			return chunkList;
+		}
+
+		/**
+		 * @brief decode a chunk into utf-16 characters
+		 * @param builder: the buffer of the characters, the content is appended to it
+		 * @return the characters, valid as long as the builder and the reader
+		 * @detail an utf-16 little endian chunk is not copied, the view points into the mapping.
+		 */
+		TextView decode(const Chunk& chunk, TextBuilder& builder) const
+		{
+			const char* p = file.data() + chunk.offset;
+			const size_t length = chunk.length;
+			const size_t first = builder.length();
+
+			switch (fileCharset)
+			{
+			case File::utf16:
+				// the mapping begins at a page and the chunks at even offsets
+				return TextView((const muint16*)p, length / 2);
+			case File::utf16be:
+				swapBytes16((const muint16*)p, length / 2, builder.grow(length / 2));
+				builder.commit(length / 2);
+				break;
+			case File::utf8:
+				builder.commit(utf8ToUtf16(p, length, builder.grow(length)));
+				break;
+			case File::gb18030:
+				builder.commit(gb18030ToUtf16(p, length, builder.grow(length)));
+				break;
+			default:
+			{
+				// the c runtime converts zero terminated strings, a zero byte ends a line as in LineReader
+				std::string local;
+				size_t begin = 0;
+				while (begin < length)
+				{
+					const char* end = (const char*)memchr(p + begin, '\0', length - begin);
+					size_t count = end ? end - (p + begin) : length - begin;
+					local.assign(p + begin, count);
+					builder.append(Text::fromLocal(local.c_str()));
+					if (end)
+						builder.append((muint16)L'\n');
+					begin += count + 1;
+				}
+			}
+			break;
+			}
+			return TextView(builder.data() + first, builder.length() - first);
+		}
+
+		/**
+		 * @brief process every chunk and consume the results
+		 * @param process: called as process(chunk, text) on the workers, it must be safe to call
+		 * from several threads at once, and returns the result of the chunk
+		 * @param consume: called as consume(chunk index, result) on the calling thread
+		 * @param pool: the pool to process on, the chunks are processed on the calling thread if it is null
+		 * @param order: Ordered gives the results in the order of the chunks, Unordered as soon as they are ready
+		 * @param window: the largest number of chunks in flight, twice the number of cpu threads if it is 0
+		 * @detail an exception thrown by process or consume is thrown again once the chunks in
+		 * flight are done.
+		 */
+		template<typename Process, typename Consume>
+		void run(Process process, Consume consume, ThreadPool* pool = nullptr, Order order = Ordered, size_t window = 0) const
+		{
+			typedef typename std::result_of<Process(const Chunk&, const TextView&)>::type Result;
+			MOE_ERROR(available(), "CorpusReader::run(Process process, Consume consume, ThreadPool* pool, Order order, size_t window): The file is not available.");
+
+			const size_t count = chunkList.size();
+			if (pool == nullptr)
+			{
+				TextBuilder builder;
+				for (size_t i = 0; i < count; i++)
+				{
+					builder.clear();
+					consume(i, process(chunkList[i], decode(chunkList[i], builder)));
+				}
+				return;
+			}
+
+			if (window == 0)
+				window = 2 * (std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1);
+
+			std::vector<std::future<Result>> results(count);
+			CorpusReader_Internal::CompletionQueue completed;
+			size_t next = 0;
+			size_t consumed = 0;
+			try
+			{
+				while (consumed < count)
+				{
+					for (; next < count && next - consumed < window; next++)
+					{
+						const size_t index = next;
+						results[index] = pool->add([this, &process, &completed, index]() -> Result
+						{
+							CorpusReader_Internal::Completion completion = { completed, index };
+							TextBuilder builder(chunkList[index].length);
+							return process(chunkList[index], decode(chunkList[index], builder));
+						});
+					}
+
+					// a finished index is pushed just before its result is set, get() waits for the rest
+					size_t index = order == Ordered ? consumed : completed.pop();
+					Result result = results[index].get();
+					consumed++;
+					consume(index, std::move(result));
+				}
+			}
+			catch (...)
+			{
+				for (size_t i = 0; i < next; i++)
+				{
+					if (results[i].valid())
+						results[i].wait();
+				}
+				throw;
+			}
+		}
+
+	private:
+		MappedFile			file;
+		File::Charset		fileCharset;
+		std::vector<Chunk>	chunkList;
+
+		/**
+		 * @brief return the position after the first line break from a position, or the end of the file
+		 * @param begin: the begin of the text, the utf-16 code units are counted from it
+		 */
+		size_t nextLine(size_t from, size_t begin) const
+		{
+			const char* p = file.data();
+			const size_t size = file.length();
+			while (from < size)
+			{
+				const char* found = (const char*)memchr(p + from, '\n', size - from);
+				if (found == 0)
+					return size;
+				size_t at = found - p;
+				switch (fileCharset)
+				{
+				case File::utf16:
+					if ((at - begin) % 2 == 0 && at + 1 < size && p[at + 1] == 0)
+						return at + 2;
+					break;
+				case File::utf16be:
+					if ((at - begin) % 2 == 1 && p[at - 1] == 0)
+						return at + 1;
+					break;
+				default:
+					return at + 1;
+				}
+				from = at + 1;
+			}
+			return size;
+		}
+
+		void split(size_t begin, size_t chunkSize)
+		{
+			const size_t size = file.length();
+			size_t offset = begin;
+			while (offset < size)
+			{
+				size_t end = size - offset <= chunkSize ? size : nextLine(offset + chunkSize, begin);
+				Chunk chunk = { chunkList.size(), offset, end - offset };
+				chunkList.push_back(chunk);
+				offset = end;
+			}
+		}
+	};
+}
+
+#endif
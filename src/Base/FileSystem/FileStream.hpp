@@ -4,10 +4,105 @@
 #include "../Base.hpp"
 #include "../Text/Text.hpp"
 
+#include <atomic>
+
+#if defined MOE_MSVC
+#include <windows.h>
+#include <io.h>
+#elif defined MOE_GCC
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#endif
+
 namespace MoeLP
 {
+	namespace FileStream_Internal
+	{
+		#if defined MOE_MSVC
+		typedef HANDLE Handle;
+		#elif defined MOE_GCC
+		typedef int Handle;
+		#endif
+
+		enum Operation
+		{
+			Read,
+			Write
+		};
+
+		/**
+		 * @brief read or write at a position until all the bytes are done or the end of the file
+		 * @return the number of bytes, or -1 if the operation failed before any byte
+		 */
+		inline mint transfer(Handle handle, Operation operation, mint64 offset, char* buffer, size_t size)
+		{
+			size_t done = 0;
+			while (done < size)
+			{
+				#if defined MOE_MSVC
+				OVERLAPPED overlapped = {};
+				overlapped.Offset = (DWORD)(offset + done);
+				overlapped.OffsetHigh = (DWORD)((offset + done) >> 32);
+				DWORD count = 0;
+				DWORD chunk = (DWORD)(size - done > 0x40000000 ? 0x40000000 : size - done);
+				BOOL result = operation == Read
+					? ReadFile(handle, buffer + done, chunk, &count, &overlapped)
+					: WriteFile(handle, buffer + done, chunk, &count, &overlapped);
+				if (!result)
+				{
+					if (operation == Read && GetLastError() == ERROR_HANDLE_EOF)
+						break;
+					return done > 0 ? (mint)done : -1;
+				}
+				#elif defined MOE_GCC
+				ssize_t count = operation == Read
+					? pread(handle, buffer + done, size - done, (off_t)(offset + done))
+					: pwrite(handle, buffer + done, size - done, (off_t)(offset + done));
+				if (count < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					return done > 0 ? (mint)done : -1;
+				}
+				#endif
+				if (count == 0)
+					break;
+				done += count;
+			}
+			return (mint)done;
+		}
+
+		inline mint64 tell(FILE* file)
+		{
+			#if defined MOE_MSVC
+			return _ftelli64(file);
+			#elif defined MOE_GCC
+			return (mint64)ftello(file);
+			#endif
+		}
+
+		inline int seek(FILE* file, mint64 offset, int origin)
+		{
+			#if defined MOE_MSVC
+			return _fseeki64(file, offset, origin);
+			#elif defined MOE_GCC
+			return fseeko(file, (off_t)offset, origin);
+			#endif
+		}
+	}
+
+	/**
+	 * @brief a file read and written through the c runtime
+	 * @detail the offsets are 64 bits. The size is taken from the system once and kept until
+	 * the stream writes, refreshSize() takes it again when another process may have changed
+	 * the file. readAt() and writeAt() do not use or move the position of the stream, several
+	 * threads can call them at once on disjoint ranges.
+	 */
 	class FileStream
 	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(FileStream)
+
 	public:
 		enum AccessRight
 		{
@@ -18,7 +113,8 @@ namespace MoeLP
 		};
 
 		FileStream(const Text& fileName, AccessRight accessRight)
-			: accessRight(accessRight)
+			: accessRight(accessRight),
+			fileSize(-1)
 		{
 			const char* mode = "wb+";
 			switch (accessRight)
@@ -90,45 +186,62 @@ namespace MoeLP
 		{
 			if (file != 0)
 			{
-				#if defined MOE_MSVC
-				mint64 pos = 0;
-				if (fgetpos(file, &pos) == 0)
-				{
-					return pos;
-				}
-				#elif defined MOE_GCC
-				return ftell(file);
-				#endif
+				return FileStream_Internal::tell(file);
 			}
 			return -1;
 		}
 
+		/**
+		 * @brief return the number of bytes, the written bytes kept by the c runtime are counted
+		 */
 		mint64 size() const
 		{
-			if (file != 0)
-			{
-				mint32 pos = ftell(file);
-				fseek(file, 0, SEEK_END);
-				mint32 size = ftell(file);
-				fseek(file, pos, SEEK_SET);
-				return (mint64)size;
-			}
-			return -1;
+			if (file == 0)
+				return -1;
+			mint64 size = fileSize.load(std::memory_order_relaxed);
+			if (size < 0)
+				size = refreshSize();
+			return size;
+		}
+
+		/**
+		 * @brief take the size from the system again
+		 */
+		mint64 refreshSize() const
+		{
+			if (file == 0)
+				return -1;
+			if (accessRight != ReadOnly)
+				fflush(file);
+
+			mint64 size = -1;
+			#if defined MOE_MSVC
+			struct _stat64 info;
+			if (_fstat64(_fileno(file), &info) == 0)
+				size = info.st_size;
+			#elif defined MOE_GCC
+			struct stat info;
+			if (fstat(fileno(file), &info) == 0)
+				size = info.st_size;
+			#endif
+			fileSize.store(size, std::memory_order_relaxed);
+			return size;
 		}
 
 		void seekFromCur(mint64 index)
 		{
-			if (position() + index > size())
+			const mint64 pos = position() + index;
+			if (pos > size())
 			{
-				fseek(file, 0, SEEK_END);
+				FileStream_Internal::seek(file, 0, SEEK_END);
 			}
-			else if (position() + index < 0)
+			else if (pos < 0)
 			{
-				fseek(file, 0, SEEK_SET);
+				FileStream_Internal::seek(file, 0, SEEK_SET);
 			}
 			else
 			{
-				fseek(file, index, SEEK_CUR);
+				FileStream_Internal::seek(file, index, SEEK_CUR);
 			}
 		}
 
@@ -136,15 +249,15 @@ namespace MoeLP
 		{
 			if (index > size())
 			{
-				fseek(file, 0, SEEK_END);
+				FileStream_Internal::seek(file, 0, SEEK_END);
 			}
 			else if (index < 0)
 			{
-				fseek(file, 0, SEEK_SET);
+				FileStream_Internal::seek(file, 0, SEEK_SET);
 			}
 			else
 			{
-				fseek(file, index, SEEK_SET);
+				FileStream_Internal::seek(file, index, SEEK_SET);
 			}
 		}
 
@@ -152,15 +265,15 @@ namespace MoeLP
 		{
 			if (index < 0)
 			{
-				fseek(file, 0, SEEK_END);
+				FileStream_Internal::seek(file, 0, SEEK_END);
 			}
 			else if (index > size())
 			{
-				fseek(file, 0, SEEK_SET);
+				FileStream_Internal::seek(file, 0, SEEK_SET);
 			}
 			else
 			{
-				fseek(file, -index, SEEK_END);
+				FileStream_Internal::seek(file, -index, SEEK_END);
 			}
 		}
 
@@ -175,22 +288,73 @@ namespace MoeLP
 		{
 			MOE_ERROR(file != 0, "FileStream::write(void* buffer, mint size): The stream is not available, may be it has been closed.");
 			MOE_ERROR(size != 0, "FileStream::write(void* buffer, mint size): Argument size is unlawful.");
+			fileSize.store(-1, std::memory_order_relaxed);
 			return fwrite(buffer, 1, size, file);
 		}
 
+		/**
+		 * @brief read bytes at a position without moving the position of the stream
+		 * @return the number of bytes read, fewer than size only at the end of the file, or -1 on error
+		 * @detail the bytes written by write() and not yet flushed are not seen. On Windows the
+		 * system moves the file pointer, seek before going on with read() or write().
+		 */
+		mint readAt(mint64 offset, void* buffer, mint size) const
+		{
+			MOE_ERROR(file != 0, "FileStream::readAt(mint64 offset, void* buffer, mint size): The stream is not available, may be it has been closed.");
+			MOE_ERROR(offset >= 0, "FileStream::readAt(mint64 offset, void* buffer, mint size): Argument offset out of range.");
+			MOE_ERROR(size >= 0, "FileStream::readAt(mint64 offset, void* buffer, mint size): Argument size out of range.");
+			return FileStream_Internal::transfer(handle(), FileStream_Internal::Read, offset, (char*)buffer, (size_t)size);
+		}
+
+		/**
+		 * @brief write bytes at a position without moving the position of the stream
+		 * @return the number of bytes written, or -1 on error
+		 * @detail flush() before writing at a position the bytes written by write(). With Append
+		 * the bytes go to the end of the file whatever the offset.
+		 */
+		mint writeAt(mint64 offset, const void* buffer, mint size)
+		{
+			MOE_ERROR(file != 0, "FileStream::writeAt(mint64 offset, const void* buffer, mint size): The stream is not available, may be it has been closed.");
+			MOE_ERROR(accessRight != ReadOnly, "FileStream::writeAt(mint64 offset, const void* buffer, mint size): The stream is not writable.");
+			MOE_ERROR(offset >= 0, "FileStream::writeAt(mint64 offset, const void* buffer, mint size): Argument offset out of range.");
+			MOE_ERROR(size >= 0, "FileStream::writeAt(mint64 offset, const void* buffer, mint size): Argument size out of range.");
+			mint count = FileStream_Internal::transfer(handle(), FileStream_Internal::Write, offset, (char*)buffer, (size_t)size);
+			fileSize.store(-1, std::memory_order_relaxed);
+			return count;
+		}
+
+		/**
+		 * @brief give the written bytes kept by the c runtime to the system
+		 */
+		void flush()
+		{
+			if (file != 0)
+				fflush(file);
+		}
+
 		mint peek(void* buffer, mint size)
 		{
 			MOE_ERROR(file != 0, "FileStream::peek(void* buffer, mint size): The stream is not available, may be it has been closed.");
 			MOE_ERROR(size != 0, "FileStream::peek(void* buffer, mint size): Argument size is unlawful.");
-			mint32 pos = ftell(file);
+			mint64 pos = FileStream_Internal::tell(file);
 			size_t count = fread(buffer, 1, size, file);
-			fseek(file, pos, SEEK_SET);
+			FileStream_Internal::seek(file, pos, SEEK_SET);
 			return count;
 		}
 
 	private:
 		AccessRight accessRight;
 		FILE* file;
+		mutable std::atomic<mint64> fileSize;
+
+		FileStream_Internal::Handle handle() const
+		{
+			#if defined MOE_MSVC
+			return (HANDLE)_get_osfhandle(_fileno(file));
+			#elif defined MOE_GCC
+			return fileno(file);
+			#endif
+		}
 	};
 }
 
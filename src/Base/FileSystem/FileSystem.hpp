@@ -4,6 +4,7 @@
 #include "../Base.hpp"
 #include "../Text/Text.hpp"
 #include "../Text/ITextWriter.hpp"
+#include "../Text/Transcoder.hpp"
 #include "FileStream.hpp"
 
 #if defined MOE_MSVC
@@ -12,12 +13,16 @@
 #elif defined MOE_GCC
 #include <sys/stat.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
 #endif
 #include <vector>
+#include <memory>
 
 namespace MoeLP
 {
+	class LineReader;
+
 	class FilePath
 	{
 	public:
@@ -30,25 +35,18 @@ namespace MoeLP
 		static const size_t maxLength = 512;
 
 		FilePath()
+			: storage(emptyStorage())
 		{
 		}
 
 		FilePath(const Text& path)
-			: fullPath(path)
+			: storage(share(normalize(path)))
 		{
-			init();
 		}
 
 		FilePath(const wchar_t* path)
-			: fullPath(path)
-		{
-			init();
-		}
-		
-		FilePath(const FilePath& other)
-			: fullPath(other.fullPath)
+			: storage(share(normalize(path)))
 		{
-			init();
 		}
 
 		~FilePath()
@@ -60,19 +58,19 @@ namespace MoeLP
 		{
 			#if defined MOE_MSVC
 			WIN32_FILE_ATTRIBUTE_DATA info;
-			BOOL result = GetFileAttributesExW(fullPath.c_str(), GetFileExInfoStandard, &info);
+			BOOL result = GetFileAttributesExW(text().c_str(), GetFileExInfoStandard, &info);
 			if (!result) return false;
 			return (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
 			#elif defined MOE_GCC
 			struct stat info;
-			mint len = wtoa(fullPath.c_str(), 0, 0);
+			mint len = wtoa(text().c_str(), 0, 0);
 			char* buffer = (char*)cpuAllocate(sizeof(char)*len);
 			memset(buffer, 0, len * sizeof(*buffer));
-			wtoa(fullPath.c_str(), buffer, (int)len);
+			wtoa(text().c_str(), buffer, (int)len);
 			int result = stat(buffer, &info);
-			if (result != 0) return false;
 			cpuDeallocate(buffer, sizeof(char)*len);
-			else return S_ISREG(info.st_mode);
+			if (result != 0) return false;
+			return S_ISREG(info.st_mode);
 			#endif
 		}
 
@@ -80,48 +78,57 @@ namespace MoeLP
 		{
 			#if defined MOE_MSVC
 			WIN32_FILE_ATTRIBUTE_DATA info;
-			BOOL result = GetFileAttributesExW(fullPath.c_str(), GetFileExInfoStandard, &info);
+			BOOL result = GetFileAttributesExW(text().c_str(), GetFileExInfoStandard, &info);
 			if (!result) return false;
 			return (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
 			#elif defined MOE_GCC
 			struct stat info;
-			mint len = wtoa(fullPath.c_str(), 0, 0);
+			mint len = wtoa(text().c_str(), 0, 0);
 			char* buffer = (char*)cpuAllocate(sizeof(char)*len);
 			memset(buffer, 0, len * sizeof(*buffer));
-			wtoa(fullPath.c_str(), buffer, (int)len);
+			wtoa(text().c_str(), buffer, (int)len);
 			int result = stat(buffer, &info);
-			if (result != 0) return false;
 			cpuDeallocate(buffer, sizeof(char)*len);
-			else return S_ISREG(info.st_mode);
+			if (result != 0) return false;
+			return S_ISDIR(info.st_mode);
 			#endif
 		}
 
 		bool isRoot() const
 		{
 			#if defined MOE_MSVC
-			return fullPath == L"";
+			return text() == L"";
 			#elif defined  MOE_GCC
-			return fullPath == L"/";
+			return text() == L"/";
 			#endif
 		}
 
 		Text name() const
 		{
-			auto index = fullPath.findLast(delimiter);
-			if (index.first == -1) return fullPath;
-			return fullPath.right(fullPath.length() - index.first - 1);
+			mint index = text().view().findLast(delimiter);
+			if (index == -1) return toText();
+			return Text(text().data() + index + 1, text().length() - index - 1);
 		}
 
+		/**
+		 * @brief return the folder of the path
+		 * @detail the folder of a normalized path is normalized, it is not normalized again
+		 * unless it is a root.
+		 */
 		FilePath folder() const
 		{
-			auto index = fullPath.findLast(delimiter);
-			if (index.first == -1) return fullPath;
-			return fullPath.left(index.first);
+			mint index = text().view().findLast(delimiter);
+			if (index == -1) return *this;
+			if (index <= 1) return FilePath(Text(text().data(), (size_t)index));
+			return FilePath(share(Text(text().data(), (size_t)index)));
 		}
 
+		/**
+		 * @brief return the path as a text, it shares the storage of the path
+		 */
 		Text toText() const
 		{
-			return fullPath;
+			return text();
 		}
 
 		/**
@@ -130,26 +137,25 @@ namespace MoeLP
 		 */
 		Text relativePath(const FilePath& dir)
 		{
-			if (fullPath.length() == 0 || dir.fullPath.length() == 0 || fullPath[0] != dir.fullPath[0])
+			if (text().length() == 0 || dir.text().length() == 0 || text()[0] != dir.text()[0])
 			{
-				return dir.fullPath;
+				return dir.toText();
 			}
 			#if defined MOE_MSVC
 			wchar_t buf[maxLength + 1] = { 0 };
 			PathRelativePathToW(
 				buf,
-				fullPath.c_str(),
+				text().c_str(),
 				(isFolder() ? FILE_ATTRIBUTE_DIRECTORY : 0),
-				dir.fullPath.c_str(),
+				dir.text().c_str(),
 				(dir.isFolder() ? FILE_ATTRIBUTE_DIRECTORY : 0)
 			);
 			return buf;
 			#elif defined MOE_GCC
 			std::vector<Text> srcSections, targetSections, resultSections;
-			getPathSections(isFolder() ? fullPath : folder().path(), srcSections);
-			getPathSections(dir.fullPath, targetSections);
-			size_t minLength = srcSections.size();
-			minLength <= targetSections.size() ? srcSections.size() : targetSections.size();
+			getPathSections(isFolder() ? text() : folder().text(), srcSections);
+			getPathSections(dir.text(), targetSections);
+			size_t minLength = srcSections.size() <= targetSections.size() ? srcSections.size() : targetSections.size();
 			mint lastCommonSection = 0;
 			for (size_t i = 0; i < minLength; i++)
 			{
@@ -208,22 +214,90 @@ namespace MoeLP
 			return compare(*this, filePath) >= 0;
 		}
 
+		/**
+		 * @brief join a relative path
+		 * @detail a single name is appended to the normalized path as it is, other paths are
+		 * normalized with the result.
+		 */
 		FilePath operator/(const Text& relativePath) const
 		{
+			#if defined MOE_MSVC
 			if (isRoot())
 			{
 				return relativePath;
 			}
-			else
+			#endif
+			if (!isName(relativePath))
 			{
-				return fullPath + L"/" + relativePath;
+				return Text(text(), Text(L"/")) + relativePath;
 			}
+
+			const bool root = text().length() > 0 && text()[text().length() - 1] == delimiter;
+			TextBuilder builder(text().length() + 1 + relativePath.length());
+			builder.append(text());
+			if (!root)
+				builder.append((muint16)delimiter);
+			builder.append(relativePath);
+			return FilePath(share(builder.toText()));
 		}
 
 	private:
-		mutable Text fullPath;
+		std::shared_ptr<const Text> storage;
+
+		/**
+		 * @brief wrap a path which is already normalized
+		 */
+		explicit FilePath(std::shared_ptr<const Text>&& normalized)
+			: storage(std::move(normalized))
+		{
+		}
 
-		void init()
+		const Text& text() const
+		{
+			return *storage;
+		}
+
+		/**
+		 * @brief make the storage of a normalized path, it is never changed after
+		 */
+		static std::shared_ptr<const Text> share(Text&& path)
+		{
+			// c_str() converts the text on its first call, it is done before the storage is shared
+			std::shared_ptr<Text> result = std::make_shared<Text>(std::move(path));
+			result->c_str();
+			return result;
+		}
+
+		static const std::shared_ptr<const Text>& emptyStorage()
+		{
+			static const std::shared_ptr<const Text> empty = share(Text());
+			return empty;
+		}
+
+		/**
+		 * @brief return true for a single name, which can be joined without being normalized
+		 */
+		static bool isName(const Text& name)
+		{
+			const size_t length = name.length();
+			if (length == 0 || (name[0] == L'.' && (length == 1 || (length == 2 && name[1] == L'.'))))
+				return false;
+			for (size_t i = 0; i < length; i++)
+			{
+				#if defined MOE_MSVC
+				if (name[i] == L'/' || name[i] == L'\\' || name[i] == L':')
+				#elif defined MOE_GCC
+				if (name[i] == L'/' || name[i] == L'\\')
+				#endif
+					return false;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief make a path absolute with one delimiter and without "." and ".."
+		 */
+		static Text normalize(Text fullPath)
 		{
 			wchar_t* temp = (wchar_t*)cpuAllocate(sizeof(wchar_t)*(fullPath.length() + 1));
 			memcpy(temp, fullPath.c_str(), sizeof(wchar_t) * (fullPath.length() + 1));
@@ -301,44 +375,31 @@ namespace MoeLP
 			{
 				fullPath = fullPath.left(fullPath.length() - 1);
 			}
+			return fullPath;
 		}
 
-		void getPathSections(Text path, std::vector<Text>& sections)
+		static void getPathSections(const Text& path, std::vector<Text>& sections)
 		{
 			sections.clear();
-			
-			Text remain = path;
 
-			while (true)
-			{
-				auto index = remain.findFirst(delimiter);
-				if (index.first == -1)
-					break;
+			TextView view = path.view();
 
-				if (index.first != 0)
-					sections.push_back(remain.left(index.first));
-				else
-				{
-					#if defined MOE_MSVC
-					if (remain.length() >= 2 && remain[1] == delimiter)
-					{
-						sections.push_back(delimiter);
-						index.second++;
-					}
-					#elif defined MOE_GCC
-					sections.push_back(delimiter);
-					#endif
-				}
-				remain = remain.right(remain.length() - (index.first + index.second));
-			}
+			#if defined MOE_MSVC
+			if (view.length() >= 2 && view[0] == delimiter && view[1] == delimiter)
+				sections.push_back(delimiter);
+			#elif defined MOE_GCC
+			if (view.length() >= 1 && view[0] == delimiter)
+				sections.push_back(delimiter);
+			#endif
 
-			if (remain.length() != 0)
+			for (TextView section : view.split(delimiter))
 			{
-				sections.push_back(remain);
+				if (!section.empty())
+					sections.push_back(Text(section));
 			}
 		}
 
-		Text sectionsToPath(const std::vector<Text>& sections)
+		static Text sectionsToPath(const std::vector<Text>& sections)
 		{
 			Text result;
 
@@ -388,7 +449,8 @@ namespace MoeLP
 			ansi,
 			utf8,
 			utf16,
-			utf16be
+			utf16be,
+			gb18030
 		};
 
 		File()
@@ -400,49 +462,22 @@ namespace MoeLP
 		 * @param filePath: the path of the file
 		 * @param charset: the charset, the default value is File::withBom, and if the file
 		 * doesn't have a bom it will be ansi(on windows) or utf-8(on linux) by default.
-		 * @detail if you want to use a utf-8 with no bom file on windows please set the charset File::utf8
+		 * @detail if you want to use a utf-8 with no bom file on windows please set the charset File::utf8.
+		 * File::gb18030 reads and writes GB18030, GBK and GB2312 files on every platform without
+		 * depending on the locale.
 		 */
 		File(const FilePath& filePath, Charset charset = File::withBom)
 			: filePath(filePath),
 			charset(charset),
-			bomSize(0),
-			rewriteFlag(true),
-			rereadFlag(true),
-			readCursor(0)
+			bomSize(0)
 		{
 			memset(bom, 0, 3);
 			FileStream fs(filePath.toText(), FileStream::ReadOnly);
 			MOE_ERROR(fs.available(), "The file is not avaliable.");
 
+			// the bom is found once here, the reads start after it and rewrite() puts it back
 			fs.read(bom, 3);
-
-			if (this->charset == File::withBom)
-			{
-				if (bom[0] == 0xFF && bom[1] == 0xFE)
-				{
-					this->charset = File::utf16;
-					bomSize = 2;
-				}
-				else if (bom[0] == 0xFE && bom[1] == 0xFF)
-				{
-					this->charset = File::utf16be;
-					bomSize = 2;
-				}
-				else if (bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF)
-				{
-					this->charset = File::utf8;
-					bomSize = 3;
-				}
-				else
-				{
-					#if defined MOE_PLATFORM_WINDOWS
-					this->charset = File::ansi;
-					#elif defined MOE_PLATFORM_LINUX
-					this->charset = File::utf8;
-					#endif
-					bomSize = 0 ;
-				}
-			}
+			bomSize = detectBom(bom, this->charset);
 		}
 
 		~File()
@@ -455,270 +490,73 @@ namespace MoeLP
 		}
 
 		/**
-		 * @breif clear the contents of the file.
-		 */
-		void rewrite()
-		{
-			FileStream fs(filePath.toText(), FileStream::WriteOnly);
-			MOE_ERROR(fs.available(), "The file is not avaliable.");
-			rewriteFlag = true;
-		}
-
-		/**
-		 * @breif read a line from the file.
-		 * @param bufferSize: the size of the cache buffer, if the number of bytes in a line exceeds it
-		 * you will get a line that is incomplete.
-		 * @detail the operation will move the cursor of file, if you want to reread from the begin of
-		 * the file please use the operation reread() to reset the read cursor.
+		 * @brief find the bom of a file and the charset it stands for
+		 * @param bytes: the first three bytes of the file, filled with zeros if the file is shorter
+		 * @param charset: the charset asked for, File::withBom is replaced by the charset found
+		 * @return the size of the bom, 0 if there is none or it does not belong to the charset
 		 */
-		Text readLine(size_t bufferSize = 512)
+		static mint detectBom(const muint8* bytes, Charset& charset)
 		{
-			FileStream fs(filePath.toText(), FileStream::ReadOnly);
-			MOE_ERROR(fs.available(), "The file is not avaliable.");
-
-			fs.seekFromBegin(readCursor);
-
-			Text result;
-
-			switch (charset)
-			{
-			case ansi:
+			if (bytes[0] == 0xFF && bytes[1] == 0xFE)
 			{
-				char* buffer = (char*)cpuAllocate(bufferSize * sizeof(char));
-				mint i = 0;
-				mint len = 0;
-
-				while (true)
-				{
-					char c;
-					mint err = fs.read(&c, sizeof(char));
-
-					if (c == '\0' || c == '\n')
-					{
-						buffer[i] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else if (err == 0)
-					{
-						buffer[i] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else
-					{
-						if (i == bufferSize)
-						{
-							buffer[i] = '\0';
-							len = i;
-							i = 0;
-							break;
-						}
-						buffer[i++] = c;
-					}
-				}
-
-				readCursor += (len + 1);
-
-				result = Text::fromLocal(buffer);
-
-				cpuDeallocate(buffer, bufferSize * sizeof(char));
+				if (charset == File::withBom)
+					charset = File::utf16;
+				return charset == File::utf16 ? 2 : 0;
 			}
-			break;
-			case utf8:
+			if (bytes[0] == 0xFE && bytes[1] == 0xFF)
 			{
-				char* buffer = (char*)cpuAllocate(bufferSize * sizeof(char));
-				mint i = 0;
-				mint len = 0;
-
-				while (true)
-				{
-					char c;
-					mint err = fs.read(&c, sizeof(char));
-
-					if (c == '\0' || c == '\n')
-					{
-						buffer[i] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else if (err == 0)
-					{
-						buffer[i] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else
-					{
-						if (i == bufferSize)
-						{
-							buffer[i] = '\0';
-							len = i;
-							i = 0;
-						}
-						buffer[i++] = c;
-					}
-				}
-
-				readCursor += (len + 1);
-
-				if (rereadFlag && bomSize != 0)
-				{
-					result = Text::fromUTF8(buffer + 3);
-					rereadFlag = false;
-				}
-				else
-					result = Text::fromUTF8(buffer);
-
-				cpuDeallocate(buffer, bufferSize * sizeof(char));
+				if (charset == File::withBom)
+					charset = File::utf16be;
+				return charset == File::utf16be ? 2 : 0;
 			}
-			break;
-			case utf16:
+			if (bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
 			{
-				char* buffer = (char*)cpuAllocate(bufferSize * sizeof(char));
-				mint i = 0;
-				mint len = 0;
-
-				while (true)
-				{
-					char c;
-					mint err = fs.read(&c, sizeof(char));
-
-					if (c == '\0' || c == '\n')
-					{
-						buffer[i] = '\0';
-						buffer[i + 1] = '\0';
-						len = i + 2;
-						i = 0;
-						break;
-					}
-					else if (err == 0)
-					{
-						buffer[i] = '\0';
-						buffer[i + 1] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else
-					{
-						if (i == bufferSize)
-						{
-							buffer[i] = '\0';
-							len = i;
-							i = 0;
-						}
-						buffer[i++] = c;
-					}
-				}
-
-				readCursor += len;
-
-				if (rereadFlag)
-				{
-					result = Text((muint16*)(buffer + 2));
-					rereadFlag = false;
-				}
-				else
-					result = Text((muint16*)(buffer));
-
-				cpuDeallocate(buffer, bufferSize * sizeof(char));
+				if (charset == File::withBom)
+					charset = File::utf8;
+				return charset == File::utf8 ? 3 : 0;
 			}
-			break;
-			case utf16be:
+			if (charset == File::withBom)
 			{
-				char* buffer = (char*)cpuAllocate(bufferSize * sizeof(char));
-				mint i = 0;
-				mint len = 0;
-
-				while (true)
-				{
-					char c;
-					mint err = fs.read(&c, sizeof(char));
-
-					if (c == '\0' || c == '\n')
-					{
-						buffer[i] = '\0';
-						buffer[i + 1] = '\0';
-						len = i + 2;
-						i = 0;
-						break;
-					}
-					else if (err == 0)
-					{
-						buffer[i] = '\0';
-						buffer[i + 1] = '\0';
-						len = i;
-						i = 0;
-						break;
-					}
-					else
-					{
-						if (i == bufferSize)
-						{
-							buffer[i] = '\0';
-							len = i;
-							i = 0;
-						}
-						buffer[i++] = c;
-					}
-				}
-
-				readCursor += len;
-
-				if (rereadFlag)
-				{
-					for (size_t i = 2; i < len; i += 2)
-					{
-						char temp = buffer[i];
-						buffer[i] = buffer[i + 1];
-						buffer[i + 1] = temp;
-					}
-					result = Text((muint16*)(buffer + 2));
-					rereadFlag = false;
-				}
-				else
-				{
-					for (size_t i = 0; i < len; i += 2)
-					{
-						char temp = buffer[i];
-						buffer[i] = buffer[i + 1];
-						buffer[i + 1] = temp;
-					}
-					result = Text((muint16*)(buffer));
-				}
-
-				cpuDeallocate(buffer, bufferSize * sizeof(char));
-			}
-			break;
+				#if defined MOE_PLATFORM_WINDOWS
+				charset = File::ansi;
+				#elif defined MOE_PLATFORM_LINUX
+				charset = File::utf8;
+				#endif
 			}
-
-			return result;
+			return 0;
 		}
 
 		/**
-		 * @breif move the read cursor to the begin of the file
+		 * @breif clear the contents of the file, the bom of the file is kept.
 		 */
-		void reread()
+		void rewrite()
 		{
-			FileStream fs(filePath.toText(), FileStream::ReadOnly);
+			FileStream fs(filePath.toText(), FileStream::WriteOnly);
 			MOE_ERROR(fs.available(), "The file is not avaliable.");
-			fs.seekFromBegin(0);
-			rewriteFlag = true;
-			readCursor = 0;
+			if (bomSize > 0)
+				fs.write(bom, bomSize);
+			reader.reset();
 		}
 
-		bool isEnd()
+		/**
+		 * @breif read a line from the file.
+		 * @param bufferSize: not used any more, the lines are read whole whatever their length.
+		 * @detail the file is kept open and read by a LineReader shared by the copies of the File,
+		 * "\r\n" is accepted as a line break. If you want to reread from the begin of the file please
+		 * use the operation reread().
+		 */
+		Text readLine(size_t bufferSize = 512);
+
+		/**
+		 * @breif move the read cursor to the begin of the file
+		 */
+		void reread()
 		{
-			FileStream fs(filePath.toText(), FileStream::ReadOnly);
-			MOE_ERROR(fs.available(), "The file is not avaliable.");
-			return readCursor >= fs.size();
+			reader.reset();
 		}
 
+		bool isEnd();
+
 		bool exists() const
 		{
 			return filePath.isFile();
@@ -768,12 +606,13 @@ namespace MoeLP
 		Charset		charset;
 		muint8		bom[3];
 		mint		bomSize;
-		bool		rewriteFlag;
-		bool		rereadFlag;
-		mint		readCursor;
+		std::shared_ptr<LineReader>	reader;
 
 		virtual void writeText(const Text& text)
 		{
+			if (text.length() == 0)
+				return;
+
 			FileStream fs(filePath.toText(), FileStream::Append);
 			MOE_ERROR(fs.available(), "The file is not avaliable.");
 
@@ -789,94 +628,632 @@ namespace MoeLP
 				cpuDeallocate(buf, sizeof(char)*len);
 			}
 			break;
+			case gb18030:
+			{
+				char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 4);
+				size_t len = utf16ToGb18030(text.data(), text.length(), buf);
+				fs.write(buf, len);
+				cpuDeallocate(buf, sizeof(char) * text.length() * 4);
+			}
+			break;
 			case utf8:
 			{
-				if (bomSize == 3)
+				size_t len = utf8LengthOfUtf16(text.data(), text.length());
+				char* buf = (char*)cpuAllocate(sizeof(char) * len);
+				utf16ToUtf8(text.data(), text.length(), buf);
+				fs.write(buf, len);
+				cpuDeallocate(buf, sizeof(char) * len);
+			}
+			break;
+			case utf16:
+			{
+				fs.write((void*)text.data(), sizeof(muint16) * text.length());
+			}
+			break;
+			case utf16be:
+			{
+				muint16* buf = (muint16*)cpuAllocate(sizeof(muint16) * text.length());
+				swapBytes16(text.data(), text.length(), buf);
+				fs.write(buf, sizeof(muint16) * text.length());
+				cpuDeallocate(buf, sizeof(muint16) * text.length());
+			}
+			break;
+			}
+		}
+	};
+
+	/**
+	 * @brief read the lines of a text file of any size
+	 * @example:
+	 * LineReader reader(L"corpus.txt", File::utf8);
+	 * TextView line;
+	 * while (reader.readLine(line)) {...}
+	 * @detail the file is kept open and read by blocks, a block is decoded into utf-16 at
+	 * once and the line breaks are searched in the decoded characters, so a line can be of
+	 * any length. "\r\n" is accepted as a line break and a final line break does not add an
+	 * empty line. With File::ansi a zero byte also ends a line, because the local code page
+	 * is converted by the c runtime. When the end is reached, the next call reads again the
+	 * bytes that have been appended to the file since.
+	 */
+	class LineReader
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(LineReader)
+
+	public:
+		static const size_t defaultBlockSize = 1 << 20;
+
+		/**
+		 * @brief open a file
+		 * @param charset: the charset, File::withBom finds it as File does
+		 * @param blockSize: the number of bytes read at once
+		 */
+		LineReader(const FilePath& filePath, File::Charset charset = File::withBom, size_t blockSize = defaultBlockSize)
+			: stream(filePath.toText(), FileStream::ReadOnly),
+			fileCharset(charset),
+			bomSize(0),
+			blockSize(blockSize & ~(size_t)1),
+			units(0),
+			unitCapacity(0),
+			head(0),
+			tail(0),
+			scanned(0),
+			bytes(0),
+			byteCapacity(0),
+			pendingBytes(0),
+			oddByte(0),
+			hasOddByte(false),
+			position(0),
+			ended(false)
+		{
+			MOE_ERROR(blockSize >= 2, "LineReader::LineReader(const FilePath& filePath, File::Charset charset, size_t blockSize): Argument blockSize out of range.");
+			if (stream.available())
+			{
+				muint8 bom[3] = { 0 };
+				stream.read(bom, 3);
+				bomSize = File::detectBom(bom, fileCharset);
+				rewind();
+			}
+		}
+
+		~LineReader()
+		{
+			if (units)
+				cpuDeallocate(units, sizeof(muint16) * unitCapacity);
+			if (bytes)
+				cpuDeallocate(bytes, sizeof(char) * byteCapacity);
+		}
+
+		bool available() const
+		{
+			return stream.available();
+		}
+
+		/**
+		 * @brief return the charset of the file, File::withBom is replaced by the charset found
+		 */
+		File::Charset charset() const
+		{
+			return fileCharset;
+		}
+
+		/**
+		 * @brief read the next line without copying it
+		 * @param line: the line, it is valid until the next operation on the reader
+		 * @return false if there is no line left
+		 */
+		bool readLine(TextView& line)
+		{
+			MOE_ERROR(stream.available(), "LineReader::readLine(TextView& line): The file is not available.");
+			for (;;)
+			{
+				mint found = TextView(units, tail).find(L'\n', scanned);
+				if (found != -1)
 				{
-					if (rewriteFlag)
-					{
-						char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 6 + 3);
-						char* start = buf + 3;
-						size_t len = codeConvert(text.data(), start);
-						memcpy(buf, bom, sizeof(char) * 3);
-						fs.write(buf, len + 3);
-						cpuDeallocate(buf, sizeof(char) * text.length() * 6 + 3);
-						rewriteFlag = false;
-					}
-					else
-					{
-						char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 6);
-						size_t len = codeConvert(text.data(), buf);
-						fs.write(buf, len);
-						cpuDeallocate(buf, sizeof(char) * text.length() * 6);
-					}
+					size_t end = (size_t)found;
+					if (end > head && units[end - 1] == L'\r')
+						end--;
+					line = TextView(units + head, end - head);
+					head = scanned = (size_t)found + 1;
+					return true;
 				}
-				else
+				scanned = tail;
+				if (!refill())
 				{
-					char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 6);
-					size_t len = codeConvert(text.data(), buf);
-					fs.write(buf, len);
-					cpuDeallocate(buf, sizeof(char) * text.length() * 6);
+					if (head == tail)
+						return false;
+					line = TextView(units + head, tail - head);
+					head = scanned = tail;
+					return true;
 				}
 			}
+		}
+
+		/**
+		 * @brief read the next line
+		 * @return false if there is no line left
+		 */
+		bool readLine(Text& line)
+		{
+			TextView view;
+			if (!readLine(view))
+				return false;
+			line = Text(view);
+			return true;
+		}
+
+		/**
+		 * @brief return whether there is no line left, a block is read if needed to know it
+		 */
+		bool isEnd()
+		{
+			MOE_ERROR(stream.available(), "LineReader::isEnd(): The file is not available.");
+			while (head == tail)
+			{
+				if (!refill())
+					return true;
+			}
+			return false;
+		}
+
+		/**
+		 * @brief move back to the begin of the file
+		 */
+		void reread()
+		{
+			MOE_ERROR(stream.available(), "LineReader::reread(): The file is not available.");
+			rewind();
+		}
+
+	private:
+		FileStream		stream;
+		File::Charset	fileCharset;
+		mint			bomSize;
+		size_t			blockSize;
+		muint16*		units;				// the decoded characters, the pending ones are from head to tail
+		size_t			unitCapacity;
+		size_t			head;
+		size_t			tail;
+		size_t			scanned;			// the characters before it have no line break
+		char*			bytes;				// the bytes read but not decoded yet
+		size_t			byteCapacity;
+		size_t			pendingBytes;
+		muint8			oddByte;			// the first byte of an utf-16 code unit cut by the block
+		bool			hasOddByte;
+		mint64			position;			// the position in the file of the next block
+		bool			ended;
+		Utf8Decoder		utf8Decoder;
+		Gb18030Decoder	gb18030Decoder;
+
+		void rewind()
+		{
+			head = tail = scanned = 0;
+			pendingBytes = 0;
+			hasOddByte = false;
+			utf8Decoder.reset();
+			gb18030Decoder.reset();
+			position = bomSize;
+			ended = false;
+			stream.seekFromBegin(position);
+		}
+
+		void reserveUnits(size_t capacity)
+		{
+			if (capacity <= unitCapacity)
+				return;
+			if (capacity < unitCapacity * 2)
+				capacity = unitCapacity * 2;
+			muint16* buffer = (muint16*)cpuAllocate(sizeof(muint16) * capacity);
+			if (units)
+			{
+				memcpy(buffer, units, sizeof(muint16) * tail);
+				cpuDeallocate(units, sizeof(muint16) * unitCapacity);
+			}
+			units = buffer;
+			unitCapacity = capacity;
+		}
+
+		void reserveBytes(size_t capacity)
+		{
+			if (capacity <= byteCapacity)
+				return;
+			if (capacity < byteCapacity * 2)
+				capacity = byteCapacity * 2;
+			char* buffer = (char*)cpuAllocate(sizeof(char) * capacity);
+			if (bytes)
+			{
+				memcpy(buffer, bytes, sizeof(char) * pendingBytes);
+				cpuDeallocate(bytes, sizeof(char) * byteCapacity);
+			}
+			bytes = buffer;
+			byteCapacity = capacity;
+		}
+
+		/**
+		 * @brief convert the local bytes of whole lines after the pending characters, a zero byte is a line break
+		 * @return the number of characters added
+		 */
+		size_t decodeLocal(char* local, size_t length)
+		{
+			size_t begin = 0;
+			size_t first = tail;
+			while (begin < length)
+			{
+				size_t end = begin;
+				while (end < length && local[end] != '\0')
+					end++;
+				char c = local[end];
+				local[end] = '\0';
+				Text text = Text::fromLocal(local + begin);
+				local[end] = c;
+
+				reserveUnits(tail + text.length() + 1);
+				memcpy(units + tail, text.data(), sizeof(muint16) * text.length());
+				tail += text.length();
+				if (end < length)
+					units[tail++] = L'\n';
+				begin = end + 1;
+			}
+			return tail - first;
+		}
+
+		/**
+		 * @brief decode the next block after the pending characters
+		 * @return false if nothing was read or decoded
+		 */
+		bool refill()
+		{
+			if (head > 0)
+			{
+				memmove(units, units + head, sizeof(muint16) * (tail - head));
+				tail -= head;
+				scanned -= head;
+				head = 0;
+			}
+			if (ended)
+			{
+				// the stream stays at its end once reached, seeking lets it see the appended bytes
+				stream.seekFromBegin(position);
+				ended = false;
+			}
+
+			size_t read = 0;
+			size_t count = 0;
+			switch (fileCharset)
+			{
+			case File::utf16:
+			case File::utf16be:
+			{
+				// the bytes are read right into the characters
+				reserveUnits(tail + blockSize / 2 + 1);
+				char* p = (char*)(units + tail);
+				size_t carry = 0;
+				if (hasOddByte)
+				{
+					p[0] = (char)oddByte;
+					carry = 1;
+				}
+				read = (size_t)stream.read(p + carry, blockSize);
+				count = (carry + read) / 2;
+				hasOddByte = (carry + read) % 2 != 0;
+				if (hasOddByte)
+					oddByte = (muint8)p[carry + read - 1];
+				if (fileCharset == File::utf16be)
+					swapBytes16(units + tail, count, units + tail);
+				tail += count;
+			}
 			break;
-			case utf16:
+			case File::utf8:
+			case File::gb18030:
 			{
-				if (rewriteFlag)
+				reserveBytes(blockSize);
+				read = (size_t)stream.read(bytes, blockSize);
+				if (fileCharset == File::utf8)
 				{
-					char* buf = (char*)cpuAllocate(sizeof(char) * (text.length() * 2 + 2));
-					char* start = buf + 2;
-					memcpy(buf, bom, sizeof(char) * 2);
-					memcpy(start, text.data(), sizeof(muint16)*text.length());
-					fs.write(buf, sizeof(char) * (text.length() * 2 + 2));
-					cpuDeallocate(buf, sizeof(char) * (text.length() * 2 + 2));
-					rewriteFlag = false;
+					reserveUnits(tail + Utf8Decoder::maxOutput(read));
+					count = read > 0 ? utf8Decoder.feed(bytes, read, units + tail) : utf8Decoder.finish(units + tail);
 				}
 				else
 				{
-					char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 2);
-					memcpy(buf, text.data(), sizeof(muint16)*text.length());
-					fs.write(buf, sizeof(char) * text.length() * 2);
-					cpuDeallocate(buf, sizeof(char) * text.length() * 2);
+					reserveUnits(tail + Gb18030Decoder::maxOutput(read));
+					count = read > 0 ? gb18030Decoder.feed(bytes, read, units + tail) : gb18030Decoder.finish(units + tail);
 				}
+				tail += count;
 			}
 			break;
-			case utf16be:
+			default:
+			{
+				// the line breaks are found in the bytes, a line feed byte is never part of a multi-byte character
+				reserveBytes(pendingBytes + blockSize + 1);
+				read = (size_t)stream.read(bytes + pendingBytes, blockSize);
+				size_t length = pendingBytes + read;
+				size_t complete = length;
+				if (read > 0)
+				{
+					// the pending bytes have no line break, only the new ones are searched
+					while (complete > pendingBytes && bytes[complete - 1] != '\n' && bytes[complete - 1] != '\0')
+						complete--;
+					if (complete == pendingBytes)
+						complete = 0;
+				}
+				count = decodeLocal(bytes, complete);
+				pendingBytes = length - complete;
+				memmove(bytes, bytes + complete, pendingBytes);
+			}
+			break;
+			}
+
+			position += read;
+			ended = read == 0;
+			return read > 0 || count > 0;
+		}
+	};
+
+	inline Text File::readLine(size_t /*bufferSize*/)
+	{
+		if (!reader)
+			reader = std::make_shared<LineReader>(filePath, charset);
+		MOE_ERROR(reader->available(), "The file is not avaliable.");
+
+		Text line;
+		reader->readLine(line);
+		return line;
+	}
+
+	inline bool File::isEnd()
+	{
+		if (!reader)
+		{
+			FileStream fs(filePath.toText(), FileStream::ReadOnly);
+			MOE_ERROR(fs.available(), "The file is not avaliable.");
+			return fs.size() <= bomSize;
+		}
+		return reader->isEnd();
+	}
+
+	namespace Folder_Internal
+	{
+		/**
+		 * @brief read the entries of a folder one by one
+		 * @detail the type of an entry is taken from the folder where the file system gives it,
+		 * only the entries of an unknown type and the followed links are given to fstatat, and
+		 * a sub folder is opened relative to the descriptor of its parent.
+		 */
+		class Listing
+		{
+			MOE_DISALLOW_COPY_AND_ASSIGN(Listing)
+
+		public:
+			enum Type
 			{
-				if (rewriteFlag)
+				FileEntry,
+				FolderEntry,
+				LinkEntry,
+				OtherEntry
+			};
+
+			Listing()
+				: entryType(OtherEntry),
+				#if defined MOE_MSVC
+				handle(INVALID_HANDLE_VALUE),
+				hasData(false)
+				#elif defined MOE_GCC
+				dir(0),
+				entry(0)
+				#endif
+			{
+			}
+
+			~Listing()
+			{
+				close();
+			}
+
+			/**
+			 * @brief open a folder by its path
+			 */
+			bool open(const Text& path)
+			{
+				close();
+				folderPath = path;
+				#if defined MOE_MSVC
+				return openHandle();
+				#elif defined MOE_GCC
+				mint len = wtoa(path.c_str(), nullptr, 0);
+				char* buffer = (char*)cpuAllocate(sizeof(char)*len);
+				memset(buffer, 0, len * sizeof(char));
+				wtoa(path.c_str(), buffer, len);
+				int fd = ::open(buffer, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+				cpuDeallocate(buffer, sizeof(char)*len);
+				return attach(fd);
+				#endif
+			}
+
+			/**
+			 * @brief open the current entry of a listing, which is a folder
+			 */
+			bool open(const Listing& parent, bool followLinks)
+			{
+				close();
+				folderPath = parent.entryPath();
+				#if defined MOE_MSVC
+				return openHandle();
+				#elif defined MOE_GCC
+				int fd = openat(dirfd(parent.dir), parent.entry->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC | (followLinks ? 0 : O_NOFOLLOW));
+				return attach(fd);
+				#endif
+			}
+
+			void close()
+			{
+				#if defined MOE_MSVC
+				if (handle != INVALID_HANDLE_VALUE)
+					FindClose(handle);
+				handle = INVALID_HANDLE_VALUE;
+				hasData = false;
+				#elif defined MOE_GCC
+				if (dir != 0)
+					closedir(dir);
+				dir = 0;
+				entry = 0;
+				#endif
+			}
+
+			/**
+			 * @brief go to the next entry, "." and ".." are skipped
+			 * @param followLinks: true to give a link the type of its target
+			 * @return false at the end of the folder
+			 */
+			bool next(bool followLinks)
+			{
+				#if defined MOE_MSVC
+				for (;;)
 				{
-					char* buf = (char*)cpuAllocate(sizeof(char) * (text.length() * 2 + 2));
-					char* start = buf + 2;
-					memcpy(start, text.data(), sizeof(muint16)*text.length());
-					for (size_t i = 2; i < text.length() * 2 + 2; i += 2)
+					if (handle == INVALID_HANDLE_VALUE)
+						return false;
+					if (!hasData && !FindNextFileW(handle, &data))
 					{
-						char temp = buf[i];
-						buf[i] = buf[i + 1];
-						buf[i + 1] = temp;
+						close();
+						return false;
 					}
-					memcpy(buf, bom, sizeof(char) * 2);
-					fs.write(buf, sizeof(char) * (text.length() * 2 + 2));
-					cpuDeallocate(buf, sizeof(char) * (text.length() * 2 + 2));
-					rewriteFlag = false;
+					hasData = false;
+					if (wcscmp(data.cFileName, L".") == 0 || wcscmp(data.cFileName, L"..") == 0)
+						continue;
+
+					entryName = data.cFileName;
+					if ((data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) && !followLinks)
+						entryType = LinkEntry;
+					else if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+						entryType = FolderEntry;
+					else
+						entryType = FileEntry;
+					return true;
 				}
-				else
+				#elif defined MOE_GCC
+				for (;;)
 				{
-					char* buf = (char*)cpuAllocate(sizeof(char) * text.length() * 2);
-					memcpy(buf, text.data(), sizeof(muint16)*text.length());
-					for (size_t i = 0; i < text.length() * 2; i += 2)
+					if (dir == 0 || (entry = readdir(dir)) == 0)
+						return false;
+					const char* name = entry->d_name;
+					if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+						continue;
+
+					entryName = Text::fromLocal(name);
+					switch (entry->d_type)
 					{
-						char temp = buf[i];
-						buf[i] = buf[i + 1];
-						buf[i + 1] = temp;
+					case DT_REG:
+						entryType = FileEntry;
+						break;
+					case DT_DIR:
+						entryType = FolderEntry;
+						break;
+					case DT_LNK:
+						entryType = followLinks ? statType(name, true) : LinkEntry;
+						break;
+					case DT_UNKNOWN:
+						entryType = statType(name, followLinks);
+						break;
+					default:
+						entryType = OtherEntry;
+						break;
 					}
-					fs.write(buf, sizeof(char) * text.length() * 2);
-					cpuDeallocate(buf, sizeof(char) * text.length() * 2);
+					return true;
 				}
+				#endif
 			}
-			break;
+
+			/**
+			 * @brief delete the current entry, a folder must be empty
+			 */
+			bool deleteEntry()
+			{
+				#if defined MOE_MSVC
+				Text path = entryPath();
+				if (entryType == FolderEntry || (entryType == LinkEntry && (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)))
+					return RemoveDirectoryW(path.c_str()) != 0;
+				return DeleteFileW(path.c_str()) != 0;
+				#elif defined MOE_GCC
+				return unlinkat(dirfd(dir), entry->d_name, entryType == FolderEntry ? AT_REMOVEDIR : 0) == 0;
+				#endif
+			}
+
+			const Text& path() const
+			{
+				return folderPath;
+			}
+
+			const Text& name() const
+			{
+				return entryName;
+			}
+
+			Type type() const
+			{
+				return entryType;
 			}
-		}
-	};
+
+			/**
+			 * @brief return the path of the current entry
+			 */
+			Text entryPath() const
+			{
+				const size_t length = folderPath.length();
+				if (length > 0 && folderPath[length - 1] == FilePath::delimiter)
+					return Text(folderPath, entryName);
+				TextBuilder builder(length + 1 + entryName.length());
+				builder.append(folderPath).append((muint16)FilePath::delimiter).append(entryName);
+				return builder.toText();
+			}
+
+		private:
+			Text				folderPath;
+			Text				entryName;
+			Type				entryType;
+			#if defined MOE_MSVC
+			HANDLE				handle;
+			WIN32_FIND_DATAW	data;
+			bool				hasData;
+
+			bool openHandle()
+			{
+				TextBuilder builder(folderPath.length() + 2);
+				builder.append(folderPath).append((muint16)FilePath::delimiter).append((muint16)L'*');
+				handle = FindFirstFileExW(builder.toText().c_str(), FindExInfoBasic, &data, FindExSearchNameMatch, 0, FIND_FIRST_EX_LARGE_FETCH);
+				hasData = handle != INVALID_HANDLE_VALUE;
+				return hasData;
+			}
+			#elif defined MOE_GCC
+			DIR*				dir;
+			struct dirent*		entry;
+
+			bool attach(int fd)
+			{
+				if (fd < 0)
+					return false;
+				dir = fdopendir(fd);
+				if (dir == 0)
+				{
+					::close(fd);
+					return false;
+				}
+				return true;
+			}
+
+			Type statType(const char* name, bool followLinks) const
+			{
+				struct stat info;
+				if (fstatat(dirfd(dir), name, &info, followLinks ? 0 : AT_SYMLINK_NOFOLLOW) != 0)
+					return OtherEntry;
+				if (S_ISREG(info.st_mode))
+					return FileEntry;
+				if (S_ISDIR(info.st_mode))
+					return FolderEntry;
+				if (S_ISLNK(info.st_mode))
+					return LinkEntry;
+				return OtherEntry;
+			}
+			#endif
+		};
+	}
 
 	class Folder
 	{
@@ -918,77 +1295,22 @@ namespace MoeLP
 				}
 				return false;
 			}
-			else
-			{
-				if (!exists()) return false;
-				WIN32_FIND_DATAW findData;
-				HANDLE findHandle = INVALID_HANDLE_VALUE;
-
-				while (true)
-				{
-					if (findHandle == INVALID_HANDLE_VALUE)
-					{
-						Text searchPath = (filePath / L"*").toText();
-						findHandle = FindFirstFileW(searchPath.c_str(), &findData);
-						if (findHandle == INVALID_HANDLE_VALUE)
-						{
-							break;
-						}
-					}
-					else
-					{
-						BOOL result = FindNextFileW(findHandle, &findData);
-						if (result == 0)
-						{
-							FindClose(findHandle);
-							break;
-						}
-					}
-
-					if (findData.dwFileAttributes&FILE_ATTRIBUTE_DIRECTORY)
-					{
-						if (wcscmp(findData.cFileName, L".") != 0 && wcscmp(findData.cFileName, L"..") != 0)
-						{
-							folders.push_back(Folder(filePath / findData.cFileName));
-						}
-					}
-				}
-				return true;
-			}
-			#elif defined MOE_GCC
-			if (!exists()) return false;
-			DIR* dir;
+			#endif
 
-			mint len = wtoa(filePath.toText().c_str(), nullptr, 0);
-			char* searchPath = (char*)cpuAllocate(sizeof(char)*len);
-			memset(searchPath, 0, len * sizeof(char));
-			wtoa(filePath.toText().c_str(), searchPath, len);
-			
-			if ((dir = opendir(searchPath)) == NULL)
+			Folder_Internal::Listing listing;
+			if (!listing.open(filePath.toText()))
 			{
 				return false;
 			}
 
-			struct dirent* entry;
-			while ((entry = readdir(dir)) != NULL)
+			while (listing.next(true))
 			{
-				Text childName = Text::fromLocal(entry->d_name);
-				FilePath childFullPath = filePath / childName;
-				if (childName != L"." && childName != L".." && childFullPath.isFolder())
+				if (listing.type() == Folder_Internal::Listing::FolderEntry)
 				{
-					folders.push_back(Folder(childFullPath));
+					folders.push_back(Folder(listing.entryPath()));
 				}
 			}
-
-			if (closedir(dir) != 0)
-			{
-				return false;
-			}
-
-			cpuDeallocate(searchPath, sizeof(char)*len);
-
 			return true;
-			#endif
 		}
 
 		bool subfiles(std::vector<File>& files) const
@@ -998,71 +1320,22 @@ namespace MoeLP
 			{
 				return true;
 			}
+			#endif
 
-			if (!exists()) return false;
-			WIN32_FIND_DATAW findData;
-			HANDLE findHandle = INVALID_HANDLE_VALUE;
-
-			while (true)
-			{
-				if (findHandle == INVALID_HANDLE_VALUE)
-				{
-					Text searchPath = (filePath / L"*").toText();
-					findHandle = FindFirstFileW(searchPath.c_str(), &findData);
-					if (findHandle == INVALID_HANDLE_VALUE)
-					{
-						break;
-					}
-				}
-				else
-				{
-					BOOL result = FindNextFileW(findHandle, &findData);
-					if (result == 0)
-					{
-						FindClose(findHandle);
-						break;
-					}
-				}
-
-				if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
-				{
-					files.push_back(File(filePath / findData.cFileName));
-				}
-			}
-			return true;
-			#elif defined MOE_GCC
-			if (!exists()) return false;
-
-			DIR *dir;
-			mint len = wtoa(filePath.toText().c_str(), nullptr, 0);
-			char* searchPath = (char*)cpuAllocate(sizeof(char)*len);
-			memset(searchPath, 0, len * sizeof(char));
-			wtoa(filePath.toText().c_str(), searchPath, len);
-
-			if ((dir = opendir(searchPath)) == NULL)
+			Folder_Internal::Listing listing;
+			if (!listing.open(filePath.toText()))
 			{
 				return false;
 			}
 
-			struct dirent* entry;
-			while ((entry = readdir(dir)) != NULL)
+			while (listing.next(true))
 			{
-				FilePath childFullPath = filePath / Text::fromLocal(entry->d_name);
-				if (childFullPath.isFile())
+				if (listing.type() == Folder_Internal::Listing::FileEntry)
 				{
-					files.push_back(File(childFullPath));
+					files.push_back(File(FilePath(listing.entryPath())));
 				}
 			}
-
-			if (closedir(dir) != 0)
-			{
-				return false;
-			}
-
-			cpuDeallocate(searchPath, sizeof(char)*len);
-
 			return true;
-			#endif
 		}
 
 		bool createFolder(bool recursively = true) const
@@ -1096,20 +1369,9 @@ namespace MoeLP
 
 			if (recursively)
 			{
-				std::vector<Folder> folders;
-				subfolders(folders);
-				for (auto folder : folders)
-				{
-					if (!folder.deleteFolder(true)) return false;
-				}
-
-				std::vector<File> files;
-				subfiles(files);
-				for (auto file : files)
-				{
-					if (!file.deleteFile()) return false;
-				}
-
+				Folder_Internal::Listing listing;
+				if (!listing.open(filePath.toText()) || !deleteContent(listing)) return false;
+				listing.close();
 				return deleteFolder(false);
 			}
 			#if defined MOE_MSVC
@@ -1119,7 +1381,7 @@ namespace MoeLP
 			char* buf = (char*)cpuAllocate(sizeof(char)*len);
 			memset(buf, 0, len * sizeof(char));
 			wtoa(filePath.toText().c_str(), buf, len);
-			bool suc = (rmdir(buf, 0777) == 0);
+			bool suc = (rmdir(buf) == 0);
 			cpuDeallocate(buf, sizeof(char)*len);
 			return suc;
 			#endif
@@ -1161,6 +1423,23 @@ namespace MoeLP
 
 	private:
 		mutable FilePath filePath;
+
+		/**
+		 * @brief delete everything in a folder, the links are deleted and not followed
+		 */
+		static bool deleteContent(Folder_Internal::Listing& listing)
+		{
+			while (listing.next(false))
+			{
+				if (listing.type() == Folder_Internal::Listing::FolderEntry)
+				{
+					Folder_Internal::Listing child;
+					if (!child.open(listing, false) || !deleteContent(child)) return false;
+				}
+				if (!listing.deleteEntry()) return false;
+			}
+			return true;
+		}
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,396 @@
+#ifndef MoeLP_Base_FolderWalker
+#define MoeLP_Base_FolderWalker
+
+#include "../Base.hpp"
+#include "../Text/Text.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "FileSystem.hpp"
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <thread>
+#include <exception>
+
+namespace MoeLP
+{
+	/**
+	 * @brief walk through a folder and all its sub folders
+	 * @example:
+	 * FolderWalker walker(L"corpus");
+	 * walker.setFilter(FolderWalker::glob(L"*.txt"));
+	 * FolderWalker::Entry entry;
+	 * while (walker.next(entry)) {...}
+	 * walker.forEach([&](const FolderWalker::Entry& entry) {...}, &pool);
+	 * @detail the entries are read one at a time, a folder is given before what it holds. The
+	 * type of an entry comes from the folder listing, so no entry is given to stat where the
+	 * file system knows its type, and the sub folders are opened relative to their parent. No
+	 * FilePath is built for an entry unless it is asked for. The links are not followed unless
+	 * setFollowLinks(true) is called, then a link to a parent folder is walked again until the
+	 * largest depth.
+	 */
+	class FolderWalker
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(FolderWalker)
+
+	public:
+		struct Entry
+		{
+			Text							path;
+			Text							name;
+			size_t							depth;
+			Folder_Internal::Listing::Type	type;
+
+			bool isFile() const
+			{
+				return type == Folder_Internal::Listing::FileEntry;
+			}
+
+			bool isFolder() const
+			{
+				return type == Folder_Internal::Listing::FolderEntry;
+			}
+
+			bool isLink() const
+			{
+				return type == Folder_Internal::Listing::LinkEntry;
+			}
+
+			FilePath filePath() const
+			{
+				return path;
+			}
+		};
+
+		typedef std::function<bool(const Entry&)> Predicate;
+
+		/**
+		 * @param root: the folder to walk through, its entries are of depth 1
+		 */
+		explicit FolderWalker(const FilePath& root)
+			: root(root.toText()),
+			maxDepth((size_t)-1),
+			followLinks(false),
+			started(false)
+		{
+		}
+
+		/**
+		 * @brief choose the entries to give, all by default
+		 */
+		void setFilter(Predicate predicate)
+		{
+			filter = std::move(predicate);
+		}
+
+		/**
+		 * @brief choose the folders to walk into, all by default, a folder not walked into can still be given
+		 */
+		void setFolderFilter(Predicate predicate)
+		{
+			folderFilter = std::move(predicate);
+		}
+
+		/**
+		 * @brief set the largest depth of the entries, 1 gives only the entries of the root
+		 */
+		void setMaxDepth(size_t depth)
+		{
+			MOE_ERROR(depth > 0, "FolderWalker::setMaxDepth(size_t depth): Argument depth out of range.");
+			maxDepth = depth;
+		}
+
+		/**
+		 * @brief give the links the type of their targets and walk into the links to folders
+		 */
+		void setFollowLinks(bool follow)
+		{
+			followLinks = follow;
+		}
+
+		/**
+		 * @brief get the next entry
+		 * @return false when all the entries have been given
+		 */
+		bool next(Entry& entry)
+		{
+			if (!started)
+			{
+				started = true;
+				std::unique_ptr<Folder_Internal::Listing> listing(new Folder_Internal::Listing());
+				if (listing->open(root))
+					stack.push_back(std::move(listing));
+			}
+
+			while (!stack.empty())
+			{
+				Folder_Internal::Listing& listing = *stack.back();
+				if (!listing.next(followLinks))
+				{
+					stack.pop_back();
+					continue;
+				}
+
+				const size_t depth = stack.size();
+				fill(listing, depth, entry);
+				if (entry.isFolder() && depth < maxDepth && (!folderFilter || folderFilter(entry)))
+				{
+					std::unique_ptr<Folder_Internal::Listing> child(new Folder_Internal::Listing());
+					if (child->open(listing, followLinks))
+						stack.push_back(std::move(child));
+				}
+				if (!filter || filter(entry))
+					return true;
+			}
+			return false;
+		}
+
+		/**
+		 * @brief start again from the root
+		 */
+		void reset()
+		{
+			stack.clear();
+			started = false;
+		}
+
+		/**
+		 * @brief call a function on every entry, from the root whatever next() has given
+		 * @param f: called as f(entry), from several threads at once when a pool is given
+		 * @param pool: the pool to read the folders on, they are read on the calling thread if it is null
+		 * @detail with a pool the folders are read at once by the workers and the calling thread,
+		 * so the entries are not given in order, and a sub folder is opened by its path. The
+		 * predicates are also called from several threads. An exception thrown by f stops the
+		 * walk and is thrown again.
+		 */
+		template<typename F>
+		void forEach(F f, ThreadPool* pool = nullptr)
+		{
+			if (pool == nullptr)
+			{
+				reset();
+				Entry entry;
+				while (next(entry))
+					f(entry);
+				reset();
+				return;
+			}
+
+			std::deque<std::pair<Text, size_t>> folders;
+			std::mutex mutex;
+			std::condition_variable condition;
+			size_t active = 0;
+			std::exception_ptr error;
+			folders.push_back(std::make_pair(root, (size_t)0));
+
+			auto work = [&]()
+			{
+				for (;;)
+				{
+					std::pair<Text, size_t> folder;
+					{
+						std::unique_lock<std::mutex> lock(mutex);
+						condition.wait(lock, [&] { return !folders.empty() || active == 0; });
+						if (folders.empty())
+							return;
+						folder = std::move(folders.front());
+						folders.pop_front();
+						active++;
+					}
+
+					std::vector<std::pair<Text, size_t>> found;
+					try
+					{
+						walkFolder(folder.first, folder.second + 1, f, found);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						if (!error)
+							error = std::current_exception();
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						if (!error)
+						{
+							for (auto& child : found)
+								folders.push_back(std::move(child));
+						}
+						else
+							folders.clear();
+						active--;
+					}
+					condition.notify_all();
+				}
+			};
+
+			// the workers take folders from the shared queue and never add tasks to the pool, so a full pool can not block them
+			const size_t workers = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1;
+			std::vector<std::future<void>> results;
+			results.reserve(workers);
+			try
+			{
+				for (size_t i = 0; i < workers; i++)
+					results.push_back(pool->add(work));
+			}
+			catch (...)
+			{
+				// the queued workers use this frame, they are stopped and waited for first
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					if (!error)
+						error = std::current_exception();
+					folders.clear();
+				}
+				condition.notify_all();
+				for (auto& result : results)
+				{
+					if (result.valid())
+						result.wait();
+				}
+				throw;
+			}
+			work();
+			for (auto& result : results)
+				result.wait();
+			if (error)
+				std::rethrow_exception(error);
+		}
+
+		/**
+		 * @brief make a predicate that matches the names of the entries with a pattern, see match()
+		 */
+		static Predicate glob(const Text& pattern)
+		{
+			// the units are copied once, so the predicate reads them from several threads without touching a shared Text
+			const TextView view = pattern.view();
+			std::shared_ptr<std::vector<muint16>> units(new std::vector<muint16>(view.data(), view.data() + view.length()));
+			return [units](const Entry& entry)
+			{
+				const TextView name = entry.name.view();
+				return match(units->data(), units->data() + units->size(), name.data(), name.data() + name.length());
+			};
+		}
+
+		/**
+		 * @brief match a name with a pattern
+		 * @detail '*' matches any characters, '?' one character, "[abc]" and "[a-z]" one of the
+		 * characters and "[!abc]" one character that is not one of them.
+		 */
+		static bool match(const Text& pattern, const Text& name)
+		{
+			const TextView p = pattern.view();
+			const TextView n = name.view();
+			return match(p.data(), p.data() + p.length(), n.data(), n.data() + n.length());
+		}
+
+	private:
+		Text											root;
+		Predicate										filter;
+		Predicate										folderFilter;
+		size_t											maxDepth;
+		bool											followLinks;
+		bool											started;
+		std::vector<std::unique_ptr<Folder_Internal::Listing>>	stack;
+
+		static bool match(const muint16* p, const muint16* pEnd, const muint16* n, const muint16* nEnd)
+		{
+			const muint16* starP = 0;
+			const muint16* starN = 0;
+
+			while (n < nEnd)
+			{
+				if (p < pEnd && *p == L'*')
+				{
+					starP = ++p;
+					starN = n;
+					continue;
+				}
+				const muint16* after = p < pEnd ? matchOne(p, pEnd, *n) : 0;
+				if (after)
+				{
+					p = after;
+					n++;
+				}
+				else if (starP)
+				{
+					// let the last star take one more character
+					p = starP;
+					n = ++starN;
+				}
+				else
+					return false;
+			}
+			while (p < pEnd && *p == L'*')
+				p++;
+			return p == pEnd;
+		}
+
+		static void fill(const Folder_Internal::Listing& listing, size_t depth, Entry& entry)
+		{
+			entry.name = listing.name();
+			entry.path = listing.entryPath();
+			entry.depth = depth;
+			entry.type = listing.type();
+		}
+
+		/**
+		 * @brief match one character with the pattern at p
+		 * @return the rest of the pattern, or null if the character does not match
+		 */
+		static const muint16* matchOne(const muint16* p, const muint16* pEnd, muint16 c)
+		{
+			if (*p == L'?')
+				return p + 1;
+			if (*p != L'[')
+				return *p == c ? p + 1 : 0;
+
+			const muint16* q = p + 1;
+			bool negate = q < pEnd && *q == L'!';
+			if (negate)
+				q++;
+			bool found = false;
+			const muint16* first = q;
+			while (q < pEnd && (*q != L']' || q == first))
+			{
+				if (q + 2 < pEnd && q[1] == L'-' && q[2] != L']')
+				{
+					found |= q[0] <= c && c <= q[2];
+					q += 3;
+				}
+				else
+					found |= *q++ == c;
+			}
+			// an unclosed bracket is an ordinary character
+			if (q == pEnd)
+				return c == L'[' ? p + 1 : 0;
+			return found != negate ? q + 1 : 0;
+		}
+
+		template<typename F>
+		void walkFolder(const Text& path, size_t depth, F& f, std::vector<std::pair<Text, size_t>>& found)
+		{
+			Folder_Internal::Listing listing;
+			if (!listing.open(path))
+				return;
+
+			Entry entry;
+			while (listing.next(followLinks))
+			{
+				fill(listing, depth, entry);
+				if (entry.isFolder() && depth < maxDepth && (!folderFilter || folderFilter(entry)))
+					found.push_back(std::make_pair(entry.path, depth));
+				if (!filter || filter(entry))
+					f(entry);
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,564 @@
+#ifndef MoeLP_Base_LineIndex
+#define MoeLP_Base_LineIndex
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "../Text/Text.hpp"
+#include "../Text/CodeConvert.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "FileSystem.hpp"
+#include "FileStream.hpp"
+#include "MappedFile.hpp"
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <future>
+#include <thread>
+
+#if defined MOE_MSVC
+#include <windows.h>
+#elif defined MOE_GCC
+#include <sys/stat.h>
+#endif
+
+namespace MoeLP
+{
+	namespace LineIndex_Internal
+	{
+		/**
+		 * @brief the header of a stored index, followed by the offsets and the positions of the
+		 * blocks and the compressed deltas
+		 */
+		struct Header
+		{
+			char	magic[8];
+			muint64	fileSize;
+			mint64	modified;
+			muint64	count;
+			muint64	deltaBytes;
+			muint32	charset;
+			muint32	bomSize;
+		};
+
+		static const char magic[8] = { 'M', 'o', 'e', 'L', 'I', 'd', 'x', '1' };
+
+		/**
+		 * @brief get the size and the last modification time of a file
+		 * @return false if it is not a file
+		 */
+		inline bool fileStamp(const FilePath& filePath, muint64& size, mint64& modified)
+		{
+			#if defined MOE_MSVC
+			WIN32_FILE_ATTRIBUTE_DATA info;
+			if (!GetFileAttributesExW(filePath.toText().c_str(), GetFileExInfoStandard, &info))
+				return false;
+			if (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+				return false;
+			size = ((muint64)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+			modified = (mint64)(((muint64)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime);
+			return true;
+			#elif defined MOE_GCC
+			Text fullPath = filePath.toText();
+			struct stat info;
+			mint len = wtoa(fullPath.c_str(), 0, 0);
+			char* buffer = (char*)cpuAllocate(sizeof(char)*len);
+			memset(buffer, 0, len * sizeof(*buffer));
+			wtoa(fullPath.c_str(), buffer, (int)len);
+			int result = stat(buffer, &info);
+			cpuDeallocate(buffer, sizeof(char)*len);
+			if (result != 0 || !S_ISREG(info.st_mode))
+				return false;
+			size = (muint64)info.st_size;
+			modified = (mint64)info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec;
+			return true;
+			#endif
+		}
+
+		inline muint64 readVarint(const muint8*& p)
+		{
+			muint64 value = 0;
+			for (mint shift = 0; ; shift += 7)
+			{
+				muint8 byte = *p++;
+				value |= (muint64)(byte & 0x7F) << shift;
+				if (byte < 0x80)
+					return value;
+			}
+		}
+
+		/**
+		 * @brief read a variable length number of a stored index
+		 * @return false if it runs past end or does not fit in 64 bits
+		 */
+		inline bool readVarint(const muint8*& p, const muint8* end, muint64& value)
+		{
+			value = 0;
+			for (mint shift = 0; shift < 64 && p < end; shift += 7)
+			{
+				muint8 byte = *p++;
+				if (shift == 63 && byte > 1)
+					return false;
+				value |= (muint64)(byte & 0x7F) << shift;
+				if (byte < 0x80)
+					return true;
+			}
+			return false;
+		}
+	}
+
+	/**
+	 * @brief the start of every line of a text file, for reading any line at once
+	 * @example:
+	 * LineIndex corpus;
+	 * corpus.open(L"corpus.txt", File::utf8, &pool);	// built once, then loaded from corpus.txt.lidx
+	 * for (size_t i : shuffled) train(corpus.getLine(i));
+	 * @detail the lines are cut as by LineReader. The offset of the first line of every block
+	 * of blockLines lines is kept as is, the others as the difference with the line before in
+	 * a variable length encoding of 7 bits a byte, so an index costs about one or two bytes a
+	 * line and a line is found by decoding less than blockLines differences. The index is
+	 * built in one pass over a mapping of the file, by chunks on a thread pool, and stored
+	 * next to the file with its size and its modification time: it is built again only when
+	 * one of them changes. getLine() reads the line with a positional read and can be called
+	 * from several threads at once.
+	 */
+	class LineIndex
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(LineIndex)
+
+	public:
+		static const size_t blockLines = 64;
+		static const size_t defaultChunkSize = 16 << 20;
+
+		LineIndex()
+			: fileCharset(File::withBom),
+			lineCount(0),
+			bomSize(0),
+			fileSize(0),
+			modified(0)
+		{
+		}
+
+		/**
+		 * @brief open a file with its index, the index is built and stored when it is missing or the file has changed
+		 * @param charset: the charset, File::withBom finds it as File does
+		 * @param pool: the pool to build the index on, it is built on the calling thread if it is null
+		 * @param indexPath: the index file, the name of the file followed by ".lidx" if it is empty
+		 * @return false if the file can not be read, an index that can not be stored is kept in memory
+		 */
+		bool open(const FilePath& filePath, File::Charset charset = File::withBom, ThreadPool* pool = nullptr, const FilePath& indexPath = FilePath())
+		{
+			close();
+			const Text indexName = indexPath.toText().length() > 0 ? indexPath.toText() : filePath.toText() + L".lidx";
+
+			muint64 size;
+			mint64 time;
+			if (!LineIndex_Internal::fileStamp(filePath, size, time))
+				return false;
+			if (!load(indexName) || fileSize != size || modified != time
+				|| (charset != File::withBom && charset != fileCharset))
+			{
+				if (!build(filePath, charset, pool))
+				{
+					close();
+					return false;
+				}
+				modified = time;
+				store(indexName);
+			}
+
+			stream.reset(new FileStream(filePath.toText(), FileStream::ReadOnly));
+			if (!stream->available())
+			{
+				close();
+				return false;
+			}
+			return true;
+		}
+
+		void close()
+		{
+			stream.reset();
+			blockOffsets.clear();
+			blockPositions.clear();
+			deltas.clear();
+			fileCharset = File::withBom;
+			lineCount = 0;
+			bomSize = 0;
+			fileSize = 0;
+			modified = 0;
+		}
+
+		bool isOpen() const
+		{
+			return stream != nullptr;
+		}
+
+		/**
+		 * @brief return the number of lines
+		 */
+		size_t count() const
+		{
+			return lineCount;
+		}
+
+		/**
+		 * @brief return the charset of the file, File::withBom is replaced by the charset found
+		 */
+		File::Charset charset() const
+		{
+			return fileCharset;
+		}
+
+		/**
+		 * @brief return the position in bytes of the start of a line
+		 */
+		mint64 offset(size_t index) const
+		{
+			MOE_ERROR(index < lineCount, "LineIndex::offset(size_t index): Argument index out of range.");
+			muint64 begin, end;
+			range(index, begin, end);
+			return (mint64)begin;
+		}
+
+		/**
+		 * @brief read a line without its line break
+		 */
+		Text getLine(size_t index) const
+		{
+			MOE_ERROR(isOpen(), "LineIndex::getLine(size_t index): The index is not open.");
+			MOE_ERROR(index < lineCount, "LineIndex::getLine(size_t index): Argument index out of range.");
+			muint64 begin, end;
+			range(index, begin, end);
+			const size_t capacity = (size_t)(end - begin);
+			if (capacity == 0)
+				return Text();
+
+			char* bytes = (char*)cpuAllocate(sizeof(char) * capacity);
+			mint read = stream->readAt((mint64)begin, bytes, (mint)capacity);
+			size_t length = read > 0 ? (size_t)read : 0;
+
+			const muint16* units = (const muint16*)bytes;
+			Text line;
+			switch (fileCharset)
+			{
+			case File::utf16:
+				length /= 2;
+				if (length > 0 && units[length - 1] == L'\n')
+					length--;
+				if (length > 0 && units[length - 1] == L'\r')
+					length--;
+				line = Text(units, length);
+				break;
+			case File::utf16be:
+				length /= 2;
+				if (length > 0 && units[length - 1] == 0x0A00)
+					length--;
+				if (length > 0 && units[length - 1] == 0x0D00)
+					length--;
+				swapBytes16(units, length, (muint16*)bytes);
+				line = Text(units, length);
+				break;
+			default:
+				if (length > 0 && bytes[length - 1] == '\n')
+					length--;
+				if (length > 0 && bytes[length - 1] == '\r')
+					length--;
+				if (fileCharset == File::utf8)
+					line = Text::fromUTF8(bytes, length);
+				else if (fileCharset == File::gb18030)
+					line = Text::fromGB18030(bytes, length);
+				else
+					line = Text::fromLocal(std::string(bytes, length).c_str());
+				break;
+			}
+			cpuDeallocate(bytes, sizeof(char) * capacity);
+			return line;
+		}
+
+		/**
+		 * @brief write the index into a file which is loaded by open()
+		 * @return false if the file can not be written
+		 */
+		bool store(const Text& indexName) const
+		{
+			FileStream fs(indexName, FileStream::WriteOnly);
+			if (!fs.writable())
+				return false;
+
+			LineIndex_Internal::Header header;
+			memcpy(header.magic, LineIndex_Internal::magic, sizeof(header.magic));
+			header.fileSize = fileSize;
+			header.modified = modified;
+			header.count = lineCount;
+			header.deltaBytes = deltas.size();
+			header.charset = (muint32)fileCharset;
+			header.bomSize = bomSize;
+
+			return write(fs, &header, sizeof(header))
+				&& write(fs, blockOffsets.data(), sizeof(muint64) * blockOffsets.size())
+				&& write(fs, blockPositions.data(), sizeof(muint64) * blockPositions.size())
+				&& write(fs, deltas.data(), deltas.size());
+		}
+
+		/**
+		 * @brief return the number of bytes used by the index in memory
+		 */
+		size_t memoryUsage() const
+		{
+			return blockOffsets.capacity() * sizeof(muint64) + blockPositions.capacity() * sizeof(muint64) + deltas.capacity();
+		}
+
+	private:
+		std::vector<muint64>			blockOffsets;
+		std::vector<muint64>			blockPositions;
+		std::vector<muint8>				deltas;
+		File::Charset					fileCharset;
+		size_t							lineCount;
+		muint32							bomSize;
+		muint64							fileSize;
+		mint64							modified;
+		std::unique_ptr<FileStream>		stream;
+
+		/**
+		 * @brief find the bytes of a line, with its line break
+		 */
+		void range(size_t index, muint64& begin, muint64& end) const
+		{
+			const size_t block = index / blockLines;
+			const muint8* p = deltas.data() + blockPositions[block];
+			muint64 offset = blockOffsets[block];
+			for (size_t i = index % blockLines; i > 0; i--)
+				offset += LineIndex_Internal::readVarint(p);
+
+			begin = offset;
+			if (index + 1 == lineCount)
+				end = fileSize;
+			else if ((index + 1) % blockLines == 0)
+				end = blockOffsets[block + 1];
+			else
+				end = offset + LineIndex_Internal::readVarint(p);
+		}
+
+		void append(muint64 start, muint64& previous)
+		{
+			if (lineCount % blockLines == 0)
+			{
+				blockOffsets.push_back(start);
+				blockPositions.push_back(deltas.size());
+			}
+			else
+			{
+				muint64 delta = start - previous;
+				while (delta >= 0x80)
+				{
+					deltas.push_back((muint8)(delta | 0x80));
+					delta >>= 7;
+				}
+				deltas.push_back((muint8)delta);
+			}
+			previous = start;
+			lineCount++;
+		}
+
+		/**
+		 * @brief find the starts of the lines after the line breaks in [begin, end)
+		 */
+		static std::vector<muint64> scan(const char* p, size_t size, size_t bom, File::Charset charset, size_t begin, size_t end)
+		{
+			std::vector<muint64> starts;
+			size_t from = begin;
+			while (from < end)
+			{
+				const char* found = (const char*)memchr(p + from, '\n', end - from);
+				if (found == 0)
+					break;
+				size_t at = found - p;
+				size_t next = 0;
+				switch (charset)
+				{
+				case File::utf16:
+					if ((at - bom) % 2 == 0 && at + 1 < size && p[at + 1] == 0)
+						next = at + 2;
+					break;
+				case File::utf16be:
+					if ((at - bom) % 2 == 1 && p[at - 1] == 0)
+						next = at + 1;
+					break;
+				default:
+					next = at + 1;
+					break;
+				}
+				// a final line break does not begin an empty line
+				if (next != 0 && next < size)
+					starts.push_back(next);
+				from = at + 1;
+			}
+			return starts;
+		}
+
+		bool build(const FilePath& filePath, File::Charset charset, ThreadPool* pool)
+		{
+			MappedFile file;
+			if (!file.open(filePath.toText(), MappedFile::Sequential))
+				return false;
+
+			const char* p = file.data();
+			const size_t size = file.length();
+			muint8 bom[3] = { 0 };
+			if (size > 0)
+				memcpy(bom, p, size < 3 ? size : 3);
+			blockOffsets.clear();
+			blockPositions.clear();
+			deltas.clear();
+			lineCount = 0;
+			fileCharset = charset;
+			bomSize = (muint32)File::detectBom(bom, fileCharset);
+			fileSize = size;
+
+			muint64 previous = 0;
+			if (size > bomSize)
+				append(bomSize, previous);
+
+			const File::Charset scanCharset = fileCharset;
+			const size_t first = bomSize;
+			if (pool == nullptr)
+			{
+				for (size_t offset = first; offset < size; offset += defaultChunkSize)
+				{
+					size_t end = size - offset <= defaultChunkSize ? size : offset + defaultChunkSize;
+					for (muint64 start : scan(p, size, first, scanCharset, offset, end))
+						append(start, previous);
+				}
+				return true;
+			}
+
+			// the chunks are scanned on the pool and their starts appended in order, a few at a time
+			const size_t window = 2 * (std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1);
+			std::deque<std::future<std::vector<muint64>>> results;
+			size_t offset = first;
+			try
+			{
+				while (offset < size || !results.empty())
+				{
+					for (; offset < size && results.size() < window; )
+					{
+						size_t end = size - offset <= defaultChunkSize ? size : offset + defaultChunkSize;
+						results.push_back(pool->add([p, size, first, scanCharset, offset, end]()
+						{
+							return scan(p, size, first, scanCharset, offset, end);
+						}));
+						offset = end;
+					}
+					std::vector<muint64> starts = results.front().get();
+					results.pop_front();
+					for (muint64 start : starts)
+						append(start, previous);
+				}
+			}
+			catch (...)
+			{
+				for (auto& result : results)
+				{
+					if (result.valid())
+						result.wait();
+				}
+				throw;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief read an index written by store()
+		 * @return false if the file can not be read or is not a stored index
+		 */
+		bool load(const Text& indexName)
+		{
+			FileStream fs(indexName, FileStream::ReadOnly);
+			if (!fs.readable())
+				return false;
+
+			LineIndex_Internal::Header header;
+			const mint64 length = fs.size();
+			if (length < (mint64)sizeof(header) || fs.read(&header, sizeof(header)) != sizeof(header))
+				return false;
+			if (memcmp(header.magic, LineIndex_Internal::magic, sizeof(header.magic)) != 0
+				|| header.charset > File::gb18030 || header.charset == File::withBom
+				|| header.count > (muint64)length * 8)
+				return false;
+
+			const muint64 blocks = (header.count + blockLines - 1) / blockLines;
+			if (sizeof(header) + blocks * 2 * sizeof(muint64) + header.deltaBytes != (muint64)length)
+				return false;
+
+			std::vector<muint64> offsets((size_t)blocks);
+			std::vector<muint64> positions((size_t)blocks);
+			std::vector<muint8> bytes((size_t)header.deltaBytes);
+			if (!read(fs, offsets.data(), sizeof(muint64) * offsets.size())
+				|| !read(fs, positions.data(), sizeof(muint64) * positions.size())
+				|| !read(fs, bytes.data(), bytes.size()))
+				return false;
+			if (!check(header, offsets, positions, bytes))
+				return false;
+
+			blockOffsets.swap(offsets);
+			blockPositions.swap(positions);
+			deltas.swap(bytes);
+			fileCharset = (File::Charset)header.charset;
+			lineCount = (size_t)header.count;
+			bomSize = header.bomSize;
+			fileSize = header.fileSize;
+			modified = header.modified;
+			return true;
+		}
+
+		/**
+		 * @brief decode every block of a stored index once
+		 * @return false unless the blocks follow each other in the deltas and the starts of the
+		 * lines never decrease nor pass the end of the file, so range() reads no further
+		 */
+		static bool check(const LineIndex_Internal::Header& header, const std::vector<muint64>& offsets, const std::vector<muint64>& positions, const std::vector<muint8>& bytes)
+		{
+			if (header.bomSize > header.fileSize)
+				return false;
+			const muint8* p = bytes.data();
+			const muint8* end = p + bytes.size();
+			muint64 previous = header.bomSize;
+			for (size_t block = 0; block < offsets.size(); block++)
+			{
+				if (positions[block] != (muint64)(p - bytes.data()))
+					return false;
+				muint64 offset = offsets[block];
+				if (offset < previous || offset > header.fileSize)
+					return false;
+				const muint64 lines = header.count - block * blockLines < blockLines ? header.count - block * blockLines : blockLines;
+				for (muint64 i = 1; i < lines; i++)
+				{
+					muint64 delta;
+					if (!LineIndex_Internal::readVarint(p, end, delta) || delta > header.fileSize - offset)
+						return false;
+					offset += delta;
+				}
+				previous = offset;
+			}
+			return p == end;
+		}
+
+		static bool write(FileStream& fs, const void* buffer, size_t size)
+		{
+			if (size == 0)
+				return true;
+			return (size_t)fs.write((void*)buffer, (mint)size) == size;
+		}
+
+		static bool read(FileStream& fs, void* buffer, size_t size)
+		{
+			if (size == 0)
+				return true;
+			return (size_t)fs.read(buffer, (mint)size) == size;
+		}
+	};
+}
+
+#endif
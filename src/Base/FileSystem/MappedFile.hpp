@@ -0,0 +1,322 @@
+#ifndef MoeLP_Base_MappedFile
+#define MoeLP_Base_MappedFile
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "../Text/Text.hpp"
+#include "../Text/TextView.hpp"
+#include "../Text/Utf8View.hpp"
+
+#include <utility>
+
+#if defined MOE_MSVC
+#include <windows.h>
+#elif defined MOE_GCC
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace MoeLP
+{
+	/**
+	 * @brief a file mapped into memory for reading
+	 * @example:
+	 * MappedFile file(L"corpus.txt");
+	 * for (Utf8View line : file.utf8().lines()) {...}
+	 * @detail the pages are read by the operating system when they are first touched, and
+	 * the content is never copied: the views point into the mapping and are valid until
+	 * the file is closed. The access hints tell the kernel how the file will be read.
+	 */
+	class MappedFile
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(MappedFile)
+
+	public:
+		/**
+		 * @brief the access hints, they can be combined
+		 * @detail Sequential reads ahead aggressively and drops the pages behind, Random turns
+		 * the read ahead off, WillNeed starts reading the whole file at once and HugePages asks
+		 * for transparent huge pages where the file system supports them. The hints are only
+		 * advice and are ignored where the system does not have them.
+		 */
+		enum Advice
+		{
+			Normal		= 0,
+			Sequential	= 1,
+			Random		= 2,
+			WillNeed	= 4,
+			HugePages	= 8
+		};
+
+		/**
+		 * @brief the byte order mark at the begin of the file
+		 */
+		enum Bom
+		{
+			NoBom,
+			Utf8Bom,
+			Utf16Bom,
+			Utf16beBom
+		};
+
+		MappedFile()
+			: address(0),
+			size(0)
+			#if defined MOE_MSVC
+			, file(INVALID_HANDLE_VALUE),
+			mapping(0)
+			#endif
+		{
+		}
+
+		explicit MappedFile(const Text& fileName, muint32 advice = Sequential)
+			: MappedFile()
+		{
+			open(fileName, advice);
+		}
+
+		MappedFile(MappedFile&& mappedFile)
+			: MappedFile()
+		{
+			swap(mappedFile);
+		}
+
+		MappedFile& operator=(MappedFile&& mappedFile)
+		{
+			if (this != &mappedFile)
+			{
+				close();
+				swap(mappedFile);
+			}
+			return *this;
+		}
+
+		~MappedFile()
+		{
+			close();
+		}
+
+		/**
+		 * @brief map a file, an empty file is opened with no content
+		 * @param advice: the access hints, see Advice
+		 * @return false if the file can not be opened or mapped
+		 */
+		bool open(const Text& fileName, muint32 advice = Sequential)
+		{
+			close();
+
+			#if defined MOE_MSVC
+			file = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+				(advice & Sequential) ? FILE_FLAG_SEQUENTIAL_SCAN : (advice & Random) ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL, 0);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER length;
+			if (!GetFileSizeEx(file, &length))
+			{
+				close();
+				return false;
+			}
+			if (length.QuadPart == 0)
+				return true;
+			mapping = CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+			if (mapping == 0)
+			{
+				close();
+				return false;
+			}
+			address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (address == 0)
+			{
+				close();
+				return false;
+			}
+			size = (size_t)length.QuadPart;
+			#elif defined MOE_GCC
+			mint len = wtoa(fileName.c_str(), 0, 0);
+			char* buffer = (char*)cpuAllocate(sizeof(char)*len);
+			memset(buffer, 0, len * sizeof(*buffer));
+			wtoa(fileName.c_str(), buffer, (int)len);
+			int fd = ::open(buffer, O_RDONLY);
+			cpuDeallocate(buffer, sizeof(char)*len);
+			if (fd < 0)
+				return false;
+
+			struct stat info;
+			if (fstat(fd, &info) != 0)
+			{
+				::close(fd);
+				return false;
+			}
+			if (info.st_size == 0)
+			{
+				::close(fd);
+				opened = true;
+				return true;
+			}
+			void* p = mmap(0, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			::close(fd);
+			if (p == MAP_FAILED)
+				return false;
+			address = p;
+			size = (size_t)info.st_size;
+			opened = true;
+			advise(advice);
+			#endif
+			return true;
+		}
+
+		void close()
+		{
+			#if defined MOE_MSVC
+			if (address)
+				UnmapViewOfFile(address);
+			if (mapping)
+				CloseHandle(mapping);
+			if (file != INVALID_HANDLE_VALUE)
+				CloseHandle(file);
+			mapping = 0;
+			file = INVALID_HANDLE_VALUE;
+			#elif defined MOE_GCC
+			if (address)
+				munmap(address, size);
+			opened = false;
+			#endif
+			address = 0;
+			size = 0;
+		}
+
+		void swap(MappedFile& mappedFile)
+		{
+			std::swap(address, mappedFile.address);
+			std::swap(size, mappedFile.size);
+			#if defined MOE_MSVC
+			std::swap(file, mappedFile.file);
+			std::swap(mapping, mappedFile.mapping);
+			#elif defined MOE_GCC
+			std::swap(opened, mappedFile.opened);
+			#endif
+		}
+
+		bool isOpen() const
+		{
+			#if defined MOE_MSVC
+			return file != INVALID_HANDLE_VALUE;
+			#elif defined MOE_GCC
+			return opened;
+			#endif
+		}
+
+		/**
+		 * @brief give new access hints for a part of the file
+		 * @param advice: the access hints, see Advice
+		 * @param offset: the begin of the part in bytes
+		 * @param length: the number of bytes, the part ends at the end of the file if it is too long
+		 */
+		void advise(muint32 advice, size_t offset = 0, size_t length = (size_t)-1)
+		{
+			if (address == 0 || offset >= size)
+				return;
+			if (length > size - offset)
+				length = size - offset;
+
+			#if defined MOE_GCC
+			// madvise needs an address aligned to a page
+			const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+			size_t begin = offset / page * page;
+			char* p = (char*)address + begin;
+			length += offset - begin;
+			if (advice & Sequential)
+				madvise(p, length, MADV_SEQUENTIAL);
+			if (advice & Random)
+				madvise(p, length, MADV_RANDOM);
+			if (advice & WillNeed)
+				madvise(p, length, MADV_WILLNEED);
+			#if defined MADV_HUGEPAGE
+			if (advice & HugePages)
+				madvise(p, length, MADV_HUGEPAGE);
+			#endif
+			#endif
+		}
+
+		/**
+		 * @brief return the content, or null for an empty file
+		 */
+		const char* data() const
+		{
+			return (const char*)address;
+		}
+
+		/**
+		 * @brief return the number of bytes
+		 */
+		size_t length() const
+		{
+			return size;
+		}
+
+		bool empty() const
+		{
+			return size == 0;
+		}
+
+		const char* begin() const
+		{
+			return data();
+		}
+
+		const char* end() const
+		{
+			return data() + size;
+		}
+
+		Bom bom() const
+		{
+			const muint8* p = (const muint8*)address;
+			if (size >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+				return Utf8Bom;
+			if (size >= 2 && p[0] == 0xFF && p[1] == 0xFE)
+				return Utf16Bom;
+			if (size >= 2 && p[0] == 0xFE && p[1] == 0xFF)
+				return Utf16beBom;
+			return NoBom;
+		}
+
+		/**
+		 * @brief view the bytes after an utf-8 bom, or all the bytes if there is none
+		 */
+		Utf8View utf8() const
+		{
+			size_t skip = bom() == Utf8Bom ? 3 : 0;
+			return Utf8View(data() + skip, size - skip);
+		}
+
+		/**
+		 * @brief view the code units of an utf-16 little endian file after its bom
+		 * @detail a file with an utf-16 big endian bom can not be viewed without swapping
+		 * its bytes, MOE_ERROR is raised for it. A last odd byte is left out.
+		 */
+		TextView utf16() const
+		{
+			Bom b = bom();
+			MOE_ERROR(b != Utf16beBom, "MappedFile::utf16(): The file is big endian.");
+			size_t skip = b == Utf16Bom ? 2 : 0;
+			if (size <= skip)
+				return TextView();
+			return TextView((const muint16*)(data() + skip), (size - skip) / sizeof(muint16));
+		}
+
+	private:
+		void*	address;
+		size_t	size;
+		#if defined MOE_MSVC
+		HANDLE	file;
+		HANDLE	mapping;
+		#elif defined MOE_GCC
+		bool	opened = false;
+		#endif
+	};
+}
+
+#endif
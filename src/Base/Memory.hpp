@@ -71,6 +71,7 @@ namespace MoeLP
 				allocator(new CpuAllocator()),
 				headBlock(nullptr),
 				headFreeNode(nullptr),
+				emptyBlocks(0),
 				shiftTable((mint*)allocator->allocate(nodesPerBlock * sizeof(mint))),
 				recycledBytes(0)
 			{
@@ -87,12 +88,14 @@ namespace MoeLP
 
 			void* allocate() throw (std::bad_alloc)
 			{
+				std::lock_guard<std::mutex> locker(mutex_);
 				if (!headFreeNode)
 				{
 					Block* newBlock = reinterpret_cast<Block*>(allocator->allocate(blockSize));
+					newBlock->freeNodeCount = nodesPerBlock;
+					emptyBlocks++;
 					if (!headBlock)
 					{
-						newBlock->freeNodeCount = nodesPerBlock;
 						newBlock->next = nullptr;
 						newBlock->prior = nullptr;
 						headBlock = newBlock;
@@ -137,12 +140,14 @@ namespace MoeLP
 					tailFreeNode->next = nullptr;
 				}
 
-				byteShift<Block>(returnNode, shiftTable[returnNode->bias])->freeNodeCount--;
+				if (byteShift<Block>(returnNode, shiftTable[returnNode->bias])->freeNodeCount-- == nodesPerBlock)
+					emptyBlocks--;
 				return byteShift<void*>(returnNode, freeNodeOffset);
 			}
 
 			void deallocate(void* ptr)
 			{
+				std::lock_guard<std::mutex> locker(mutex_);
 				FreeNode* node = byteShift<FreeNode>(ptr, -1 * freeNodeOffset);
 
 				if (!headFreeNode)
@@ -163,6 +168,14 @@ namespace MoeLP
 				Block* belongBlock = byteShift<Block>(node, shiftTable[node->bias]);
 				if (++belongBlock->freeNodeCount == nodesPerBlock)
 				{
+					// one empty block is kept, so a pool used around the size of a block does not
+					// build and tear down a block on every call
+					if (emptyBlocks == 0)
+					{
+						emptyBlocks++;
+						return;
+					}
+
 					if (belongBlock == headBlock)
 					{
 						if (belongBlock->next == nullptr)
@@ -225,15 +238,10 @@ namespace MoeLP
 				}
 			}
 
-			size_t getRecycledBytes() const
-			{
-				return recycledBytes;
-			}
-
-			inline ObjectPool* instance()
+			size_t getRecycledBytes()
 			{
 				std::lock_guard<std::mutex> locker(mutex_);
-				return this;
+				return recycledBytes;
 			}
 
 		private:
@@ -245,6 +253,7 @@ namespace MoeLP
 			Block*			tailBlock;
 			FreeNode*		headFreeNode;
 			FreeNode*		tailFreeNode;
+			mint			emptyBlocks;
 			mint*			shiftTable;
 			std::mutex		mutex_;
 			size_t			recycledBytes;
@@ -295,7 +304,7 @@ namespace MoeLP
 			else if (size > maxSize)
 				return allocator->allocate(size);
 			else
-				return pool[(size + sizeStep - 1) / sizeStep - 1].instance()->allocate();
+				return pool[(size + sizeStep - 1) / sizeStep - 1].allocate();
 		}
 
 		void deallocate(void* ptr, size_t size)
@@ -303,12 +312,12 @@ namespace MoeLP
 			if (size > maxSize)
 				allocator->deallocate(ptr);
 			else
-				pool[(size + sizeStep - 1) / sizeStep - 1].instance()->deallocate(ptr);
+				pool[(size + sizeStep - 1) / sizeStep - 1].deallocate(ptr);
 		}
 
 		size_t getRecycledBytes(size_t size)
 		{
-			return pool[(size + sizeStep - 1) / sizeStep - 1].instance()->getRecycledBytes();
+			return pool[(size + sizeStep - 1) / sizeStep - 1].getRecycledBytes();
 		}
 
 	private:
@@ -0,0 +1,204 @@
+#ifndef MoeLP_Base_BKTree
+#define MoeLP_Base_BKTree
+
+#include "../Base.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "Text.hpp"
+#include "TextView.hpp"
+#include "TextColumn.hpp"
+#include "EditDistance.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <future>
+
+namespace MoeLP
+{
+	/**
+	 * @brief a lexicon indexed for the nearest entries by edit distance
+	 * @example:
+	 * BKTree lexicon;
+	 * lexicon.add(L"北京");
+	 * ...
+	 * for (BKTree::Result r : lexicon.search(L"北京市", 1, 5))
+	 *     lexicon[r.index] ...
+	 * @detail a Burkhard-Keller tree: every child of an entry is labeled with its distance to
+	 * the entry, and the triangle inequality leaves out every subtree whose label is further
+	 * than the search radius from the distance of the query to the entry. The entries are kept
+	 * in a TextColumn and the distances are computed by EditDistancePattern.
+	 */
+	class BKTree
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(BKTree)
+
+	public:
+		struct Result
+		{
+			size_t	index;
+			size_t	distance;
+
+			bool operator<(const Result& result) const
+			{
+				return distance < result.distance || (distance == result.distance && index < result.index);
+			}
+		};
+
+		BKTree()
+		{
+		}
+
+		/**
+		 * @brief add an entry and return its index, an entry that is already there is not added again
+		 */
+		size_t add(const TextView& entry)
+		{
+			if (nodes.empty())
+				return append(entry, 0);
+
+			EditDistancePattern pattern(entry);
+			size_t node = 0;
+			for (;;)
+			{
+				size_t d = pattern.distance(entries[node]);
+				if (d == 0)
+					return node;
+
+				size_t child = nodes[node].firstChild;
+				while (child != none && nodes[child].label != d)
+					child = nodes[child].nextSibling;
+				if (child == none)
+				{
+					size_t index = append(entry, d);
+					nodes[index].nextSibling = nodes[node].firstChild;
+					nodes[node].firstChild = index;
+					if (d > nodes[node].maxLabel)
+						nodes[node].maxLabel = d;
+					return index;
+				}
+				node = child;
+			}
+		}
+
+		size_t add(const Text& entry)
+		{
+			return add(entry.view());
+		}
+
+		size_t size() const
+		{
+			return entries.size();
+		}
+
+		TextView operator[](size_t index) const
+		{
+			return entries[index];
+		}
+
+		/**
+		 * @brief return the nearest entries of a query, sorted by distance and then by index
+		 * @param query: the query
+		 * @param maxDistance: the largest edit distance of a result
+		 * @param count: the largest number of results
+		 */
+		std::vector<Result> search(const TextView& query, size_t maxDistance, size_t count = (size_t)-1) const
+		{
+			std::vector<Result> results;
+			if (nodes.empty() || count == 0)
+				return results;
+
+			EditDistancePattern pattern(query);
+			size_t radius = maxDistance;
+			std::vector<size_t> stack(1, 0);
+			while (!stack.empty())
+			{
+				size_t node = stack.back();
+				stack.pop_back();
+
+				// the subtrees only need the exact distance up to radius plus the largest label
+				size_t d = pattern.distance(entries[node], radius + nodes[node].maxLabel);
+				if (d <= radius)
+				{
+					Result result = { node, d };
+					results.push_back(result);
+					std::push_heap(results.begin(), results.end());
+					if (results.size() > count)
+					{
+						std::pop_heap(results.begin(), results.end());
+						results.pop_back();
+					}
+					if (results.size() == count)
+						radius = results.front().distance;
+				}
+
+				for (size_t child = nodes[node].firstChild; child != none; child = nodes[child].nextSibling)
+				{
+					size_t label = nodes[child].label;
+					if (label + radius >= d && label <= d + radius)
+						stack.push_back(child);
+				}
+			}
+
+			std::sort(results.begin(), results.end());
+			return results;
+		}
+
+		std::vector<Result> search(const Text& query, size_t maxDistance, size_t count = (size_t)-1) const
+		{
+			return search(query.view(), maxDistance, count);
+		}
+
+		/**
+		 * @brief search many queries, the i-th result is the result of the i-th query
+		 * @param pool: the pool to search on, the queries are searched on the calling thread if it is null
+		 */
+		std::vector<std::vector<Result>> search(const std::vector<TextView>& queries, size_t maxDistance, size_t count, ThreadPool* pool = nullptr) const
+		{
+			std::vector<std::vector<Result>> results(queries.size());
+			if (pool == nullptr)
+			{
+				for (size_t i = 0; i < queries.size(); i++)
+					results[i] = search(queries[i], maxDistance, count);
+				return results;
+			}
+
+			const size_t batch = 64;
+			std::vector<std::future<void>> tasks;
+			for (size_t begin = 0; begin < queries.size(); begin += batch)
+			{
+				size_t end = std::min(begin + batch, queries.size());
+				tasks.push_back(pool->add([this, &queries, &results, begin, end, maxDistance, count]()
+				{
+					for (size_t i = begin; i < end; i++)
+						results[i] = search(queries[i], maxDistance, count);
+				}));
+			}
+			for (size_t i = 0; i < tasks.size(); i++)
+				tasks[i].get();
+			return results;
+		}
+
+	private:
+		static const size_t none = (size_t)-1;
+
+		struct Node
+		{
+			size_t	label;			// the distance to the parent
+			size_t	maxLabel;		// the largest label of the children
+			size_t	firstChild;
+			size_t	nextSibling;
+		};
+
+		TextColumn			entries;
+		std::vector<Node>	nodes;
+
+		size_t append(const TextView& entry, size_t label)
+		{
+			Node node = { label, 0, none, none };
+			nodes.push_back(node);
+			entries.append(entry);
+			return nodes.size() - 1;
+		}
+	};
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #include "../Memory.hpp"
 #include "../Base.hpp"
+#include "../CpuDispatch.hpp"
+#include "Gb18030Data.hpp"
 
 #include <type_traits>
 
@@ -181,6 +183,92 @@ namespace MoeLP
 			}
 		}
 
+		/**
+		 * @brief decode one code point from well-formed utf-8
+		 * @return the number of bytes read, at least 1 when p < end
+		 * @detail an ill-formed sequence gives U+FFFD for its maximal valid prefix (at least
+		 * one byte), the same substitution as the WHATWG encoding standard.
+		 */
+		inline size_t decodeUtf8(const muint8* p, const muint8* end, muint32& codePoint)
+		{
+			muint8 b = p[0];
+			if (b < 0x80)
+			{
+				codePoint = b;
+				return 1;
+			}
+
+			size_t length;
+			muint8 lower = 0x80, upper = 0xBF;
+			if (b >= 0xC2 && b <= 0xDF)
+			{
+				codePoint = b & 0x1F;
+				length = 2;
+			}
+			else if (b >= 0xE0 && b <= 0xEF)
+			{
+				codePoint = b & 0x0F;
+				length = 3;
+				if (b == 0xE0) lower = 0xA0;		// overlong
+				if (b == 0xED) upper = 0x9F;		// surrogates
+			}
+			else if (b >= 0xF0 && b <= 0xF4)
+			{
+				codePoint = b & 0x07;
+				length = 4;
+				if (b == 0xF0) lower = 0x90;		// overlong
+				if (b == 0xF4) upper = 0x8F;		// above U+10FFFF
+			}
+			else
+			{
+				codePoint = 0xFFFD;
+				return 1;
+			}
+
+			for (size_t i = 1; i < length; i++)
+			{
+				if (p + i >= end || p[i] < lower || p[i] > upper)
+				{
+					codePoint = 0xFFFD;
+					return i;
+				}
+				codePoint = (codePoint << 6) | (p[i] & 0x3F);
+				lower = 0x80;
+				upper = 0xBF;
+			}
+			return length;
+		}
+
+		/**
+		 * @brief encode one code point into utf-8, return the number of bytes written
+		 */
+		inline size_t encodeUtf8(muint32 codePoint, muint8* p)
+		{
+			if (codePoint < 0x80)
+			{
+				p[0] = (muint8)codePoint;
+				return 1;
+			}
+			if (codePoint < 0x800)
+			{
+				p[0] = (muint8)(0xC0 | (codePoint >> 6));
+				p[1] = (muint8)(0x80 | (codePoint & 0x3F));
+				return 2;
+			}
+			if (codePoint < 0x10000)
+			{
+				p[0] = (muint8)(0xE0 | (codePoint >> 12));
+				p[1] = (muint8)(0x80 | ((codePoint >> 6) & 0x3F));
+				p[2] = (muint8)(0x80 | (codePoint & 0x3F));
+				return 3;
+			}
+			p[0] = (muint8)(0xF0 | (codePoint >> 18));
+			p[1] = (muint8)(0x80 | ((codePoint >> 12) & 0x3F));
+			p[2] = (muint8)(0x80 | ((codePoint >> 6) & 0x3F));
+			p[3] = (muint8)(0x80 | (codePoint & 0x3F));
+			return 4;
+		}
+
 		template<size_t size>	struct utf;
 		template<>				struct utf<8>  { typedef muint8  type; };
 		template<>				struct utf<16> { typedef muint16 type; };
@@ -273,72 +361,1023 @@ namespace MoeLP
 		return length;
 	}
 
+	namespace CodeConvert_Internal
+	{
+		/**
+		 * @brief decode one code point, or one ascii byte, and write its utf-16 code units
+		 */
+		inline void utf8ToUtf16Step(const muint8*& p, const muint8* end, muint16*& out)
+		{
+			if (*p < 0x80)
+			{
+				*out++ = *p++;
+				return;
+			}
+
+			muint32 codePoint;
+			p += decodeUtf8(p, end, codePoint);
+			if (codePoint >= 0x10000)
+			{
+				*out++ = (muint16)(0xD800 + ((codePoint - 0x10000) >> 10));
+				*out++ = (muint16)(0xDC00 + (codePoint & 0x03FF));
+			}
+			else
+			{
+				*out++ = (muint16)codePoint;
+			}
+		}
+
+		/**
+		 * @brief encode one code unit, or one surrogate pair, into utf-8
+		 */
+		inline void utf16ToUtf8Step(const muint16*& p, const muint16* end, muint8*& out)
+		{
+			muint32 c = *p++;
+			if (c < 0x80)
+			{
+				*out++ = (muint8)c;
+				return;
+			}
+
+			if (c >= 0xD800 && c <= 0xDFFF)
+			{
+				if (c <= 0xDBFF && p < end && *p >= 0xDC00 && *p <= 0xDFFF)
+					c = 0x10000 + ((c - 0xD800) << 10) + (*p++ - 0xDC00);
+				else
+					c = 0xFFFD;
+			}
+			out += encodeUtf8(c, out);
+		}
+
+		#if defined MOE_SSE2
+		/**
+		 * @brief convert 16 ascii bytes, return false without converting if one is not ascii
+		 */
+		inline bool asciiToUtf16Sse2(const muint8*& p, muint16*& out)
+		{
+			__m128i v = _mm_loadu_si128((const __m128i*)p);
+			if (_mm_movemask_epi8(v) != 0)
+				return false;
+			__m128i zero = _mm_setzero_si128();
+			_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(v, zero));
+			p += 16;
+			out += 16;
+			return true;
+		}
+
+		/**
+		 * @brief convert 16 ascii code units, return false without converting if one is not ascii
+		 */
+		inline bool asciiToUtf8Sse2(const muint16*& p, muint8*& out)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i*)p);
+			__m128i b = _mm_loadu_si128((const __m128i*)(p + 8));
+			__m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16((short)0xFF80));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+				return false;
+			_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(a, b));
+			p += 16;
+			out += 16;
+			return true;
+		}
+
+		/**
+		 * @brief convert 8 ascii code units, for the short runs between other characters
+		 */
+		inline bool asciiToUtf8Sse2Short(const muint16*& p, muint8*& out)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i*)p);
+			__m128i high = _mm_and_si128(a, _mm_set1_epi16((short)0xFF80));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+				return false;
+			_mm_storel_epi64((__m128i*)out, _mm_packus_epi16(a, a));
+			p += 8;
+			out += 8;
+			return true;
+		}
+
+		/**
+		 * @brief decode four 3 bytes sequences from 12 bytes, 16 bytes must be readable
+		 * @detail this is the form of the Chinese, Japanese and Korean characters. It returns
+		 * false without decoding if the bytes are not four well-formed 3 bytes sequences.
+		 */
+		MOE_TARGET("ssse3") inline bool threeByteToUtf16Ssse3(const muint8*& p, muint16*& out)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)p);
+			const __m128i bits = _mm_setr_epi8((char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0,
+				(char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0, 0, 0, 0, 0);
+			const __m128i form = _mm_setr_epi8((char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80,
+				(char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80, 0, 0, 0, 0);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, bits), form)) != 0xFFFF)
+				return false;
+
+			// every 32 bits lane holds the last, the middle and the first byte of a sequence
+			__m128i lanes = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1));
+			__m128i codePoints = _mm_or_si128(_mm_or_si128(
+				_mm_and_si128(lanes, _mm_set1_epi32(0x3F)),
+				_mm_and_si128(_mm_srli_epi32(lanes, 2), _mm_set1_epi32(0xFC0))),
+				_mm_and_si128(_mm_srli_epi32(lanes, 4), _mm_set1_epi32(0xF000)));
+
+			__m128i overlong = _mm_cmplt_epi32(codePoints, _mm_set1_epi32(0x800));
+			__m128i surrogate = _mm_cmpeq_epi32(_mm_and_si128(codePoints, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800));
+			if (_mm_movemask_epi8(_mm_or_si128(overlong, surrogate)) != 0)
+				return false;
+
+			__m128i units = _mm_shuffle_epi8(codePoints, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+			_mm_storel_epi64((__m128i*)out, units);
+			p += 12;
+			out += 4;
+			return true;
+		}
+
+		/**
+		 * @brief encode eight code units from U+0800 to U+FFFF into 24 bytes
+		 * @detail the second store writes 4 bytes past the 24, the caller must have 8 more
+		 * code units to convert so that these bytes are inside the output.
+		 */
+		MOE_TARGET("ssse3") inline bool threeByteToUtf8Ssse3(const muint16*& p, muint8*& out)
+		{
+			const __m128i u = _mm_loadu_si128((const __m128i*)p);
+			__m128i top = _mm_and_si128(u, _mm_set1_epi16((short)0xF800));
+			__m128i invalid = _mm_or_si128(_mm_cmpeq_epi16(top, _mm_setzero_si128()), _mm_cmpeq_epi16(top, _mm_set1_epi16((short)0xD800)));
+			if (_mm_movemask_epi8(invalid) != 0)
+				return false;
+
+			__m128i b0 = _mm_or_si128(_mm_srli_epi16(u, 12), _mm_set1_epi16(0xE0));
+			__m128i b1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+			__m128i b2 = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+			__m128i b01 = _mm_or_si128(b0, _mm_slli_epi16(b1, 8));
+
+			const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+			_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(_mm_unpacklo_epi16(b01, b2), pack));
+			_mm_storeu_si128((__m128i*)(out + 12), _mm_shuffle_epi8(_mm_unpackhi_epi16(b01, b2), pack));
+			p += 8;
+			out += 24;
+			return true;
+		}
+
+		MOE_TARGET("avx2") inline bool asciiToUtf16Avx2(const muint8*& p, muint16*& out)
+		{
+			__m256i v = _mm256_loadu_si256((const __m256i*)p);
+			if (_mm256_movemask_epi8(v) != 0)
+				return false;
+			_mm256_storeu_si256((__m256i*)out, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+			_mm256_storeu_si256((__m256i*)(out + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+			p += 32;
+			out += 32;
+			return true;
+		}
+
+		MOE_TARGET("avx2") inline bool asciiToUtf8Avx2(const muint16*& p, muint8*& out)
+		{
+			__m256i a = _mm256_loadu_si256((const __m256i*)p);
+			__m256i b = _mm256_loadu_si256((const __m256i*)(p + 16));
+			if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi16((short)0xFF80)))
+				return false;
+			// packus works in 128 bits halves, the permutation puts the halves back in order
+			__m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+			_mm256_storeu_si256((__m256i*)out, bytes);
+			p += 32;
+			out += 32;
+			return true;
+		}
+
+		inline size_t utf8ToUtf16Sse2(const muint8* p, const muint8* end, muint16* out)
+		{
+			muint16* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 16 && asciiToUtf16Sse2(p, out))
+					continue;
+				utf8ToUtf16Step(p, end, out);
+			}
+			return out - begin;
+		}
+
+		MOE_TARGET("ssse3") inline size_t utf8ToUtf16Ssse3(const muint8* p, const muint8* end, muint16* out)
+		{
+			muint16* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 16 && (asciiToUtf16Sse2(p, out) || threeByteToUtf16Ssse3(p, out)))
+					continue;
+				utf8ToUtf16Step(p, end, out);
+			}
+			return out - begin;
+		}
+
+		MOE_TARGET("avx2") inline size_t utf8ToUtf16Avx2(const muint8* p, const muint8* end, muint16* out)
+		{
+			muint16* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 32 && asciiToUtf16Avx2(p, out))
+					continue;
+				if (end - p >= 16 && (asciiToUtf16Sse2(p, out) || threeByteToUtf16Ssse3(p, out)))
+					continue;
+				utf8ToUtf16Step(p, end, out);
+			}
+			return out - begin;
+		}
+
+		inline size_t utf16ToUtf8Sse2(const muint16* p, const muint16* end, muint8* out)
+		{
+			muint8* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 16 && asciiToUtf8Sse2(p, out))
+					continue;
+				if (end - p >= 8 && asciiToUtf8Sse2Short(p, out))
+					continue;
+				utf16ToUtf8Step(p, end, out);
+			}
+			return out - begin;
+		}
+
+		MOE_TARGET("ssse3") inline size_t utf16ToUtf8Ssse3(const muint16* p, const muint16* end, muint8* out)
+		{
+			muint8* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 16 && (asciiToUtf8Sse2(p, out) || threeByteToUtf8Ssse3(p, out)))
+					continue;
+				if (end - p >= 8 && asciiToUtf8Sse2Short(p, out))
+					continue;
+				utf16ToUtf8Step(p, end, out);
+			}
+			return out - begin;
+		}
+
+		MOE_TARGET("avx2") inline size_t utf16ToUtf8Avx2(const muint16* p, const muint16* end, muint8* out)
+		{
+			muint8* begin = out;
+			while (p < end)
+			{
+				if (end - p >= 32 && asciiToUtf8Avx2(p, out))
+					continue;
+				if (end - p >= 16 && (asciiToUtf8Sse2(p, out) || threeByteToUtf8Ssse3(p, out)))
+					continue;
+				if (end - p >= 8 && asciiToUtf8Sse2Short(p, out))
+					continue;
+				utf16ToUtf8Step(p, end, out);
+			}
+			return out - begin;
+		}
+		#endif
+
+		inline size_t utf8ToUtf16Scalar(const muint8* p, const muint8* end, muint16* out)
+		{
+			muint16* begin = out;
+			while (p < end)
+				utf8ToUtf16Step(p, end, out);
+			return out - begin;
+		}
+
+		inline size_t utf16ToUtf8Scalar(const muint16* p, const muint16* end, muint8* out)
+		{
+			muint8* begin = out;
+			while (p < end)
+				utf16ToUtf8Step(p, end, out);
+			return out - begin;
+		}
+	}
+
+	/**
+	 * @brief convert utf-8 bytes to utf-16 code units
+	 * @param utf8: the bytes
+	 * @param length: the number of bytes
+	 * @param utf16: the output, it should be able to contain length code units
+	 * @return the number of code units written
+	 * @detail ill-formed sequences are replaced by U+FFFD, the input need not be zero terminated.
+	 * Runs of ascii bytes and of 3 bytes sequences are converted by SIMD instructions
+	 * chosen for the cpu at run time.
+	 */
+	inline size_t utf8ToUtf16(const char* utf8, size_t length, muint16* utf16)
+	{
+		typedef size_t Kernel(const muint8*, const muint8*, muint16*);
+		static const CpuDispatch<Kernel> kernel = CpuDispatch<Kernel>(CodeConvert_Internal::utf8ToUtf16Scalar)
+		#if defined MOE_SSE2
+			.add(CpuTier::SSE2, CodeConvert_Internal::utf8ToUtf16Sse2)
+			.add(CpuTier::SSE42, CodeConvert_Internal::utf8ToUtf16Ssse3)
+			.add(CpuTier::AVX2, CodeConvert_Internal::utf8ToUtf16Avx2)
+		#endif
+			;
+
+		const muint8* p = (const muint8*)utf8;
+		return kernel(p, p + length, utf16);
+	}
+
+	/**
+	 * @brief convert utf-16 code units to utf-8 bytes
+	 * @param utf16: the code units
+	 * @param length: the number of code units
+	 * @param utf8: the output, it should be able to contain 3 * length bytes
+	 * @return the number of bytes written
+	 * @detail an unpaired surrogate is replaced by U+FFFD. Runs of ascii code units and of
+	 * code units from U+0800 to U+FFFF are converted by SIMD instructions chosen for the cpu
+	 * at run time.
+	 */
+	inline size_t utf16ToUtf8(const muint16* utf16, size_t length, char* utf8)
+	{
+		typedef size_t Kernel(const muint16*, const muint16*, muint8*);
+		static const CpuDispatch<Kernel> kernel = CpuDispatch<Kernel>(CodeConvert_Internal::utf16ToUtf8Scalar)
+		#if defined MOE_SSE2
+			.add(CpuTier::SSE2, CodeConvert_Internal::utf16ToUtf8Sse2)
+			.add(CpuTier::SSE42, CodeConvert_Internal::utf16ToUtf8Ssse3)
+			.add(CpuTier::AVX2, CodeConvert_Internal::utf16ToUtf8Avx2)
+		#endif
+			;
+
+		return kernel(utf16, utf16 + length, (muint8*)utf8);
+	}
+
+	namespace CodeConvert_Internal
+	{
+		inline size_t popCount(muint32 x)
+		{
+			#if defined MOE_GCC
+			return __builtin_popcount(x);
+			#else
+			x = x - ((x >> 1) & 0x55555555);
+			x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+			return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+			#endif
+		}
+
+		/**
+		 * @brief validate utf-8 one code point at a time, count the utf-16 code units if it is valid
+		 */
+		inline bool scanUtf8Scalar(const muint8* p, const muint8* end, size_t& units)
+		{
+			size_t count = 0;
+			while (p < end)
+			{
+				if (*p < 0x80)
+				{
+					p++;
+					count++;
+					continue;
+				}
+
+				muint32 codePoint;
+				size_t read = decodeUtf8(p, end, codePoint);
+				if (codePoint == 0xFFFD && !(read == 3 && p[0] == 0xEF))
+					return false;
+				p += read;
+				count += codePoint >= 0x10000 ? 2 : 1;
+			}
+			units += count;
+			return true;
+		}
+
+		#if defined MOE_SSE2
+		/**
+		 * @brief the error flags of the validation, a pair of bytes is ill-formed when the
+		 * flags of its first byte's high and low nibbles and its second byte's high nibble
+		 * have a common bit
+		 */
+		enum Utf8Error
+		{
+			TooShort		= 1 << 0,		// a lead byte followed by a lead byte or an ascii byte
+			TooLong			= 1 << 1,		// an ascii byte followed by a continuation byte
+			Overlong3		= 1 << 2,
+			TooLarge		= 1 << 3,
+			Surrogate		= 1 << 4,
+			Overlong2		= 1 << 5,
+			TooLarge1000	= 1 << 6,
+			Overlong4		= 1 << 6,
+			TwoContinuations = 1 << 7,		// two continuation bytes, which is only right after a 3 or 4 bytes lead
+			Carry			= TooShort | TooLong | TwoContinuations
+		};
+
+		/**
+		 * @brief return the nonzero bytes where the bytes of a block are not well-formed utf-8
+		 * @param block: the 16 bytes
+		 * @param previous: the 16 bytes before them
+		 * @detail the check of Keiser and Lemire: three table lookups by nibble find the
+		 * errors of every pair of adjacent bytes, and the third and fourth bytes of the
+		 * longer sequences are checked by where the 3 and 4 bytes leads are.
+		 */
+		MOE_TARGET("ssse3") inline __m128i utf8BlockErrors(__m128i block, __m128i previous)
+		{
+			const __m128i nibble = _mm_set1_epi8(0x0F);
+			const __m128i firstHigh = _mm_setr_epi8(
+				TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+				(char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations, (char)TwoContinuations,
+				TooShort | Overlong2,
+				TooShort,
+				TooShort | Overlong3 | Surrogate,
+				TooShort | TooLarge | TooLarge1000 | Overlong4);
+			const __m128i firstLow = _mm_setr_epi8(
+				(char)(Carry | Overlong3 | Overlong2 | Overlong4),
+				(char)(Carry | Overlong2),
+				(char)Carry,
+				(char)Carry,
+				(char)(Carry | TooLarge),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000 | Surrogate),
+				(char)(Carry | TooLarge | TooLarge1000),
+				(char)(Carry | TooLarge | TooLarge1000));
+			const __m128i secondHigh = _mm_setr_epi8(
+				TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+				(char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4),
+				(char)(TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge),
+				(char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+				(char)(TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge),
+				TooShort, TooShort, TooShort, TooShort);
+
+			__m128i previous1 = _mm_alignr_epi8(block, previous, 15);
+			__m128i flags = _mm_and_si128(_mm_and_si128(
+				_mm_shuffle_epi8(firstHigh, _mm_and_si128(_mm_srli_epi16(previous1, 4), nibble)),
+				_mm_shuffle_epi8(firstLow, _mm_and_si128(previous1, nibble))),
+				_mm_shuffle_epi8(secondHigh, _mm_and_si128(_mm_srli_epi16(block, 4), nibble)));
+
+			// the bytes two after a 3 or 4 bytes lead, or three after a 4 bytes lead, must be continuations
+			__m128i third = _mm_subs_epu8(_mm_alignr_epi8(block, previous, 14), _mm_set1_epi8(0xE0 - 0x80));
+			__m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(block, previous, 13), _mm_set1_epi8(0xF0 - 0x80));
+			__m128i continuation = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+			return _mm_xor_si128(flags, continuation);
+		}
+
+		/**
+		 * @brief validate utf-8 16 bytes at a time, count the utf-16 code units if it is valid
+		 * @detail every byte that is not a continuation byte begins a code point, and a 4 bytes
+		 * lead gives a surrogate pair.
+		 */
+		MOE_TARGET("ssse3") inline bool scanUtf8Ssse3(const muint8* p, const muint8* end, size_t& units)
+		{
+			if (p == end)
+				return true;
+
+			__m128i previous = _mm_setzero_si128();
+			__m128i errors = _mm_setzero_si128();
+			size_t count = 0;
+			muint8 last[16];
+			for (;;)
+			{
+				__m128i block;
+				if (end - p >= 16)
+				{
+					block = _mm_loadu_si128((const __m128i*)p);
+				}
+				else
+				{
+					// the zeros after the end find the sequences the end cuts
+					memset(last, 0, sizeof(last));
+					memcpy(last, p, end - p);
+					block = _mm_loadu_si128((const __m128i*)last);
+				}
+
+				errors = _mm_or_si128(errors, utf8BlockErrors(block, previous));
+				muint32 starts = _mm_movemask_epi8(_mm_cmpgt_epi8(block, _mm_set1_epi8((char)0xBF)));
+				muint32 fourBytes = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(block, _mm_set1_epi8((char)0xF0)), block));
+				count += popCount(starts) + popCount(fourBytes);
+				previous = block;
+
+				if (end - p <= 16)
+				{
+					if (end - p == 16)
+						errors = _mm_or_si128(errors, utf8BlockErrors(_mm_setzero_si128(), previous));
+					break;
+				}
+				p += 16;
+			}
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) != 0xFFFF)
+				return false;
+			// the zeros of the last block are counted as ascii bytes
+			units += count - (16 - (end - p));
+			return true;
+		}
+
+		/**
+		 * @brief count the utf-8 bytes of 8 code units without surrogates, return false if there is one
+		 */
+		inline bool utf8LengthSse2(const muint16* p, size_t& bytes)
+		{
+			__m128i u = _mm_loadu_si128((const __m128i*)p);
+			__m128i top = _mm_and_si128(u, _mm_set1_epi16((short)0xF800));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_set1_epi16((short)0xD800))) != 0)
+				return false;
+			muint32 ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128()));
+			muint32 small = _mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_setzero_si128()));
+			// every movemask bit of a lane is doubled
+			bytes += 24 - (popCount(ascii) + popCount(small)) / 2;
+			return true;
+		}
+		#endif
+	}
+
+	namespace CodeConvert_Internal
+	{
+		/**
+		 * @brief validate utf-8 with the best kernel, count the utf-16 code units if it is valid
+		 */
+		inline bool scanUtf8(const muint8* p, const muint8* end, size_t& units)
+		{
+			typedef bool Kernel(const muint8*, const muint8*, size_t&);
+			static const CpuDispatch<Kernel> kernel = CpuDispatch<Kernel>(scanUtf8Scalar)
+			#if defined MOE_SSE2
+				.add(CpuTier::SSE42, scanUtf8Ssse3)
+			#endif
+				;
+			return kernel(p, end, units);
+		}
+	}
+
+	/**
+	 * @brief return whether bytes are well-formed utf-8
+	 * @param utf8: the bytes
+	 * @param length: the number of bytes
+	 * @detail it checks 16 bytes at a time with SSSE3 when the cpu has it.
+	 */
+	inline bool validateUtf8(const char* utf8, size_t length)
+	{
+		size_t units = 0;
+		const muint8* p = (const muint8*)utf8;
+		return CodeConvert_Internal::scanUtf8(p, p + length, units);
+	}
+
+	/**
+	 * @brief return the number of utf-16 code units utf8ToUtf16 writes for utf-8 bytes
+	 * @detail well-formed bytes are validated and counted in one pass, ill-formed bytes are
+	 * counted once more as they are decoded.
+	 */
+	inline size_t utf16LengthOfUtf8(const char* utf8, size_t length)
+	{
+		size_t units = 0;
+		const muint8* p = (const muint8*)utf8;
+		const muint8* end = p + length;
+		if (CodeConvert_Internal::scanUtf8(p, end, units))
+			return units;
+
+		while (p < end)
+		{
+			muint32 codePoint;
+			p += CodeConvert_Internal::decodeUtf8(p, end, codePoint);
+			units += codePoint >= 0x10000 ? 2 : 1;
+		}
+		return units;
+	}
+
+	/**
+	 * @brief return the number of utf-8 bytes utf16ToUtf8 writes for utf-16 code units
+	 * @detail an unpaired surrogate counts as the 3 bytes of U+FFFD.
+	 */
+	inline size_t utf8LengthOfUtf16(const muint16* utf16, size_t length)
+	{
+		size_t bytes = 0;
+		const muint16* p = utf16;
+		const muint16* end = p + length;
+		while (p < end)
+		{
+			#if defined MOE_SSE2
+			if (end - p >= 8 && CodeConvert_Internal::utf8LengthSse2(p, bytes))
+			{
+				p += 8;
+				continue;
+			}
+			#endif
+			muint16 c = *p++;
+			if (c < 0x80)
+				bytes += 1;
+			else if (c < 0x800)
+				bytes += 2;
+			else if (c >= 0xD800 && c <= 0xDBFF && p < end && *p >= 0xDC00 && *p <= 0xDFFF)
+			{
+				bytes += 4;
+				p++;
+			}
+			else
+				bytes += 3;
+		}
+		return bytes;
+	}
+
+	namespace CodeConvert_Internal
+	{
+		inline void swapBytes16Scalar(const muint16* p, const muint16* end, muint16* out)
+		{
+			while (p < end)
+			{
+				muint16 c = *p++;
+				*out++ = (muint16)((c >> 8) | (c << 8));
+			}
+		}
+
+		#if defined MOE_SSE2
+		inline void swapBytes16Sse2(const muint16* p, const muint16* end, muint16* out)
+		{
+			for (; end - p >= 8; p += 8, out += 8)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)p);
+				_mm_storeu_si128((__m128i*)out, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+			}
+			swapBytes16Scalar(p, end, out);
+		}
+
+		MOE_TARGET("ssse3") inline void swapBytes16Ssse3(const muint16* p, const muint16* end, muint16* out)
+		{
+			const __m128i order = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			for (; end - p >= 16; p += 16, out += 16)
+			{
+				__m128i a = _mm_loadu_si128((const __m128i*)p);
+				__m128i b = _mm_loadu_si128((const __m128i*)(p + 8));
+				_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(a, order));
+				_mm_storeu_si128((__m128i*)(out + 8), _mm_shuffle_epi8(b, order));
+			}
+			swapBytes16Scalar(p, end, out);
+		}
+
+		MOE_TARGET("avx2") inline void swapBytes16Avx2(const muint16* p, const muint16* end, muint16* out)
+		{
+			const __m256i order = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+				1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			for (; end - p >= 32; p += 32, out += 32)
+			{
+				__m256i a = _mm256_loadu_si256((const __m256i*)p);
+				__m256i b = _mm256_loadu_si256((const __m256i*)(p + 16));
+				_mm256_storeu_si256((__m256i*)out, _mm256_shuffle_epi8(a, order));
+				_mm256_storeu_si256((__m256i*)(out + 16), _mm256_shuffle_epi8(b, order));
+			}
+			swapBytes16Ssse3(p, end, out);
+		}
+		#endif
+	}
+
+	/**
+	 * @brief swap the two bytes of every code unit, which converts between utf-16le and utf-16be
+	 * @param utf16: the code units
+	 * @param length: the number of code units
+	 * @param out: the output, it can be utf16 itself
+	 */
+	inline void swapBytes16(const muint16* utf16, size_t length, muint16* out)
+	{
+		typedef void Kernel(const muint16*, const muint16*, muint16*);
+		static const CpuDispatch<Kernel> kernel = CpuDispatch<Kernel>(CodeConvert_Internal::swapBytes16Scalar)
+		#if defined MOE_SSE2
+			.add(CpuTier::SSE2, CodeConvert_Internal::swapBytes16Sse2)
+			.add(CpuTier::SSE42, CodeConvert_Internal::swapBytes16Ssse3)
+			.add(CpuTier::AVX2, CodeConvert_Internal::swapBytes16Avx2)
+		#endif
+			;
+
+		kernel(utf16, utf16 + length, out);
+	}
+
+	namespace Gb18030_Internal
+	{
+		/**
+		 * @brief the code point decodeCode gives for an ill-formed code
+		 */
+		const muint32 illFormed = 0xFFFFFFFF;
+
+		/**
+		 * @brief the linear index of the first four bytes code of the supplementary planes, 0x90308130
+		 */
+		const muint32 supplementaryIndex = 189000;
+
+		/**
+		 * @brief GB18030-2005 swapped U+1E3F and U+E7C7 of GB18030-2000, U+1E3F is A8 BC and
+		 * U+E7C7 is this four bytes code, 81 35 F4 37, out of the order of its range
+		 */
+		const muint32 swappedIndex = 7457;
+		const muint32 swappedCodePoint = 0xE7C7;
+
+		/**
+		 * @brief the two bytes code of every code point of the basic multilingual plane, or 0
+		 * for the code points encoded in four bytes
+		 */
+		class EncodeTable
+		{
+		public:
+			EncodeTable()
+			{
+				memset(codes, 0, sizeof(codes));
+				for (muint32 i = 0; i < sizeof(twoByteCodes) / sizeof(twoByteCodes[0]); i++)
+				{
+					muint32 lead = 0x81 + i / 190;
+					muint32 trail = 0x40 + i % 190;
+					if (trail >= 0x7F)
+						trail++;
+					codes[twoByteCodes[i]] = (muint16)((lead << 8) | trail);
+				}
+			}
+
+			muint16 operator[](muint32 codePoint) const
+			{
+				return codes[codePoint];
+			}
+
+		private:
+			muint16 codes[0x10000];
+		};
+
+		inline const EncodeTable& encodeTable()
+		{
+			static const EncodeTable table;
+			return table;
+		}
+
+		inline muint32 fourByteCodePoint(muint32 index)
+		{
+			if (index == swappedIndex)
+				return swappedCodePoint;
+			const size_t count = sizeof(fourByteRanges) / sizeof(fourByteRanges[0]);
+			size_t low = 0, high = count;
+			while (high - low > 1)
+			{
+				size_t middle = (low + high) / 2;
+				if (fourByteRanges[middle].index <= index)
+					low = middle;
+				else
+					high = middle;
+			}
+			return fourByteRanges[low].codePoint + (index - fourByteRanges[low].index);
+		}
+
+		inline muint32 fourByteIndex(muint32 codePoint)
+		{
+			if (codePoint == swappedCodePoint)
+				return swappedIndex;
+			const size_t count = sizeof(fourByteRanges) / sizeof(fourByteRanges[0]);
+			size_t low = 0, high = count;
+			while (high - low > 1)
+			{
+				size_t middle = (low + high) / 2;
+				if (fourByteRanges[middle].codePoint <= codePoint)
+					low = middle;
+				else
+					high = middle;
+			}
+			return fourByteRanges[low].index + (codePoint - fourByteRanges[low].codePoint);
+		}
+
+		inline bool isLead(muint8 b)
+		{
+			return b >= 0x81 && b <= 0xFE;
+		}
+
+		inline bool isDigit(muint8 b)
+		{
+			return b >= 0x30 && b <= 0x39;
+		}
+
+		/**
+		 * @brief return whether bytes begin a code without completing it
+		 */
+		inline bool incomplete(const muint8* p, const muint8* end)
+		{
+			size_t n = end - p;
+			if (n == 0 || n >= 4 || !isLead(p[0]))
+				return false;
+			if (n == 1)
+				return true;
+			return isDigit(p[1]) && (n == 2 || isLead(p[2]));
+		}
+
+		/**
+		 * @brief decode one code
+		 * @return the number of bytes read, at least 1 when p < end
+		 * @detail an ill-formed code gives illFormed. It reads only its lead byte when the
+		 * following bytes can begin another code, as the WHATWG encoding standard does.
+		 */
+		inline size_t decodeCode(const muint8* p, const muint8* end, muint32& codePoint)
+		{
+			muint8 b1 = p[0];
+			if (b1 < 0x80)
+			{
+				codePoint = b1;
+				return 1;
+			}
+
+			codePoint = illFormed;
+			if (!isLead(b1) || end - p < 2)
+				return 1;
+
+			muint8 b2 = p[1];
+			if (isDigit(b2))
+			{
+				if (end - p < 4 || !isLead(p[2]) || !isDigit(p[3]))
+					return 1;
+				muint32 index = (((b1 - 0x81) * 10 + (b2 - 0x30)) * 126 + (p[2] - 0x81)) * 10 + (p[3] - 0x30);
+				if (index < 39420)
+					codePoint = fourByteCodePoint(index);
+				else if (index >= supplementaryIndex && index - supplementaryIndex < 0x100000)
+					codePoint = 0x10000 + (index - supplementaryIndex);
+				return 4;
+			}
+
+			if (b2 < 0x40 || b2 == 0x7F || b2 == 0xFF)
+				return b2 < 0x80 ? 1 : 2;
+			codePoint = twoByteCodes[(b1 - 0x81) * 190 + (b2 - 0x40) - (b2 > 0x7F)];
+			return 2;
+		}
+
+		/**
+		 * @brief encode one code point, return the number of bytes written
+		 */
+		inline size_t encodeCode(muint32 codePoint, muint8* p)
+		{
+			if (codePoint < 0x80)
+			{
+				p[0] = (muint8)codePoint;
+				return 1;
+			}
+
+			muint32 index;
+			if (codePoint < 0x10000)
+			{
+				muint16 code = encodeTable()[codePoint];
+				if (code != 0)
+				{
+					p[0] = (muint8)(code >> 8);
+					p[1] = (muint8)code;
+					return 2;
+				}
+				index = fourByteIndex(codePoint);
+			}
+			else
+			{
+				index = supplementaryIndex + (codePoint - 0x10000);
+			}
+
+			p[3] = (muint8)(0x30 + index % 10);
+			index /= 10;
+			p[2] = (muint8)(0x81 + index % 126);
+			index /= 126;
+			p[1] = (muint8)(0x30 + index % 10);
+			p[0] = (muint8)(0x81 + index / 10);
+			return 4;
+		}
+
+		/**
+		 * @brief decode codes until the end, or until an ill-formed code if replace is false,
+		 * or until an unfinished code at the end if keepTail is true
+		 * @return where it stops
+		 */
+		inline const muint8* decodeRun(const muint8* p, const muint8* end, muint16*& out, bool replace, bool keepTail)
+		{
+			while (p < end)
+			{
+				#if defined MOE_SSE2
+				if (end - p >= 16 && CodeConvert_Internal::asciiToUtf16Sse2(p, out))
+					continue;
+				#endif
+				if (*p < 0x80)
+				{
+					*out++ = *p++;
+					continue;
+				}
+				if (keepTail && end - p < 4 && incomplete(p, end))
+					return p;
+
+				muint32 codePoint;
+				size_t read = decodeCode(p, end, codePoint);
+				if (codePoint == illFormed)
+				{
+					if (!replace)
+						return p;
+					codePoint = 0xFFFD;
+				}
+				p += read;
+				if (codePoint >= 0x10000)
+				{
+					*out++ = (muint16)(0xD800 + ((codePoint - 0x10000) >> 10));
+					*out++ = (muint16)(0xDC00 + (codePoint & 0x03FF));
+				}
+				else
+				{
+					*out++ = (muint16)codePoint;
+				}
+			}
+			return p;
+		}
+
+		/**
+		 * @brief encode code units until the end, or until an unpaired surrogate if replace is false,
+		 * or until a high surrogate at the end if keepTail is true
+		 * @return where it stops
+		 */
+		inline const muint16* encodeRun(const muint16* p, const muint16* end, muint8*& out, bool replace, bool keepTail)
+		{
+			while (p < end)
+			{
+				#if defined MOE_SSE2
+				if (end - p >= 16 && CodeConvert_Internal::asciiToUtf8Sse2(p, out))
+					continue;
+				#endif
+				muint32 c = *p;
+				if (c < 0x80)
+				{
+					*out++ = (muint8)c;
+					p++;
+					continue;
+				}
+
+				if (c >= 0xD800 && c <= 0xDFFF)
+				{
+					if (c <= 0xDBFF && p + 1 < end && p[1] >= 0xDC00 && p[1] <= 0xDFFF)
+					{
+						out += encodeCode(0x10000 + ((c - 0xD800) << 10) + (p[1] - 0xDC00), out);
+						p += 2;
+						continue;
+					}
+					if (keepTail && c <= 0xDBFF && p + 1 == end)
+						return p;
+					if (!replace)
+						return p;
+					c = 0xFFFD;
+				}
+				out += encodeCode(c, out);
+				p++;
+			}
+			return p;
+		}
+	}
+
+	/**
+	 * @brief convert GB18030 bytes to utf-16 code units
+	 * @param gb18030: the bytes
+	 * @param length: the number of bytes
+	 * @param utf16: the output, it should be able to contain length code units
+	 * @return the number of code units written
+	 * @detail GB18030 covers all of Unicode and contains GBK and GB2312, the conversion is
+	 * done with built-in tables and does not depend on the locale. Ill-formed codes are
+	 * replaced by U+FFFD and ascii runs are converted 16 bytes at a time.
+	 */
+	inline size_t gb18030ToUtf16(const char* gb18030, size_t length, muint16* utf16)
+	{
+		muint16* out = utf16;
+		const muint8* p = (const muint8*)gb18030;
+		Gb18030_Internal::decodeRun(p, p + length, out, true, false);
+		return out - utf16;
+	}
+
+	/**
+	 * @brief convert utf-16 code units to GB18030 bytes
+	 * @param utf16: the code units
+	 * @param length: the number of code units
+	 * @param gb18030: the output, it should be able to contain 4 * length bytes
+	 * @return the number of bytes written
+	 * @detail an unpaired surrogate is replaced by U+FFFD.
+	 */
+	inline size_t utf16ToGb18030(const muint16* utf16, size_t length, char* gb18030)
+	{
+		muint8* out = (muint8*)gb18030;
+		Gb18030_Internal::encodeRun(utf16, utf16 + length, out, true, false);
+		return out - (muint8*)gb18030;
+	}
+
 	/**
 	 * @brief UTF-8 string to UTF-16 string
+	 * @detail ucs2str should be able to contain one code unit per byte and the terminator,
+	 * an ill-formed sequence is replaced by U+FFFD.
 	 */
 	template<typename T1, typename T2>
 	typename std::enable_if<CodeConvert_Internal::utfMatch<T1, 8>::value &&
 		CodeConvert_Internal::utfMatch<T2, 16>::value,
 		size_t>::type codeConvert(T1* utf8str, T2*& ucs2str)
 	{
-		mint num, len;
-		muint32 ucs4;
-
 		if (utf8str == nullptr)
 			return 0;
 
-		num = 0;
-		while (*utf8str)
-		{
-			len = codeConvert(utf8str, ucs4);
-			if (len == 0) return 0;
-
-			utf8str += len;
-
-			T2* temp = (T2*)cpuAllocate(sizeof(T2) * 10);
-			len = codeConvert(ucs4, temp);
-			if (len == 0) return 0;
+		size_t length = 0;
+		while (utf8str[length])
+			length++;
 
-			memcpy(ucs2str + num, temp, len * sizeof(T2));
-			num += len;
-
-			cpuDeallocate(temp, sizeof(T2) * 10);
-		}
-		*(ucs2str + num) = 0;
+		size_t num = utf8ToUtf16((const char*)utf8str, length, (muint16*)ucs2str);
+		ucs2str[num] = 0;
 		return num;
 	}
 
 	/**
 	 * @brief UTF-16 string to UTF-8 string
+	 * @detail utf8str should be able to contain three bytes per code unit and the terminator,
+	 * an unpaired surrogate is replaced by U+FFFD.
 	 */
 	template<typename T1, typename T2>
 	typename std::enable_if<CodeConvert_Internal::utfMatch<T1, 16>::value &&
 		CodeConvert_Internal::utfMatch<T2, 8>::value,
 		size_t>::type codeConvert(T1* ucs2str, T2*& utf8str)
 	{
-		mint num, len;
-		muint32 ucs4;
-
 		if (ucs2str == nullptr)
 			return 0;
 
-		num = 0;
-		while (*ucs2str)
-		{
-			len = codeConvert(ucs2str, ucs4);
-			if (len == 0) return 0;
-
-			ucs2str += len;
+		size_t length = 0;
+		while (ucs2str[length])
+			length++;
 
-			T2* temp = (T2*)cpuAllocate(sizeof(T2) * 10);
-			len = codeConvert(ucs4, temp);
-			if (len == 0) return 0;
-
-			memcpy(utf8str + num, temp, len * sizeof(T2));
-			num += len;
-			cpuDeallocate(temp, sizeof(T2) * 10);
-		}
-		*(utf8str + num) = 0;
+		size_t num = utf16ToUtf8((const muint16*)ucs2str, length, (char*)utf8str);
+		utf8str[num] = 0;
 		return num;
 	}
 }
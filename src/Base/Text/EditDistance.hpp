@@ -0,0 +1,256 @@
+#ifndef MoeLP_Base_EditDistance
+#define MoeLP_Base_EditDistance
+
+#include "../Base.hpp"
+#include "Text.hpp"
+#include "TextView.hpp"
+
+#include <vector>
+
+namespace MoeLP
+{
+	namespace EditDistance_Internal
+	{
+		/**
+		 * @brief the bit masks of the positions of every code unit in a pattern
+		 * @detail ascii code units are looked up directly, the others in a small open
+		 * addressing table. A pattern of m code units has (m + 63) / 64 masks per unit.
+		 */
+		class PatternMasks
+		{
+		public:
+			PatternMasks()
+				: blocks(0),
+				mask(0)
+			{
+			}
+
+			void build(const muint16* pattern, size_t length)
+			{
+				blocks = (length + 63) / 64;
+				ascii.assign(128 * blocks, 0);
+				zero.assign(blocks, 0);
+
+				size_t others = 0;
+				for (size_t i = 0; i < length; i++)
+					others += pattern[i] >= 128;
+				size_t capacity = 8;
+				while (capacity < others * 2)
+					capacity *= 2;
+				mask = capacity - 1;
+				keys.assign(capacity, 0);
+				masks.assign(capacity * blocks, 0);
+
+				for (size_t i = 0; i < length; i++)
+				{
+					muint64* m = slot(pattern[i]);
+					m[i / 64] |= (muint64)1 << (i % 64);
+				}
+			}
+
+			size_t blockCount() const
+			{
+				return blocks;
+			}
+
+			/**
+			 * @brief return the masks of a code unit, one per block
+			 */
+			const muint64* operator[](muint16 c) const
+			{
+				if (c < 128)
+					return ascii.data() + c * blocks;
+
+				size_t i = hash(c) & mask;
+				for (;;)
+				{
+					muint32 key = keys[i];
+					if (key == 0)
+						return zero.data();
+					if (key == (muint32)c + 1)
+						return masks.data() + i * blocks;
+					i = (i + 1) & mask;
+				}
+			}
+
+		private:
+			size_t					blocks;
+			size_t					mask;
+			std::vector<muint64>	ascii;
+			std::vector<muint64>	zero;
+			std::vector<muint32>	keys;		// code unit + 1, 0 is an empty slot
+			std::vector<muint64>	masks;
+
+			static size_t hash(muint16 c)
+			{
+				return (size_t)c * 0x9E37u >> 4;
+			}
+
+			muint64* slot(muint16 c)
+			{
+				if (c < 128)
+					return ascii.data() + c * blocks;
+
+				size_t i = hash(c) & mask;
+				while (keys[i] != 0 && keys[i] != (muint32)c + 1)
+					i = (i + 1) & mask;
+				keys[i] = (muint32)c + 1;
+				return masks.data() + i * blocks;
+			}
+		};
+
+		/**
+		 * @brief advance one 64 bits block of the dynamic programming column by one text code unit
+		 * @param hin: the horizontal difference entering the top of the block
+		 * @param high: the bit of the last row of the block
+		 * @return the horizontal difference leaving the bottom of the block
+		 * @detail Hyyrö's formulation of Myers' bit-vector algorithm, Pv and Mv are the
+		 * positive and negative vertical differences of the column.
+		 */
+		inline mint advanceBlock(muint64& Pv, muint64& Mv, muint64 Eq, mint hin, muint64 high)
+		{
+			muint64 Xv = Eq | Mv;
+			if (hin < 0)
+				Eq |= 1;
+			muint64 Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+			muint64 Ph = Mv | ~(Xh | Pv);
+			muint64 Mh = Pv & Xh;
+
+			mint hout = (Ph & high) ? 1 : (Mh & high) ? -1 : 0;
+
+			Ph <<= 1;
+			Mh <<= 1;
+			if (hin < 0)
+				Mh |= 1;
+			else if (hin > 0)
+				Ph |= 1;
+
+			Pv = Mh | ~(Xv | Ph);
+			Mv = Ph & Xv;
+			return hout;
+		}
+
+		/**
+		 * @brief the edit distance between a pattern and a text, or maxDistance + 1 if it is larger
+		 */
+		inline size_t distance(const PatternMasks& masks, size_t m, const muint16* text, size_t n, size_t maxDistance)
+		{
+			if (m == 0)
+				return n <= maxDistance ? n : maxDistance + 1;
+			if ((m > n ? m - n : n - m) > maxDistance)
+				return maxDistance + 1;
+
+			const size_t blocks = masks.blockCount();
+			const muint64 last = (muint64)1 << ((m - 1) % 64);
+			size_t score = m;
+
+			if (blocks == 1)
+			{
+				muint64 Pv = ~(muint64)0, Mv = 0;
+				for (size_t j = 0; j < n; j++)
+				{
+					mint h = advanceBlock(Pv, Mv, masks[text[j]][0], 1, last);
+					score += h;
+					// every remaining text code unit lowers the score by at most one
+					if (score > maxDistance + (n - j - 1))
+						return maxDistance + 1;
+				}
+				return score <= maxDistance ? score : maxDistance + 1;
+			}
+
+			std::vector<muint64> P(blocks, ~(muint64)0), M(blocks, 0);
+			const muint64 top = (muint64)1 << 63;
+			for (size_t j = 0; j < n; j++)
+			{
+				const muint64* Eq = masks[text[j]];
+				mint h = 1;
+				for (size_t b = 0; b + 1 < blocks; b++)
+					h = advanceBlock(P[b], M[b], Eq[b], h, top);
+				h = advanceBlock(P[blocks - 1], M[blocks - 1], Eq[blocks - 1], h, last);
+				score += h;
+				if (score > maxDistance + (n - j - 1))
+					return maxDistance + 1;
+			}
+			return score <= maxDistance ? score : maxDistance + 1;
+		}
+	}
+
+	/**
+	 * @brief a pattern prepared for computing its edit distance to many texts
+	 * @example:
+	 * EditDistancePattern pattern(query.view());
+	 * for (TextView word : words)
+	 *     if (pattern.distance(word, 2) <= 2) {...}
+	 * @detail the distance is the Levenshtein distance over utf-16 code units, a character
+	 * outside the basic multilingual plane counts as two units. It is computed by the
+	 * bit-parallel algorithm of Myers, 64 pattern code units per machine word, so a text of
+	 * n code units costs O(n * ceil(m / 64)) instead of O(n * m).
+	 */
+	class EditDistancePattern
+	{
+	public:
+		explicit EditDistancePattern(const TextView& pattern)
+			: size(pattern.length())
+		{
+			masks.build(pattern.data(), pattern.length());
+		}
+
+		size_t length() const
+		{
+			return size;
+		}
+
+		/**
+		 * @brief return the edit distance to a text
+		 * @param maxDistance: the largest distance of interest, maxDistance + 1 is returned
+		 * for a larger distance and the computation stops as soon as it is known
+		 */
+		size_t distance(const TextView& text, size_t maxDistance = (size_t)-1 / 2) const
+		{
+			return EditDistance_Internal::distance(masks, size, text.data(), text.length(), maxDistance);
+		}
+
+	private:
+		size_t								size;
+		EditDistance_Internal::PatternMasks	masks;
+	};
+
+	/**
+	 * @brief the Levenshtein distance between two texts
+	 * @example: EditDistance::distance(L"kitten", L"sitting") == 3
+	 * @detail see EditDistancePattern, the shorter text is used as the pattern.
+	 */
+	class EditDistance
+	{
+	public:
+		static size_t distance(const TextView& a, const TextView& b, size_t maxDistance = (size_t)-1 / 2)
+		{
+			const TextView& pattern = a.length() <= b.length() ? a : b;
+			const TextView& text = a.length() <= b.length() ? b : a;
+			if ((text.length() - pattern.length()) > maxDistance)
+				return maxDistance + 1;
+
+			// the common prefix and suffix do not change the distance
+			size_t prefix = 0;
+			while (prefix < pattern.length() && pattern.data()[prefix] == text.data()[prefix])
+				prefix++;
+			size_t suffix = 0;
+			while (suffix < pattern.length() - prefix
+				&& pattern.data()[pattern.length() - 1 - suffix] == text.data()[text.length() - 1 - suffix])
+				suffix++;
+
+			TextView p = pattern.subView(prefix, pattern.length() - prefix - suffix);
+			TextView t = text.subView(prefix, text.length() - prefix - suffix);
+			EditDistance_Internal::PatternMasks masks;
+			masks.build(p.data(), p.length());
+			return EditDistance_Internal::distance(masks, p.length(), t.data(), t.length(), maxDistance);
+		}
+
+		static size_t distance(const Text& a, const Text& b, size_t maxDistance = (size_t)-1 / 2)
+		{
+			return distance(a.view(), b.view(), maxDistance);
+		}
+	};
+}
+
+#endif
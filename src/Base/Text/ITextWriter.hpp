@@ -2,6 +2,8 @@
 #define MoeLP_Base_ITextWriter
 
 #include "Text.hpp"
+#include "TextBuilder.hpp"
+#include "TextFormat.hpp"
 
 namespace MoeLP
 {
@@ -22,42 +24,73 @@ namespace MoeLP
 			return *this;
 		}
 
-		template<typename T>
-		ITextWriter& write(const Text& text, const T& n)
+		/**
+		 * @brief write a formatted text, see TextFormat for the rules of the escapes
+		 * @detail the format string is parsed once and all the arguments are written in one pass,
+		 * use write(const TextFormat&, ...) with a cached format to skip the parsing as well.
+		 */
+		template<typename T, typename... Args>
+		ITextWriter& write(const Text& text, const T& n, const Args& ... args)
 		{
-			writeText(text.arg(n));
-			return *this;
+			return write(TextFormat(text), n, args...);
 		}
 
 		template<typename T, typename... Args>
-		ITextWriter& write(const Text& text, const T& n, const Args& ... args)
+		ITextWriter& write(const TextFormat& format, const T& n, const Args& ... args)
 		{
-			write(text.arg(n), args...);
+			TextBuilder builder(format.text().length() + 16 * (sizeof...(Args) + 1));
+			format.formatTo(builder, n, args...);
+			writeText(builder.toText());
 			return *this;
 		}
 
 		ITextWriter& writeLine(const Text& text)
 		{
-			write(text);
-			writeText(L"\n");
+			TextBuilder builder(text.length() + 1);
+			builder.append(text).append(L'\n');
+			writeText(builder.toText());
 			return *this;
 		}
 
-		template<typename T>
-		ITextWriter& writeLine(const Text& text, const T& n)
+		/**
+		 * @brief write every text of a range followed by a line break
+		 * @param lines: a range of Text, TextView or wchar_t*
+		 * @detail the lines are gathered and written in batches, not one by one.
+		 */
+		template<typename Range>
+		ITextWriter& writeLines(const Range& lines)
 		{
-			write(text.arg(n));
-			writeText(L"\n");
+			const size_t batchSize = 1 << 16;
+			TextBuilder builder(batchSize);
+			for (const auto& line : lines)
+			{
+				builder.append(line).append(L'\n');
+				if (builder.length() >= batchSize)
+				{
+					writeText(builder.toText());
+					builder.clear();
+				}
+			}
+			if (builder.length() > 0)
+				writeText(builder.toText());
 			return *this;
 		}
 
 		template<typename T, typename... Args>
 		ITextWriter& writeLine(const Text& text, const T& n, const Args& ... args)
 		{
-			write(text.arg(n), args...);
-			writeText(L"\n");
+			return writeLine(TextFormat(text), n, args...);
+		}
+
+		template<typename T, typename... Args>
+		ITextWriter& writeLine(const TextFormat& format, const T& n, const Args& ... args)
+		{
+			TextBuilder builder(format.text().length() + 16 * (sizeof...(Args) + 1) + 1);
+			format.formatTo(builder, n, args...);
+			builder.append(L'\n');
+			writeText(builder.toText());
 			return *this;
 		}
 	};
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,1518 @@
+#ifndef MoeLP_Base_NumberConvert
+#define MoeLP_Base_NumberConvert
+
+#include "../Base.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace MoeLP
+{
+	namespace NumberConvert_Internal
+	{
+		/**
+		 * @brief "00" to "99", used to write two decimal digits at a time
+		 */
+		static const char digitPairs[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		static const char digitChars[37] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+		/**
+		 * @brief the value of an ascii digit or letter, 36 for other characters
+		 */
+		template<typename TChar>
+		inline muint32 digitValue(TChar c)
+		{
+			muint32 u = (muint32)(typename std::make_unsigned<TChar>::type)c;
+			if (u - '0' < 10) return u - '0';
+			u |= 0x20;
+			if (u - 'a' < 26) return u - 'a' + 10;
+			return 36;
+		}
+
+		template<typename TChar>
+		inline bool isSpace(TChar c)
+		{
+			muint32 u = (muint32)(typename std::make_unsigned<TChar>::type)c;
+			return u == ' ' || (u - '\t') < 5;
+		}
+
+		template<typename TChar>
+		inline bool matchWord(const TChar* begin, const TChar* end, const char* word)
+		{
+			for (; *word; word++, begin++)
+			{
+				if (begin == end) return false;
+				muint32 u = (muint32)(typename std::make_unsigned<TChar>::type)*begin;
+				if ((u | 0x20) != (muint32)*word) return false;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief write an unsigned integer backward from end, return the first written position
+		 */
+		template<typename TChar>
+		inline TChar* writeUnsigned(muint64 n, TChar* end, mint radix)
+		{
+			TChar* p = end;
+			if (radix == 10)
+			{
+				while (n >= 100)
+				{
+					muint32 i = (muint32)(n % 100) * 2;
+					n /= 100;
+					*--p = (TChar)digitPairs[i + 1];
+					*--p = (TChar)digitPairs[i];
+				}
+				if (n < 10)
+				{
+					*--p = (TChar)('0' + n);
+				}
+				else
+				{
+					muint32 i = (muint32)n * 2;
+					*--p = (TChar)digitPairs[i + 1];
+					*--p = (TChar)digitPairs[i];
+				}
+			}
+			else if ((radix & (radix - 1)) == 0)
+			{
+				muint32 shift = radix == 2 ? 1 : radix == 4 ? 2 : radix == 8 ? 3 : radix == 16 ? 4 : 5;
+				muint64 mask = (muint64)radix - 1;
+				do
+				{
+					*--p = (TChar)digitChars[n & mask];
+					n >>= shift;
+				} while (n);
+			}
+			else
+			{
+				do
+				{
+					*--p = (TChar)digitChars[n % radix];
+					n /= radix;
+				} while (n);
+			}
+			return p;
+		}
+
+		/**
+		 * @brief a 64 bits floating number f * 2^e without hidden bit, used by grisu3
+		 */
+		struct DiyFp
+		{
+			muint64	f;
+			mint32	e;
+
+			DiyFp(muint64 f, mint32 e) : f(f), e(e) {}
+
+			static DiyFp sub(const DiyFp& x, const DiyFp& y)
+			{
+				return DiyFp(x.f - y.f, x.e);
+			}
+
+			static DiyFp mul(const DiyFp& x, const DiyFp& y)
+			{
+				const muint64 a = x.f >> 32;
+				const muint64 b = x.f & 0xFFFFFFFFu;
+				const muint64 c = y.f >> 32;
+				const muint64 d = y.f & 0xFFFFFFFFu;
+
+				const muint64 ac = a * c;
+				const muint64 bc = b * c;
+				const muint64 ad = a * d;
+				const muint64 bd = b * d;
+
+				muint64 tmp = (bd >> 32) + (ad & 0xFFFFFFFFu) + (bc & 0xFFFFFFFFu);
+				tmp += muint64(1) << 31;	// round
+
+				return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64);
+			}
+
+			static DiyFp normalize(DiyFp x)
+			{
+				while ((x.f >> 63) == 0)
+				{
+					x.f <<= 1;
+					x.e--;
+				}
+				return x;
+			}
+
+			static DiyFp normalizeTo(const DiyFp& x, mint32 e)
+			{
+				return DiyFp(x.f << (x.e - e), e);
+			}
+		};
+
+		struct CachedPower
+		{
+			muint64	f;
+			mint32	e;
+			mint32	k;
+		};
+
+		/**
+		 * @brief normalized 10^k for k = -300, -292, ..., 324
+		 */
+		static const CachedPower cachedPowers[] =
+		{
+			{ 0xAB70FE17C79AC6CAULL, -1060, -300 },
+			{ 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+			{ 0xBE5691EF416BD60CULL, -1007, -284 },
+			{ 0x8DD01FAD907FFC3CULL, -980, -276 },
+			{ 0xD3515C2831559A83ULL, -954, -268 },
+			{ 0x9D71AC8FADA6C9B5ULL, -927, -260 },
+			{ 0xEA9C227723EE8BCBULL, -901, -252 },
+			{ 0xAECC49914078536DULL, -874, -244 },
+			{ 0x823C12795DB6CE57ULL, -847, -236 },
+			{ 0xC21094364DFB5637ULL, -821, -228 },
+			{ 0x9096EA6F3848984FULL, -794, -220 },
+			{ 0xD77485CB25823AC7ULL, -768, -212 },
+			{ 0xA086CFCD97BF97F4ULL, -741, -204 },
+			{ 0xEF340A98172AACE5ULL, -715, -196 },
+			{ 0xB23867FB2A35B28EULL, -688, -188 },
+			{ 0x84C8D4DFD2C63F3BULL, -661, -180 },
+			{ 0xC5DD44271AD3CDBAULL, -635, -172 },
+			{ 0x936B9FCEBB25C996ULL, -608, -164 },
+			{ 0xDBAC6C247D62A584ULL, -582, -156 },
+			{ 0xA3AB66580D5FDAF6ULL, -555, -148 },
+			{ 0xF3E2F893DEC3F126ULL, -529, -140 },
+			{ 0xB5B5ADA8AAFF80B8ULL, -502, -132 },
+			{ 0x87625F056C7C4A8BULL, -475, -124 },
+			{ 0xC9BCFF6034C13053ULL, -449, -116 },
+			{ 0x964E858C91BA2655ULL, -422, -108 },
+			{ 0xDFF9772470297EBDULL, -396, -100 },
+			{ 0xA6DFBD9FB8E5B88FULL, -369, -92 },
+			{ 0xF8A95FCF88747D94ULL, -343, -84 },
+			{ 0xB94470938FA89BCFULL, -316, -76 },
+			{ 0x8A08F0F8BF0F156BULL, -289, -68 },
+			{ 0xCDB02555653131B6ULL, -263, -60 },
+			{ 0x993FE2C6D07B7FACULL, -236, -52 },
+			{ 0xE45C10C42A2B3B06ULL, -210, -44 },
+			{ 0xAA242499697392D3ULL, -183, -36 },
+			{ 0xFD87B5F28300CA0EULL, -157, -28 },
+			{ 0xBCE5086492111AEBULL, -130, -20 },
+			{ 0x8CBCCC096F5088CCULL, -103, -12 },
+			{ 0xD1B71758E219652CULL, -77, -4 },
+			{ 0x9C40000000000000ULL, -50, 4 },
+			{ 0xE8D4A51000000000ULL, -24, 12 },
+			{ 0xAD78EBC5AC620000ULL, 3, 20 },
+			{ 0x813F3978F8940984ULL, 30, 28 },
+			{ 0xC097CE7BC90715B3ULL, 56, 36 },
+			{ 0x8F7E32CE7BEA5C70ULL, 83, 44 },
+			{ 0xD5D238A4ABE98068ULL, 109, 52 },
+			{ 0x9F4F2726179A2245ULL, 136, 60 },
+			{ 0xED63A231D4C4FB27ULL, 162, 68 },
+			{ 0xB0DE65388CC8ADA8ULL, 189, 76 },
+			{ 0x83C7088E1AAB65DBULL, 216, 84 },
+			{ 0xC45D1DF942711D9AULL, 242, 92 },
+			{ 0x924D692CA61BE758ULL, 269, 100 },
+			{ 0xDA01EE641A708DEAULL, 295, 108 },
+			{ 0xA26DA3999AEF774AULL, 322, 116 },
+			{ 0xF209787BB47D6B85ULL, 348, 124 },
+			{ 0xB454E4A179DD1877ULL, 375, 132 },
+			{ 0x865B86925B9BC5C2ULL, 402, 140 },
+			{ 0xC83553C5C8965D3DULL, 428, 148 },
+			{ 0x952AB45CFA97A0B3ULL, 455, 156 },
+			{ 0xDE469FBD99A05FE3ULL, 481, 164 },
+			{ 0xA59BC234DB398C25ULL, 508, 172 },
+			{ 0xF6C69A72A3989F5CULL, 534, 180 },
+			{ 0xB7DCBF5354E9BECEULL, 561, 188 },
+			{ 0x88FCF317F22241E2ULL, 588, 196 },
+			{ 0xCC20CE9BD35C78A5ULL, 614, 204 },
+			{ 0x98165AF37B2153DFULL, 641, 212 },
+			{ 0xE2A0B5DC971F303AULL, 667, 220 },
+			{ 0xA8D9D1535CE3B396ULL, 694, 228 },
+			{ 0xFB9B7CD9A4A7443CULL, 720, 236 },
+			{ 0xBB764C4CA7A44410ULL, 747, 244 },
+			{ 0x8BAB8EEFB6409C1AULL, 774, 252 },
+			{ 0xD01FEF10A657842CULL, 800, 260 },
+			{ 0x9B10A4E5E9913129ULL, 827, 268 },
+			{ 0xE7109BFBA19C0C9DULL, 853, 276 },
+			{ 0xAC2820D9623BF429ULL, 880, 284 },
+			{ 0x80444B5E7AA7CF85ULL, 907, 292 },
+			{ 0xBF21E44003ACDD2DULL, 933, 300 },
+			{ 0x8E679C2F5E44FF8FULL, 960, 308 },
+			{ 0xD433179D9C8CB841ULL, 986, 316 },
+			{ 0x9E19DB92B4E31BA9ULL, 1013, 324 }
+		};
+
+		/**
+		 * @brief return c = 10^k with alpha <= e_c + e + 64 <= gamma
+		 */
+		inline CachedPower getCachedPower(mint32 e)
+		{
+			const mint32 alpha = -60;
+			const mint32 minDecimalExponent = -300;
+			const mint32 decimalStep = 8;
+
+			const mint32 f = alpha - e - 1;
+			const mint32 k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+			const mint32 index = (-minDecimalExponent + k + (decimalStep - 1)) / decimalStep;
+			return cachedPowers[index];
+		}
+
+		/**
+		 * @brief move the last digit toward w, the unit is the largest error of the boundaries
+		 * @return false if the digits might not be the closest or might not be in the interval
+		 */
+		inline bool grisuRoundWeed(char* buffer, mint length, muint64 distanceTooHighW, muint64 unsafeInterval, muint64 rest, muint64 tenK, muint64 unit)
+		{
+			const muint64 smallDistance = distanceTooHighW - unit;
+			const muint64 bigDistance = distanceTooHighW + unit;
+
+			while (rest < smallDistance
+				&& unsafeInterval - rest >= tenK
+				&& (rest + tenK < smallDistance || smallDistance - rest >= rest + tenK - smallDistance))
+			{
+				buffer[length - 1]--;
+				rest += tenK;
+			}
+
+			// another digit might be closer to w within the error
+			if (rest < bigDistance
+				&& unsafeInterval - rest >= tenK
+				&& (rest + tenK < bigDistance || bigDistance - rest > rest + tenK - bigDistance))
+				return false;
+
+			return 2 * unit <= rest && rest <= unsafeInterval - 4 * unit;
+		}
+
+		/**
+		 * @brief generate the shortest digits of w in (low, high)
+		 * @return false if the error of the cached power makes the digits uncertain
+		 */
+		inline bool grisuDigitGen(char* buffer, mint& length, mint& decimalExponent, DiyFp low, DiyFp w, DiyFp high)
+		{
+			muint64 unit = 1;
+			const DiyFp tooLow(low.f - unit, low.e);
+			const DiyFp tooHigh(high.f + unit, high.e);
+			DiyFp unsafeInterval = DiyFp::sub(tooHigh, tooLow);
+
+			const DiyFp one(muint64(1) << -w.e, w.e);
+
+			muint32 p1 = (muint32)(tooHigh.f >> -one.e);
+			muint64 p2 = tooHigh.f & (one.f - 1);
+
+			muint32 pow10;
+			mint n;
+			if (p1 >= 1000000000) { pow10 = 1000000000; n = 10; }
+			else if (p1 >= 100000000) { pow10 = 100000000; n = 9; }
+			else if (p1 >= 10000000) { pow10 = 10000000; n = 8; }
+			else if (p1 >= 1000000) { pow10 = 1000000; n = 7; }
+			else if (p1 >= 100000) { pow10 = 100000; n = 6; }
+			else if (p1 >= 10000) { pow10 = 10000; n = 5; }
+			else if (p1 >= 1000) { pow10 = 1000; n = 4; }
+			else if (p1 >= 100) { pow10 = 100; n = 3; }
+			else if (p1 >= 10) { pow10 = 10; n = 2; }
+			else { pow10 = 1; n = 1; }
+
+			while (n > 0)
+			{
+				const muint32 d = p1 / pow10;
+				const muint32 r = p1 % pow10;
+				buffer[length++] = (char)('0' + d);
+				p1 = r;
+				n--;
+
+				const muint64 rest = (muint64(p1) << -one.e) + p2;
+				if (rest < unsafeInterval.f)
+				{
+					decimalExponent += n;
+					return grisuRoundWeed(buffer, length, DiyFp::sub(tooHigh, w).f, unsafeInterval.f, rest, muint64(pow10) << -one.e, unit);
+				}
+				pow10 /= 10;
+			}
+
+			mint m = 0;
+			for (;;)
+			{
+				p2 *= 10;
+				unit *= 10;
+				unsafeInterval.f *= 10;
+				const muint64 d = p2 >> -one.e;
+				buffer[length++] = (char)('0' + d);
+				p2 &= one.f - 1;
+				m++;
+
+				if (p2 < unsafeInterval.f)
+				{
+					decimalExponent -= m;
+					return grisuRoundWeed(buffer, length, DiyFp::sub(tooHigh, w).f * unit, unsafeInterval.f, p2, one.f, unit);
+				}
+			}
+		}
+
+		/**
+		 * @brief grisu3, write the shortest digits of a positive finite double which round trip
+		 * @return value = digits * 10^decimalExponent, or false in the rare cases where the digits
+		 * can not be proved shortest and closest, then exactShortest() should be used
+		 */
+		inline bool grisu3(double value, char* buffer, mint& length, mint& decimalExponent)
+		{
+			muint64 bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			const muint64 hiddenBit = muint64(1) << 52;
+			const mint32 bias = 1075;
+			const muint64 fraction = bits & (hiddenBit - 1);
+			const mint32 exponent = (mint32)(bits >> 52);
+
+			DiyFp v = exponent == 0
+				? DiyFp(fraction, 1 - bias)
+				: DiyFp(fraction + hiddenBit, exponent - bias);
+
+			const bool lowerBoundaryIsCloser = fraction == 0 && exponent > 1;
+			const DiyFp mPlus(2 * v.f + 1, v.e - 1);
+			const DiyFp mMinus = lowerBoundaryIsCloser
+				? DiyFp(4 * v.f - 1, v.e - 2)
+				: DiyFp(2 * v.f - 1, v.e - 1);
+
+			const DiyFp wPlus = DiyFp::normalize(mPlus);
+			const DiyFp wMinus = DiyFp::normalizeTo(mMinus, wPlus.e);
+			const DiyFp w = DiyFp::normalize(v);
+
+			const CachedPower cached = getCachedPower(wPlus.e);
+			const DiyFp c(cached.f, cached.e);
+
+			const DiyFp cw = DiyFp::mul(w, c);
+			const DiyFp cwMinus = DiyFp::mul(wMinus, c);
+			const DiyFp cwPlus = DiyFp::mul(wPlus, c);
+
+			length = 0;
+			decimalExponent = -cached.k;
+			return grisuDigitGen(buffer, length, decimalExponent, cwMinus, cw, cwPlus);
+		}
+
+		struct LeftCheat
+		{
+			mint		delta;
+			const char*	cutoff;
+		};
+
+		/**
+		 * @brief the number of new digits and the 5^k cutoff of a left shift by k bits
+		 */
+		static const LeftCheat leftCheats[] =
+		{
+			{ 0, "" },
+			{ 1, "5" },
+			{ 1, "25" },
+			{ 1, "125" },
+			{ 2, "625" },
+			{ 2, "3125" },
+			{ 2, "15625" },
+			{ 3, "78125" },
+			{ 3, "390625" },
+			{ 3, "1953125" },
+			{ 4, "9765625" },
+			{ 4, "48828125" },
+			{ 4, "244140625" },
+			{ 4, "1220703125" },
+			{ 5, "6103515625" },
+			{ 5, "30517578125" },
+			{ 5, "152587890625" },
+			{ 6, "762939453125" },
+			{ 6, "3814697265625" },
+			{ 6, "19073486328125" },
+			{ 7, "95367431640625" },
+			{ 7, "476837158203125" },
+			{ 7, "2384185791015625" },
+			{ 7, "11920928955078125" },
+			{ 8, "59604644775390625" },
+			{ 8, "298023223876953125" },
+			{ 8, "1490116119384765625" },
+			{ 9, "7450580596923828125" },
+			{ 9, "37252902984619140625" },
+			{ 9, "186264514923095703125" },
+			{ 10, "931322574615478515625" },
+			{ 10, "4656612873077392578125" },
+			{ 10, "23283064365386962890625" },
+			{ 10, "116415321826934814453125" },
+			{ 11, "582076609134674072265625" },
+			{ 11, "2910383045673370361328125" },
+			{ 11, "14551915228366851806640625" },
+			{ 12, "72759576141834259033203125" },
+			{ 12, "363797880709171295166015625" },
+			{ 12, "1818989403545856475830078125" },
+			{ 13, "9094947017729282379150390625" },
+			{ 13, "45474735088646411895751953125" },
+			{ 13, "227373675443232059478759765625" },
+			{ 13, "1136868377216160297393798828125" },
+			{ 14, "5684341886080801486968994140625" },
+			{ 14, "28421709430404007434844970703125" },
+			{ 14, "142108547152020037174224853515625" },
+			{ 15, "710542735760100185871124267578125" },
+			{ 15, "3552713678800500929355621337890625" },
+			{ 15, "17763568394002504646778106689453125" },
+			{ 16, "88817841970012523233890533447265625" },
+			{ 16, "444089209850062616169452667236328125" },
+			{ 16, "2220446049250313080847263336181640625" },
+			{ 16, "11102230246251565404236316680908203125" },
+			{ 17, "55511151231257827021181583404541015625" },
+			{ 17, "277555756156289135105907917022705078125" },
+			{ 17, "1387778780781445675529539585113525390625" },
+			{ 18, "6938893903907228377647697925567626953125" },
+			{ 18, "34694469519536141888238489627838134765625" },
+			{ 18, "173472347597680709441192448139190673828125" },
+			{ 19, "867361737988403547205962240695953369140625" }
+		};
+
+		/**
+		 * @brief an arbitrary precision decimal number 0.d[0]d[1]...d[nd-1] * 10^dp
+		 * @detail used where exact conversion is needed: parsing numbers that the fast path can
+		 * not handle and formatting with a given precision.
+		 */
+		class Decimal
+		{
+		public:
+			static const mint maxDigits = 800;
+			static const mint maxShift = 60;
+
+			char	d[maxDigits];
+			mint	nd;
+			mint	dp;
+			bool	trunc;
+
+			Decimal()
+				: nd(0), dp(0), trunc(false)
+			{
+			}
+
+			void assign(muint64 v)
+			{
+				char buf[24];
+				mint n = 0;
+				while (v > 0)
+				{
+					muint64 v1 = v / 10;
+					buf[n++] = (char)('0' + (v - 10 * v1));
+					v = v1;
+				}
+
+				nd = 0;
+				for (n--; n >= 0; n--)
+					d[nd++] = buf[n];
+				dp = nd;
+				trim();
+			}
+
+			/**
+			 * @brief multiply by 2^k, k can be negative
+			 */
+			void shift(mint k)
+			{
+				if (nd == 0)
+					return;
+
+				if (k > 0)
+				{
+					for (; k > maxShift; k -= maxShift)
+						leftShift(maxShift);
+					leftShift(k);
+				}
+				else if (k < 0)
+				{
+					for (; k < -maxShift; k += maxShift)
+						rightShift(maxShift);
+					rightShift(-k);
+				}
+			}
+
+			/**
+			 * @brief round to n digits, half to even
+			 */
+			void round(mint n)
+			{
+				if (n < 0 || n >= nd)
+					return;
+				if (shouldRoundUp(n))
+					roundUp(n);
+				else
+					roundDown(n);
+			}
+
+			/**
+			 * @brief return the integer part rounded to nearest, carry is set when it is 2^64
+			 */
+			muint64 roundedInteger(bool& carry) const
+			{
+				carry = false;
+				if (dp > 20)
+				{
+					carry = true;
+					return 0;
+				}
+
+				mint i = 0;
+				muint64 n = 0;
+				for (; i < dp && i < nd; i++)
+					n = n * 10 + (d[i] - '0');
+				for (; i < dp; i++)
+					n *= 10;
+
+				if (shouldRoundUp(dp))
+				{
+					if (n == 0xFFFFFFFFFFFFFFFFull)
+						carry = true;
+					n++;
+				}
+				return n;
+			}
+
+			/**
+			 * @brief convert to a binary floating number
+			 * @param mantissaBits: the number of explicit mantissa bits of the target type
+			 * @param maxExponent: the exponent of the largest finite value plus one
+			 * @return the value, or infinity when overflow
+			 */
+			template<typename TFloat>
+			TFloat toFloat(mint mantissaBits, mint maxExponent)
+			{
+				const mint powTable[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+				const mint powTableSize = sizeof(powTable) / sizeof(mint);
+				const mint bias = -(maxExponent - 1);
+				const mint maxDp = (mint)(maxExponent * 0.30103) + 2;
+				const mint minDp = -(mint)((maxExponent + mantissaBits) * 0.30103) - 8;
+
+				if (nd == 0 || dp < minDp)
+					return 0;
+				if (dp > maxDp)
+					return std::numeric_limits<TFloat>::infinity();
+
+				mint exp = 0;
+				while (dp > 0)
+				{
+					mint n = dp >= powTableSize ? 27 : powTable[dp];
+					shift(-n);
+					exp += n;
+				}
+				while (dp < 0 || (dp == 0 && d[0] < '5'))
+				{
+					mint n = -dp >= powTableSize ? 27 : powTable[-dp];
+					shift(n);
+					exp -= n;
+				}
+
+				// the range is [0.5, 1) but the range of floating numbers is [1, 2)
+				exp--;
+
+				if (exp < bias + 1)
+				{
+					mint n = bias + 1 - exp;
+					shift(-n);
+					exp += n;
+				}
+
+				if (exp - bias >= 2 * maxExponent - 1)
+					return std::numeric_limits<TFloat>::infinity();
+
+				shift(1 + mantissaBits);
+				bool carry;
+				muint64 mantissa = roundedInteger(carry);
+
+				// rounding might have added a bit
+				if (carry || (mantissaBits < 63 && mantissa == (muint64(2) << mantissaBits)))
+				{
+					mantissa = muint64(1) << mantissaBits;
+					exp++;
+					if (exp - bias >= 2 * maxExponent - 1)
+						return std::numeric_limits<TFloat>::infinity();
+				}
+
+				return std::ldexp((TFloat)mantissa, (int)(exp - mantissaBits));
+			}
+
+		private:
+			void trim()
+			{
+				while (nd > 0 && d[nd - 1] == '0')
+					nd--;
+				if (nd == 0)
+					dp = 0;
+			}
+
+			void rightShift(mint k)
+			{
+				mint r = 0;
+				mint w = 0;
+				muint64 n = 0;
+
+				for (; (n >> k) == 0; r++)
+				{
+					if (r >= nd)
+					{
+						if (n == 0)
+						{
+							nd = 0;
+							return;
+						}
+						while ((n >> k) == 0)
+						{
+							n *= 10;
+							r++;
+						}
+						break;
+					}
+					n = n * 10 + (d[r] - '0');
+				}
+				dp -= r - 1;
+
+				const muint64 mask = (muint64(1) << k) - 1;
+
+				for (; r < nd; r++)
+				{
+					char c = d[r];
+					muint64 dig = n >> k;
+					n &= mask;
+					d[w++] = (char)('0' + dig);
+					n = n * 10 + (c - '0');
+				}
+
+				while (n > 0)
+				{
+					muint64 dig = n >> k;
+					n &= mask;
+					if (w < maxDigits)
+						d[w++] = (char)('0' + dig);
+					else if (dig > 0)
+						trunc = true;
+					n *= 10;
+				}
+
+				nd = w;
+				trim();
+			}
+
+			bool prefixIsLessThan(const char* s) const
+			{
+				for (mint i = 0; s[i]; i++)
+				{
+					if (i >= nd)
+						return true;
+					if (d[i] != s[i])
+						return d[i] < s[i];
+				}
+				return false;
+			}
+
+			void leftShift(mint k)
+			{
+				mint delta = leftCheats[k].delta;
+				if (prefixIsLessThan(leftCheats[k].cutoff))
+					delta--;
+
+				mint r = nd;
+				mint w = nd + delta;
+				muint64 n = 0;
+
+				for (r--; r >= 0; r--)
+				{
+					n += muint64(d[r] - '0') << k;
+					muint64 quo = n / 10;
+					muint64 rem = n - 10 * quo;
+					w--;
+					if (w < maxDigits)
+						d[w] = (char)('0' + rem);
+					else if (rem != 0)
+						trunc = true;
+					n = quo;
+				}
+
+				while (n > 0)
+				{
+					muint64 quo = n / 10;
+					muint64 rem = n - 10 * quo;
+					w--;
+					if (w < maxDigits)
+						d[w] = (char)('0' + rem);
+					else if (rem != 0)
+						trunc = true;
+					n = quo;
+				}
+
+				nd += delta;
+				if (nd >= maxDigits)
+					nd = maxDigits;
+				dp += delta;
+				trim();
+			}
+
+			bool shouldRoundUp(mint n) const
+			{
+				if (n < 0 || n >= nd)
+					return false;
+				if (d[n] == '5' && n + 1 == nd)
+				{
+					if (trunc)
+						return true;
+					return n > 0 && (d[n - 1] - '0') % 2 != 0;
+				}
+				return d[n] >= '5';
+			}
+
+			void roundUp(mint n)
+			{
+				for (mint i = n - 1; i >= 0; i--)
+				{
+					if (d[i] < '9')
+					{
+						d[i]++;
+						nd = i + 1;
+						return;
+					}
+				}
+				d[0] = '1';
+				nd = 1;
+				dp++;
+			}
+
+			void roundDown(mint n)
+			{
+				nd = n;
+				trim();
+			}
+		};
+
+		/**
+		 * @brief a non negative integer of at most maxWords * 32 bits, used to check the digits of grisu3
+		 */
+		class Bignum
+		{
+		public:
+			static const mint maxWords = 40;
+
+			Bignum()
+				: size(0)
+			{
+			}
+
+			explicit Bignum(muint64 n)
+				: size(0)
+			{
+				for (; n > 0; n >>= 32)
+					words[size++] = (muint32)n;
+			}
+
+			void multiply(muint64 n)
+			{
+				const muint64 low = n & 0xFFFFFFFFu;
+				const muint64 high = n >> 32;
+
+				muint32 result[maxWords];
+				muint64 carry = 0;
+				mint resultSize = 0;
+				for (mint i = 0; i < size + 2 && i < maxWords; i++)
+				{
+					const muint64 a = i < size ? words[i] : 0;
+					const muint64 b = i > 0 && i <= size ? words[i - 1] : 0;
+					const muint64 p = a * low;
+					const muint64 q = b * high;
+					const muint64 sum = (p & 0xFFFFFFFFu) + (q & 0xFFFFFFFFu) + carry;
+					result[i] = (muint32)sum;
+					carry = (sum >> 32) + (p >> 32) + (q >> 32);
+					if (result[i] != 0)
+						resultSize = i + 1;
+				}
+				memcpy(words, result, sizeof(muint32) * resultSize);
+				size = resultSize;
+			}
+
+			void multiplyPow5(mint n)
+			{
+				// 5^27 is the largest power of 5 in 64 bits
+				for (; n >= 27; n -= 27)
+					multiply(7450580596923828125ull);
+				muint64 rest = 1;
+				for (; n > 0; n--)
+					rest *= 5;
+				multiply(rest);
+			}
+
+			void shiftLeft(mint n)
+			{
+				if (size == 0)
+					return;
+
+				const mint wordShift = n / 32;
+				const mint bitShift = n % 32;
+				if (bitShift > 0 && size < maxWords)
+					words[size++] = 0;
+				for (mint i = size - 1; i >= 0; i--)
+				{
+					muint32 w = words[i] << bitShift;
+					if (bitShift > 0 && i > 0)
+						w |= words[i - 1] >> (32 - bitShift);
+					if (i + wordShift < maxWords)
+						words[i + wordShift] = w;
+				}
+				for (mint i = 0; i < wordShift && i < maxWords; i++)
+					words[i] = 0;
+				size = size + wordShift < maxWords ? size + wordShift : maxWords;
+				while (size > 0 && words[size - 1] == 0)
+					size--;
+			}
+
+			/**
+			 * @brief compare x * n with y, return a negative number, zero or a positive number
+			 */
+			static mint compare(const Bignum& x, muint64 n, const Bignum& y)
+			{
+				Bignum product = x;
+				product.multiply(n);
+				if (product.size != y.size)
+					return product.size < y.size ? -1 : 1;
+				for (mint i = product.size - 1; i >= 0; i--)
+				{
+					if (product.words[i] != y.words[i])
+						return product.words[i] < y.words[i] ? -1 : 1;
+				}
+				return 0;
+			}
+
+		private:
+			muint32	words[maxWords];
+			mint	size;
+		};
+
+		/**
+		 * @brief write the shortest digits of a positive finite double which round trip, exactly
+		 * @param minPrecision: the length of the digits found by grisu3, nothing shorter is in the interval
+		 * @return value = digits * 10^decimalExponent
+		 * @detail used where grisu3 fails. 18 digits of the value are got from the cached power,
+		 * they are off by one at most, so the two digits around the value at each precision are
+		 * among four numbers that are checked against the halfway points with big integers.
+		 */
+		inline void exactShortest(double value, mint minPrecision, char* buffer, mint& length, mint& decimalExponent)
+		{
+			muint64 bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			const muint64 hiddenBit = muint64(1) << 52;
+			const mint32 bias = 1075;
+			const muint64 fraction = bits & (hiddenBit - 1);
+			const mint32 exponent = (mint32)(bits >> 52);
+
+			const DiyFp v = exponent == 0
+				? DiyFp(fraction, 1 - bias)
+				: DiyFp(fraction + hiddenBit, exponent - bias);
+			const DiyFp w = DiyFp::normalize(v);
+			const CachedPower cached = getCachedPower(w.e);
+			const DiyFp cw = DiyFp::mul(w, DiyFp(cached.f, cached.e));
+
+			// the first 18 digits of cw, the value is about digits * 10^scale
+			const mint32 shift = -cw.e;
+			const muint64 mask = (muint64(1) << shift) - 1;
+			muint64 digits = cw.f >> shift;
+			muint64 rest = cw.f & mask;
+			mint integerDigits = 0;
+			for (muint64 n = digits; n > 0; n /= 10)
+				integerDigits++;
+			for (mint i = integerDigits; i < 18; i++)
+			{
+				rest *= 10;
+				digits = digits * 10 + (rest >> shift);
+				rest &= mask;
+			}
+			const mint scale = -cached.k - (18 - integerDigits);
+
+			// 2 * candidate * 10^scale is compared with 2 * boundary * 2^(v.e - 2) as left * y and right * m
+			const mint binaryExponent = v.e - 2;
+			Bignum left(1);
+			Bignum right(1);
+			if (scale > 0)
+				left.multiplyPow5(scale);
+			else
+				right.multiplyPow5(-scale);
+			if (scale > binaryExponent)
+				left.shiftLeft(scale - binaryExponent);
+			else
+				right.shiftLeft(binaryExponent - scale);
+
+			const bool lowerBoundaryIsCloser = fraction == 0 && exponent > 1;
+			Bignum lower = right;
+			lower.multiply(2 * (lowerBoundaryIsCloser ? 4 * v.f - 1 : 4 * v.f - 2));
+			Bignum upper = right;
+			upper.multiply(2 * (4 * v.f + 2));
+			Bignum exact = right;
+			exact.multiply(8 * v.f);
+
+			// a halfway point reads back to the value when its mantissa is even
+			const mint inclusive = v.f % 2 == 0 ? 1 : 0;
+
+			if (minPrecision < 1)
+				minPrecision = 1;
+			muint64 pow10 = 1;
+			for (mint i = minPrecision; i < 18; i++)
+				pow10 *= 10;
+
+			for (mint precision = minPrecision; precision <= 18; precision++, pow10 /= 10)
+			{
+				const muint64 q = digits / pow10;
+				muint64 best = 0;
+				for (muint64 x = q - 1; x <= q + 2; x++)
+				{
+					const muint64 y = 2 * x * pow10;
+					if (x == 0
+						|| Bignum::compare(left, y, lower) + inclusive <= 0
+						|| Bignum::compare(left, y, upper) >= inclusive)
+						continue;
+
+					if (best == 0)
+						best = x;
+					else
+					{
+						// keep the closest, the even one at a tie
+						const mint c = Bignum::compare(left, (2 * best + 1) * pow10, exact);
+						if (c < 0 || (c == 0 && best % 2 != 0))
+							best = x;
+					}
+				}
+
+				if (best > 0)
+				{
+					char temp[24];
+					char* first = writeUnsigned(best, temp + 24, 10);
+					length = temp + 24 - first;
+					memcpy(buffer, first, length);
+					decimalExponent = scale + 18 - precision;
+					return;
+				}
+			}
+		}
+
+		/**
+		 * @brief write digits * 10^(exponent - length + 1) in the style of %g
+		 * @param exponent: the decimal exponent of the first digit
+		 * @param precision: fixed notation is used when -4 <= exponent < precision
+		 */
+		template<typename TChar>
+		inline size_t writeDecimal(bool negative, const char* digits, mint length, mint exponent, mint precision, TChar* buffer)
+		{
+			TChar* p = buffer;
+			if (negative)
+				*p++ = '-';
+
+			while (length > 1 && digits[length - 1] == '0')
+				length--;
+
+			if (exponent >= -4 && exponent < precision)
+			{
+				if (exponent < 0)
+				{
+					*p++ = '0';
+					*p++ = '.';
+					for (mint i = -1; i > exponent; i--)
+						*p++ = '0';
+					for (mint i = 0; i < length; i++)
+						*p++ = (TChar)digits[i];
+				}
+				else
+				{
+					for (mint i = 0; i <= exponent; i++)
+						*p++ = (TChar)(i < length ? digits[i] : '0');
+					if (length > exponent + 1)
+					{
+						*p++ = '.';
+						for (mint i = exponent + 1; i < length; i++)
+							*p++ = (TChar)digits[i];
+					}
+				}
+			}
+			else
+			{
+				*p++ = (TChar)digits[0];
+				if (length > 1)
+				{
+					*p++ = '.';
+					for (mint i = 1; i < length; i++)
+						*p++ = (TChar)digits[i];
+				}
+				*p++ = 'e';
+				*p++ = exponent < 0 ? '-' : '+';
+				muint32 e = (muint32)(exponent < 0 ? -exponent : exponent);
+				if (e < 10)
+					*p++ = '0';
+				TChar temp[8];
+				TChar* q = writeUnsigned(e, temp + 8, 10);
+				while (q < temp + 8)
+					*p++ = *q++;
+			}
+			return p - buffer;
+		}
+
+		template<typename TChar>
+		inline size_t writeSpecial(double value, TChar* buffer)
+		{
+			const char* s = value != value ? "nan" : value < 0 ? "-inf" : "inf";
+			size_t n = 0;
+			for (; s[n]; n++)
+				buffer[n] = (TChar)s[n];
+			return n;
+		}
+
+		/**
+		 * @brief format a finite floating number with a given number of significant digits, exactly
+		 */
+		template<typename TFloat, typename TChar>
+		inline size_t formatFloatPrecision(TFloat value, mint precision, TChar* buffer)
+		{
+			bool negative = std::signbit(value);
+			if (negative)
+				value = -value;
+
+			char digits[64];
+			mint length = 1;
+			mint exponent = 0;
+			digits[0] = '0';
+
+			if (value != 0)
+			{
+				int e;
+				TFloat m = std::frexp(value, &e);
+				muint64 mantissa = (muint64)std::ldexp(m, 64);
+
+				Decimal decimal;
+				decimal.assign(mantissa);
+				decimal.shift(e - 64);
+				decimal.round(precision);
+				length = decimal.nd;
+				exponent = decimal.dp - 1;
+				memcpy(digits, decimal.d, length);
+			}
+
+			return writeDecimal(negative, digits, length, exponent, precision, buffer);
+		}
+
+		/**
+		 * @brief scan a decimal floating number, the digits are stored in a Decimal if needed
+		 * @return false if there is no number
+		 */
+		template<typename TChar>
+		inline bool scanFloat(const TChar*& p, const TChar* end, bool& negative, muint64& mantissa, mint& exponent, bool& exact, mint& special)
+		{
+			special = 0;
+			negative = false;
+			mantissa = 0;
+			exponent = 0;
+			exact = true;
+
+			while (p < end && isSpace(*p))
+				p++;
+			if (p < end && (*p == '+' || *p == '-'))
+			{
+				negative = *p == '-';
+				p++;
+			}
+
+			if (matchWord(p, end, "inf"))
+			{
+				p += matchWord(p, end, "infinity") ? 8 : 3;
+				special = 1;
+				return true;
+			}
+			if (matchWord(p, end, "nan"))
+			{
+				p += 3;
+				special = 2;
+				return true;
+			}
+
+			mint digits = 0;
+			mint dotPosition = -1;
+			mint total = 0;
+			bool any = false;
+
+			for (; p < end; p++)
+			{
+				muint32 c = (muint32)(typename std::make_unsigned<TChar>::type)*p;
+				if (c - '0' < 10)
+				{
+					any = true;
+					if (c == '0' && digits == 0)
+					{
+						total++;
+						if (dotPosition >= 0)
+							exponent--;
+						continue;
+					}
+					if (digits < 19)
+					{
+						mantissa = mantissa * 10 + (c - '0');
+						digits++;
+						if (dotPosition >= 0)
+							exponent--;
+					}
+					else
+					{
+						if (c != '0')
+							exact = false;
+						if (dotPosition < 0)
+							exponent++;
+					}
+					total++;
+				}
+				else if (c == '.' && dotPosition < 0)
+				{
+					dotPosition = total;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			if (!any)
+				return false;
+
+			if (p < end && (*p == 'e' || *p == 'E'))
+			{
+				const TChar* q = p + 1;
+				bool negativeExponent = false;
+				if (q < end && (*q == '+' || *q == '-'))
+				{
+					negativeExponent = *q == '-';
+					q++;
+				}
+				if (q < end && digitValue(*q) < 10)
+				{
+					mint e = 0;
+					for (; q < end && digitValue(*q) < 10; q++)
+					{
+						if (e < 100000)
+							e = e * 10 + digitValue(*q);
+					}
+					exponent += negativeExponent ? -e : e;
+					p = q;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief fill a Decimal from the digits of a scanned number
+		 */
+		template<typename TChar>
+		inline void fillDecimal(const TChar* p, const TChar* end, Decimal& decimal)
+		{
+			decimal.nd = 0;
+			decimal.dp = 0;
+			decimal.trunc = false;
+			bool sawDot = false;
+
+			while (p < end && isSpace(*p))
+				p++;
+			if (p < end && (*p == '+' || *p == '-'))
+				p++;
+
+			for (; p < end; p++)
+			{
+				muint32 c = (muint32)(typename std::make_unsigned<TChar>::type)*p;
+				if (c == '.' && !sawDot)
+				{
+					sawDot = true;
+					decimal.dp = decimal.nd;
+					continue;
+				}
+				if (c - '0' >= 10)
+					break;
+
+				if (c == '0' && decimal.nd == 0)
+				{
+					decimal.dp--;
+					continue;
+				}
+				if (decimal.nd < Decimal::maxDigits)
+					decimal.d[decimal.nd++] = (char)c;
+				else if (c != '0')
+					decimal.trunc = true;
+			}
+			if (!sawDot)
+				decimal.dp = decimal.nd;
+
+			if (p < end && (*p == 'e' || *p == 'E'))
+			{
+				const TChar* q = p + 1;
+				bool negativeExponent = false;
+				if (q < end && (*q == '+' || *q == '-'))
+				{
+					negativeExponent = *q == '-';
+					q++;
+				}
+				mint e = 0;
+				for (; q < end && digitValue(*q) < 10; q++)
+				{
+					if (e < 100000)
+						e = e * 10 + digitValue(*q);
+				}
+				decimal.dp += negativeExponent ? -e : e;
+			}
+
+			while (decimal.nd > 0 && decimal.d[decimal.nd - 1] == '0')
+				decimal.nd--;
+			if (decimal.nd == 0)
+				decimal.dp = 0;
+		}
+
+		template<typename TFloat, typename TChar>
+		inline TFloat parseFloat(const TChar* begin, const TChar* end, const TChar** stop)
+		{
+			const TChar* p = begin;
+			bool negative;
+			muint64 mantissa;
+			mint exponent;
+			bool exact;
+			mint special;
+
+			if (!scanFloat(p, end, negative, mantissa, exponent, exact, special))
+			{
+				if (stop) *stop = begin;
+				return 0;
+			}
+			if (stop) *stop = p;
+
+			if (special == 1)
+				return negative ? -std::numeric_limits<TFloat>::infinity() : std::numeric_limits<TFloat>::infinity();
+			if (special == 2)
+				return std::numeric_limits<TFloat>::quiet_NaN();
+
+			if (mantissa == 0)
+				return negative ? -(TFloat)0 : (TFloat)0;
+
+			// exact when both the mantissa and the power of ten are representable
+			if (std::is_same<TFloat, double>::value && exact && (mantissa >> 53) == 0 && exponent >= -22 && exponent <= 22 + 15)
+			{
+				static const double pow10[] =
+				{
+					1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+					1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+				};
+
+				double value = (double)mantissa;
+				bool fast = true;
+				if (exponent < 0)
+				{
+					value /= pow10[-exponent];
+				}
+				else if (exponent > 22)
+				{
+					double scaled = value * pow10[exponent - 22];
+					if (scaled > 9007199254740992.0)
+						fast = false;
+					else
+						value = scaled * pow10[22];
+				}
+				else
+				{
+					value *= pow10[exponent];
+				}
+
+				if (fast)
+					return (TFloat)(negative ? -value : value);
+			}
+
+			Decimal decimal;
+			fillDecimal(begin, end, decimal);
+			TFloat value = decimal.template toFloat<TFloat>(std::numeric_limits<TFloat>::digits - 1, std::numeric_limits<TFloat>::max_exponent);
+			return negative ? -value : value;
+		}
+	}
+
+	static const size_t maxIntegerLength = 66;
+	static const size_t maxFloatPrecision = 40;
+	static const size_t maxFloatLength = maxFloatPrecision + 16;
+
+	/**
+	 * @brief write an integer without a zero terminator
+	 * @param value: the integer
+	 * @param buffer: the output buffer, it should be able to contain maxIntegerLength characters
+	 * @param radix: the radix from 2 to 36, letters are in upper case
+	 * @return the number of characters written
+	 */
+	template<typename TChar, typename TInt>
+	inline typename std::enable_if<std::is_integral<TInt>::value, size_t>::type
+		formatInteger(TInt value, TChar* buffer, mint radix = 10)
+	{
+		if (radix < 2 || radix > 36)
+		{
+			buffer[0] = '0';
+			return 1;
+		}
+
+		TChar temp[maxIntegerLength];
+		TChar* end = temp + maxIntegerLength;
+		bool negative = value < 0;
+		muint64 n = negative ? 0 - (muint64)(mint64)value : (muint64)value;
+
+		TChar* p = NumberConvert_Internal::writeUnsigned(n, end, radix);
+		if (negative)
+			*--p = '-';
+
+		size_t length = end - p;
+		for (size_t i = 0; i < length; i++)
+			buffer[i] = p[i];
+		return length;
+	}
+
+	/**
+	 * @brief write a floating number without a zero terminator
+	 * @param value: the floating number
+	 * @param buffer: the output buffer, it should be able to contain maxFloatLength characters
+	 * @param precision: the number of significant digits (like %g), 0 means the shortest
+	 * representation that parses back to the same value
+	 * @return the number of characters written
+	 */
+	template<typename TChar>
+	inline size_t formatDouble(double value, TChar* buffer, mint precision = 0)
+	{
+		if (!std::isfinite(value))
+			return NumberConvert_Internal::writeSpecial(value, buffer);
+
+		if (precision > 0)
+		{
+			if (precision > (mint)maxFloatPrecision)
+				precision = maxFloatPrecision;
+			return NumberConvert_Internal::formatFloatPrecision(value, precision, buffer);
+		}
+
+		bool negative = std::signbit(value);
+		if (value == 0)
+			return NumberConvert_Internal::writeDecimal(negative, "0", 1, 0, 17, buffer);
+
+		char digits[32];
+		mint length = 0;
+		mint exponent = 0;
+		if (!NumberConvert_Internal::grisu3(negative ? -value : value, digits, length, exponent))
+			NumberConvert_Internal::exactShortest(negative ? -value : value, length, digits, length, exponent);
+		return NumberConvert_Internal::writeDecimal(negative, digits, length, exponent + length - 1, 17, buffer);
+	}
+
+	/**
+	 * @brief write a long double number without a zero terminator
+	 * @param precision: the number of significant digits, 0 means enough digits to round trip
+	 */
+	template<typename TChar>
+	inline size_t formatLongDouble(long double value, TChar* buffer, mint precision = 0)
+	{
+		if (!std::isfinite(value))
+			return NumberConvert_Internal::writeSpecial((double)value, buffer);
+
+		if (precision <= 0)
+			precision = std::numeric_limits<long double>::max_digits10;
+		if (precision > (mint)maxFloatPrecision)
+			precision = maxFloatPrecision;
+		return NumberConvert_Internal::formatFloatPrecision(value, precision, buffer);
+	}
+
+	/**
+	 * @brief parse an integer in the style of strtol without locale
+	 * @param begin: the first character
+	 * @param end: the end of the characters
+	 * @param radix: the radix from 2 to 36, or 0 to detect it from the prefix "0x" or "0"
+	 * @param stop: receive the position after the number, or begin if there is no number
+	 * @detail the leading spaces are skipped, the result is clamped into the range of TInt.
+	 */
+	template<typename TInt, typename TChar>
+	inline TInt parseInteger(const TChar* begin, const TChar* end, mint radix = 10, const TChar** stop = nullptr)
+	{
+		const TChar* p = begin;
+		while (p < end && NumberConvert_Internal::isSpace(*p))
+			p++;
+
+		bool negative = false;
+		if (p < end && (*p == '+' || *p == '-'))
+		{
+			negative = *p == '-';
+			p++;
+		}
+
+		if ((radix == 0 || radix == 16) && end - p > 2 && p[0] == '0' && (p[1] | 0x20) == 'x'
+			&& NumberConvert_Internal::digitValue(p[2]) < 16)
+		{
+			p += 2;
+			radix = 16;
+		}
+		else if (radix == 0)
+		{
+			radix = (p < end && *p == '0') ? 8 : 10;
+		}
+
+		if (radix < 2 || radix > 36)
+		{
+			if (stop) *stop = begin;
+			return 0;
+		}
+
+		const muint64 limit = (std::is_signed<TInt>::value && negative)
+			? (muint64)0 - (muint64)(mint64)std::numeric_limits<TInt>::min()
+			: (muint64)std::numeric_limits<TInt>::max();
+		const muint64 cutoff = limit / radix;
+		const muint32 cutlim = (muint32)(limit % radix);
+
+		const TChar* digits = p;
+		muint64 n = 0;
+		bool overflow = false;
+		for (; p < end; p++)
+		{
+			muint32 d = NumberConvert_Internal::digitValue(*p);
+			if (d >= (muint32)radix)
+				break;
+			if (n > cutoff || (n == cutoff && d > cutlim))
+				overflow = true;
+			else
+				n = n * radix + d;
+		}
+
+		if (p == digits)
+		{
+			if (stop) *stop = begin;
+			return 0;
+		}
+		if (stop) *stop = p;
+
+		if (std::is_signed<TInt>::value)
+		{
+			if (overflow)
+				return negative ? std::numeric_limits<TInt>::min() : std::numeric_limits<TInt>::max();
+			return negative ? (TInt)(0 - n) : (TInt)n;
+		}
+		else
+		{
+			if (overflow)
+				return std::numeric_limits<TInt>::max();
+			return negative ? (TInt)(0 - n) : (TInt)n;
+		}
+	}
+
+	/**
+	 * @brief parse a floating number in the style of strtod without locale, correctly rounded
+	 * @param stop: receive the position after the number, or begin if there is no number
+	 */
+	template<typename TChar>
+	inline double parseDouble(const TChar* begin, const TChar* end, const TChar** stop = nullptr)
+	{
+		return NumberConvert_Internal::parseFloat<double>(begin, end, stop);
+	}
+
+	template<typename TChar>
+	inline long double parseLongDouble(const TChar* begin, const TChar* end, const TChar** stop = nullptr)
+	{
+		return NumberConvert_Internal::parseFloat<long double>(begin, end, stop);
+	}
+}
+
+#endif
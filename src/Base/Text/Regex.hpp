@@ -0,0 +1,1220 @@
+#ifndef MoeLP_Base_Regex
+#define MoeLP_Base_Regex
+
+#include "../Base.hpp"
+#include "Text.hpp"
+#include "TextView.hpp"
+#include "Unicode.hpp"
+
+#include <vector>
+#include <map>
+#include <unordered_set>
+#include <algorithm>
+
+namespace MoeLP
+{
+	namespace Regex_Internal
+	{
+		/**
+		 * @brief an inclusive range of utf-16 code units
+		 */
+		struct CharRange
+		{
+			muint16 first;
+			muint16 last;
+
+			bool operator<(const CharRange& range) const
+			{
+				return first < range.first || (first == range.first && last < range.last);
+			}
+		};
+
+		typedef std::vector<CharRange> CharSet;
+
+		inline void addRange(CharSet& set, muint32 first, muint32 last)
+		{
+			CharRange range = { (muint16)first, (muint16)last };
+			set.push_back(range);
+		}
+
+		/**
+		 * @brief sort the ranges and merge the overlapping or adjacent ones
+		 */
+		inline void normalizeSet(CharSet& set)
+		{
+			std::sort(set.begin(), set.end());
+			size_t n = 0;
+			for (size_t i = 0; i < set.size(); i++)
+			{
+				if (n > 0 && (muint32)set[i].first <= (muint32)set[n - 1].last + 1)
+				{
+					if (set[i].last > set[n - 1].last)
+						set[n - 1].last = set[i].last;
+				}
+				else
+				{
+					set[n++] = set[i];
+				}
+			}
+			set.resize(n);
+		}
+
+		inline CharSet complementSet(const CharSet& set)
+		{
+			CharSet result;
+			muint32 next = 0;
+			for (size_t i = 0; i < set.size(); i++)
+			{
+				if (set[i].first > next)
+					addRange(result, next, set[i].first - 1);
+				next = (muint32)set[i].last + 1;
+			}
+			if (next <= 0xFFFF)
+				addRange(result, next, 0xFFFF);
+			return result;
+		}
+
+		/**
+		 * @brief a node of the syntax tree of a pattern
+		 */
+		struct RegexNode
+		{
+			enum Kind
+			{
+				Empty,
+				Set,
+				Concat,
+				Alternate,
+				Repeat
+			};
+
+			Kind				kind;
+			CharSet				set;
+			std::vector<mint>	children;
+			mint				min;
+			mint				max;	// -1 means no upper bound
+		};
+
+		/**
+		 * @brief parse a pattern into a syntax tree
+		 * @detail the syntax:
+		 * x y			concatenation
+		 * x|y			alternation
+		 * x* x+ x?		repetition
+		 * x{n} x{n,} x{n,m}
+		 * (x) (?:x)	grouping, there are no captures
+		 * .			any code unit except '\n'
+		 * [a-z] [^a-z]	character classes
+		 * \d \w \s		[0-9], [0-9A-Za-z_], white spaces, and \D \W \S for the complements
+		 * \p{Name}		a CharacterClass, e.g. \p{Han}, \p{Letter}, \p{Digit}, \P{Name} for the complement
+		 * \uXXXX \t \n \r \f \v, and \ before any other character matches the character itself
+		 */
+		class RegexParser
+		{
+		public:
+			static const mint maxRepeat = 1000;
+
+			RegexParser(const muint16* pattern, size_t length, std::vector<RegexNode>& nodes)
+				: pattern(pattern),
+				length(length),
+				position(0),
+				nodes(nodes)
+			{
+			}
+
+			mint parse()
+			{
+				mint root = parseAlternate();
+				check(position == length);
+				return root;
+			}
+
+		private:
+			const muint16*			pattern;
+			size_t					length;
+			size_t					position;
+			std::vector<RegexNode>&	nodes;
+
+			static void check(bool condition)
+			{
+				MOE_ERROR(condition, "RegexParser::parse(): The pattern is not a valid regular expression.");
+			}
+
+			bool peek(muint16 c) const
+			{
+				return position < length && pattern[position] == c;
+			}
+
+			mint newNode(RegexNode::Kind kind)
+			{
+				RegexNode node;
+				node.kind = kind;
+				node.min = 0;
+				node.max = 0;
+				nodes.push_back(node);
+				return (mint)nodes.size() - 1;
+			}
+
+			mint newSet(const CharSet& set)
+			{
+				mint node = newNode(RegexNode::Set);
+				nodes[node].set = set;
+				normalizeSet(nodes[node].set);
+				return node;
+			}
+
+			mint parseAlternate()
+			{
+				mint first = parseConcat();
+				if (!peek(L'|'))
+					return first;
+
+				mint node = newNode(RegexNode::Alternate);
+				nodes[node].children.push_back(first);
+				while (peek(L'|'))
+				{
+					position++;
+					mint next = parseConcat();
+					nodes[node].children.push_back(next);
+				}
+				return node;
+			}
+
+			mint parseConcat()
+			{
+				std::vector<mint> children;
+				while (position < length && pattern[position] != L'|' && pattern[position] != L')')
+					children.push_back(parseRepeat());
+
+				if (children.size() == 0)
+					return newNode(RegexNode::Empty);
+				if (children.size() == 1)
+					return children[0];
+
+				mint node = newNode(RegexNode::Concat);
+				nodes[node].children = children;
+				return node;
+			}
+
+			mint parseRepeat()
+			{
+				mint atom = parseAtom();
+				for (;;)
+				{
+					mint min, max;
+					if (peek(L'*'))
+					{
+						min = 0;
+						max = -1;
+						position++;
+					}
+					else if (peek(L'+'))
+					{
+						min = 1;
+						max = -1;
+						position++;
+					}
+					else if (peek(L'?'))
+					{
+						min = 0;
+						max = 1;
+						position++;
+					}
+					else if (!parseBounds(min, max))
+					{
+						return atom;
+					}
+
+					mint node = newNode(RegexNode::Repeat);
+					nodes[node].children.push_back(atom);
+					nodes[node].min = min;
+					nodes[node].max = max;
+					atom = node;
+				}
+			}
+
+			/**
+			 * @brief parse {n}, {n,} or {n,m}, a '{' that does not start a bound is a literal
+			 */
+			bool parseBounds(mint& min, mint& max)
+			{
+				if (!peek(L'{'))
+					return false;
+
+				size_t start = position;
+				position++;
+				if (!parseNumber(min))
+				{
+					position = start;
+					return false;
+				}
+
+				max = min;
+				if (peek(L','))
+				{
+					position++;
+					if (!parseNumber(max))
+						max = -1;
+				}
+
+				if (!peek(L'}'))
+				{
+					position = start;
+					return false;
+				}
+				position++;
+
+				check(min <= maxRepeat && max <= maxRepeat && (max == -1 || min <= max));
+				return true;
+			}
+
+			bool parseNumber(mint& n)
+			{
+				size_t start = position;
+				n = 0;
+				while (position < length && pattern[position] >= L'0' && pattern[position] <= L'9' && n <= maxRepeat)
+					n = n * 10 + (pattern[position++] - L'0');
+				return position > start;
+			}
+
+			mint parseAtom()
+			{
+				check(position < length);
+				muint16 c = pattern[position++];
+				CharSet set;
+
+				switch (c)
+				{
+				case L'(':
+				{
+					if (position + 1 < length && pattern[position] == L'?' && pattern[position + 1] == L':')
+						position += 2;
+					mint node = parseAlternate();
+					check(peek(L')'));
+					position++;
+					return node;
+				}
+				case L'[':
+					parseClass(set);
+					return newSet(set);
+				case L'.':
+					addRange(set, 0x0000, 0x0009);
+					addRange(set, 0x000B, 0xFFFF);
+					return newSet(set);
+				case L'\\':
+					if (parseEscape(set))
+						return newSet(set);
+					c = set[0].first;
+					break;
+				case L'*':
+				case L'+':
+				case L'?':
+				case L')':
+					check(false);
+					break;
+				}
+
+				if (c >= 0xD800 && c <= 0xDBFF && position < length && pattern[position] >= 0xDC00 && pattern[position] <= 0xDFFF)
+				{
+					// a surrogate pair is one atom, so a quantifier applies to both code units
+					CharSet low;
+					addRange(low, pattern[position], pattern[position]);
+					position++;
+					addRange(set, c, c);
+					mint node = newNode(RegexNode::Concat);
+					mint first = newSet(set);
+					mint second = newSet(low);
+					nodes[node].children.push_back(first);
+					nodes[node].children.push_back(second);
+					return node;
+				}
+
+				set.clear();
+				addRange(set, c, c);
+				return newSet(set);
+			}
+
+			/**
+			 * @brief parse a class after '['
+			 */
+			void parseClass(CharSet& set)
+			{
+				bool negative = false;
+				if (peek(L'^'))
+				{
+					negative = true;
+					position++;
+				}
+
+				bool first = true;
+				while (position < length && (pattern[position] != L']' || first))
+				{
+					first = false;
+					muint32 low;
+					if (!parseClassCharacter(set, low))
+						continue;
+
+					if (position + 1 < length && pattern[position] == L'-' && pattern[position + 1] != L']')
+					{
+						position++;
+						muint32 high;
+						check(parseClassCharacter(set, high) && low <= high);
+						addRange(set, low, high);
+					}
+					else
+					{
+						addRange(set, low, low);
+					}
+				}
+				check(peek(L']'));
+				position++;
+
+				normalizeSet(set);
+				if (negative)
+					set = complementSet(set);
+			}
+
+			/**
+			 * @brief parse one character of a class, or add a predefined class to the set and return false
+			 */
+			bool parseClassCharacter(CharSet& set, muint32& c)
+			{
+				check(position < length);
+				c = pattern[position++];
+				if (c != L'\\')
+				{
+					check(c < 0xD800 || c > 0xDFFF);	// classes only contain the basic multilingual plane
+					return true;
+				}
+
+				CharSet escaped;
+				if (parseEscape(escaped))
+				{
+					set.insert(set.end(), escaped.begin(), escaped.end());
+					return false;
+				}
+				c = escaped[0].first;
+				return true;
+			}
+
+			/**
+			 * @brief parse an escape after '\', return true for a predefined class and
+			 * false for a single character which is stored as the only range of set
+			 */
+			bool parseEscape(CharSet& set)
+			{
+				check(position < length);
+				muint16 c = pattern[position++];
+				switch (c)
+				{
+				case L'd':
+				case L'D':
+					addRange(set, L'0', L'9');
+					break;
+				case L'w':
+				case L'W':
+					addRange(set, L'0', L'9');
+					addRange(set, L'A', L'Z');
+					addRange(set, L'a', L'z');
+					addRange(set, L'_', L'_');
+					break;
+				case L's':
+				case L'S':
+					addRange(set, 0x0009, 0x000D);
+					addRange(set, 0x001C, 0x0020);
+					addRange(set, 0x0085, 0x0085);
+					addRange(set, 0x00A0, 0x00A0);
+					addRange(set, 0x1680, 0x1680);
+					addRange(set, 0x2000, 0x200A);
+					addRange(set, 0x2028, 0x2029);
+					addRange(set, 0x202F, 0x202F);
+					addRange(set, 0x205F, 0x205F);
+					addRange(set, 0x3000, 0x3000);
+					break;
+				case L'p':
+				case L'P':
+					parseProperty(set);
+					break;
+				case L'u':
+				{
+					check(position + 4 <= length);
+					muint32 code = 0;
+					for (size_t i = 0; i < 4; i++)
+					{
+						muint16 h = pattern[position++];
+						mint digit = h >= L'0' && h <= L'9' ? h - L'0' : h >= L'a' && h <= L'f' ? h - L'a' + 10 : h >= L'A' && h <= L'F' ? h - L'A' + 10 : -1;
+						check(digit >= 0);
+						code = code * 16 + (muint32)digit;
+					}
+					addRange(set, code, code);
+					return false;
+				}
+				case L't': addRange(set, L'\t', L'\t'); return false;
+				case L'n': addRange(set, L'\n', L'\n'); return false;
+				case L'r': addRange(set, L'\r', L'\r'); return false;
+				case L'f': addRange(set, L'\f', L'\f'); return false;
+				case L'v': addRange(set, L'\v', L'\v'); return false;
+				default:
+					addRange(set, c, c);
+					return false;
+				}
+
+				normalizeSet(set);
+				if (c == L'D' || c == L'W' || c == L'S' || c == L'P')
+					set = complementSet(set);
+				return true;
+			}
+
+			void parseProperty(CharSet& set)
+			{
+				static const wchar_t* names[] =
+				{
+					L"Other", L"Space", L"Digit", L"Number", L"Letter", L"Han",
+					L"Kana", L"Hangul", L"Punctuation", L"Symbol", L"Mark"
+				};
+
+				check(peek(L'{'));
+				size_t start = ++position;
+				while (position < length && pattern[position] != L'}')
+					position++;
+				check(position < length);
+				size_t nameLength = position - start;
+				position++;
+
+				mint found = -1;
+				for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+				{
+					size_t j = 0;
+					while (j < nameLength && names[i][j] && (wchar_t)pattern[start + j] == names[i][j])
+						j++;
+					if (j == nameLength && names[i][j] == 0)
+						found = (mint)i;
+				}
+				check(found >= 0);
+
+				for (muint32 c = 0; c <= 0xFFFF; c++)
+				{
+					if (c >= 0xD800 && c <= 0xDFFF)
+						continue;
+					if (Unicode::characterClass(c) == (CharacterClass)found)
+					{
+						muint32 first = c;
+						while (c < 0xFFFF && !(c + 1 >= 0xD800 && c + 1 <= 0xDFFF) && Unicode::characterClass(c + 1) == (CharacterClass)found)
+							c++;
+						addRange(set, first, c);
+					}
+				}
+			}
+		};
+
+		/**
+		 * @brief a Thompson automaton of all patterns
+		 * @detail a state has either epsilon transitions or one transition on a set of code
+		 * unit classes. accept is the index of the pattern accepted by the state, or -1.
+		 */
+		struct NfaState
+		{
+			std::vector<mint>	epsilons;
+			mint				set;		// index of the transition set, or -1
+			mint				target;
+			mint				accept;
+		};
+
+		class Nfa
+		{
+		public:
+			std::vector<NfaState>	states;
+			std::vector<CharSet>	sets;
+			mint					start;
+
+			Nfa()
+			{
+				start = newState();
+			}
+
+			/**
+			 * @brief add the syntax tree of a pattern
+			 */
+			void add(const std::vector<RegexNode>& nodes, mint root, mint pattern)
+			{
+				mint first, last;
+				compile(nodes, root, first, last);
+				states[start].epsilons.push_back(first);
+				states[last].accept = pattern;
+			}
+
+		private:
+			mint newState()
+			{
+				NfaState state;
+				state.set = -1;
+				state.target = -1;
+				state.accept = -1;
+				states.push_back(state);
+				return (mint)states.size() - 1;
+			}
+
+			void compile(const std::vector<RegexNode>& nodes, mint index, mint& first, mint& last)
+			{
+				const RegexNode& node = nodes[index];
+				switch (node.kind)
+				{
+				case RegexNode::Empty:
+					first = last = newState();
+					break;
+				case RegexNode::Set:
+					first = newState();
+					last = newState();
+					states[first].set = (mint)sets.size();
+					states[first].target = last;
+					sets.push_back(node.set);
+					break;
+				case RegexNode::Concat:
+					compile(nodes, node.children[0], first, last);
+					for (size_t i = 1; i < node.children.size(); i++)
+					{
+						mint f, l;
+						compile(nodes, node.children[i], f, l);
+						states[last].epsilons.push_back(f);
+						last = l;
+					}
+					break;
+				case RegexNode::Alternate:
+					first = newState();
+					last = newState();
+					for (size_t i = 0; i < node.children.size(); i++)
+					{
+						mint f, l;
+						compile(nodes, node.children[i], f, l);
+						states[first].epsilons.push_back(f);
+						states[l].epsilons.push_back(last);
+					}
+					break;
+				case RegexNode::Repeat:
+				{
+					first = last = newState();
+					for (mint i = 0; i < node.min; i++)
+					{
+						mint f, l;
+						compile(nodes, node.children[0], f, l);
+						states[last].epsilons.push_back(f);
+						last = l;
+					}
+
+					if (node.max == -1)
+					{
+						mint f, l;
+						compile(nodes, node.children[0], f, l);
+						mint loop = newState();
+						states[last].epsilons.push_back(loop);
+						states[loop].epsilons.push_back(f);
+						states[l].epsilons.push_back(loop);
+						last = loop;
+					}
+					else
+					{
+						mint end = newState();
+						for (mint i = node.min; i < node.max; i++)
+						{
+							mint f, l;
+							compile(nodes, node.children[0], f, l);
+							states[last].epsilons.push_back(f);
+							states[last].epsilons.push_back(end);
+							last = l;
+						}
+						states[last].epsilons.push_back(end);
+						last = end;
+					}
+					break;
+				}
+				}
+			}
+		};
+
+		/**
+		 * @brief the equivalence classes of code units
+		 * @detail two code units are in the same class if every set of every pattern contains
+		 * both or neither of them, so the automaton only needs one column per class.
+		 */
+		class Alphabet
+		{
+		public:
+			typedef Unicode_Internal::TwoStageTable<muint16, 0x10000> ClassTable;
+
+			mint							size;
+			ClassTable						classes;
+			std::vector<std::vector<bool>>	contains;	// contains[set][class]
+
+			void build(const std::vector<CharSet>& sets)
+			{
+				std::vector<muint32> bounds;
+				bounds.push_back(0);
+				bounds.push_back(0x10000);
+				for (size_t i = 0; i < sets.size(); i++)
+				{
+					for (size_t j = 0; j < sets[i].size(); j++)
+					{
+						bounds.push_back(sets[i][j].first);
+						bounds.push_back((muint32)sets[i][j].last + 1);
+					}
+				}
+				std::sort(bounds.begin(), bounds.end());
+				bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+				size = (mint)bounds.size() - 1;
+				std::vector<muint16> flat(0x10000);
+				for (size_t i = 0; i + 1 < bounds.size(); i++)
+				{
+					for (muint32 c = bounds[i]; c < bounds[i + 1]; c++)
+						flat[c] = (muint16)i;
+				}
+				classes.build(flat.data());
+
+				contains.assign(sets.size(), std::vector<bool>(size, false));
+				for (size_t i = 0; i < sets.size(); i++)
+				{
+					for (size_t j = 0; j < sets[i].size(); j++)
+					{
+						size_t k = std::lower_bound(bounds.begin(), bounds.end(), (muint32)sets[i][j].first) - bounds.begin();
+						for (; k + 1 < bounds.size() && bounds[k] <= sets[i][j].last; k++)
+							contains[i][k] = true;
+					}
+				}
+			}
+
+			mint classOf(muint16 c) const
+			{
+				return classes[c];
+			}
+		};
+
+		/**
+		 * @brief a deterministic automaton built from an Nfa by subset construction
+		 * @detail state 0 is the dead state. An eager automaton builds every state when it
+		 * is created and is minimized afterwards. A lazy automaton builds a state the first
+		 * time a transition reaches it and drops all states when there are more than
+		 * maxLazyStates, so large patterns never need the whole automaton.
+		 */
+		class Dfa
+		{
+		public:
+			static const mint dead = 0;
+			static const mint unknown = -1;
+			static const size_t maxLazyStates = 4096;
+
+			Dfa()
+				: start(0),
+				lazy(false),
+				generation(0)
+			{
+			}
+
+			void build(const Nfa& nfa, const Alphabet& alphabet, bool buildLazy)
+			{
+				this->nfa = &nfa;
+				this->alphabet = &alphabet;
+				lazy = buildLazy;
+				reset();
+
+				if (!lazy)
+				{
+					for (mint state = 0; state < (mint)sets.size(); state++)
+					{
+						for (mint c = 0; c < alphabet.size; c++)
+						{
+							mint result = target(state, c);
+							transitions[state * alphabet.size + c] = result;
+						}
+					}
+					minimize();
+				}
+			}
+
+			mint startState() const
+			{
+				return start;
+			}
+
+			mint accept(mint state) const
+			{
+				return accepts[state];
+			}
+
+			/**
+			 * @brief the state after reading a code unit of class c
+			 */
+			mint next(mint state, mint c) const
+			{
+				mint result = transitions[state * alphabet->size + c];
+				if (result != unknown)
+					return result;
+
+				if (sets.size() >= maxLazyStates)
+				{
+					std::vector<mint> current = sets[state];
+					reset();
+					state = intern(current);
+				}
+				result = target(state, c);
+				transitions[state * alphabet->size + c] = result;
+				return result;
+			}
+
+			/**
+			 * @brief a number that changes every time a lazy automaton drops its states
+			 */
+			size_t cacheGeneration() const
+			{
+				return generation;
+			}
+
+			size_t stateCount() const
+			{
+				return accepts.size();
+			}
+
+			/**
+			 * @brief the sorted nfa states of a state of a lazy automaton, they keep their ids when the states are dropped
+			 */
+			const std::vector<mint>& nfaStates(mint state) const
+			{
+				return sets[state];
+			}
+
+		private:
+			const Nfa*								nfa;
+			const Alphabet*							alphabet;
+			mutable mint							start;
+			bool									lazy;
+			mutable size_t							generation;
+			mutable std::vector<mint>				transitions;
+			mutable std::vector<mint>				accepts;
+			mutable std::vector<std::vector<mint>>	sets;
+			mutable std::map<std::vector<mint>, mint>	ids;
+
+			void reset() const
+			{
+				transitions.clear();
+				accepts.clear();
+				sets.clear();
+				ids.clear();
+				generation++;
+
+				intern(std::vector<mint>());
+				std::vector<mint> first(1, nfa->start);
+				closure(first);
+				start = intern(first);
+			}
+
+			void closure(std::vector<mint>& states) const
+			{
+				std::vector<bool> visited(nfa->states.size(), false);
+				std::vector<mint> stack(states);
+				states.clear();
+				while (!stack.empty())
+				{
+					mint s = stack.back();
+					stack.pop_back();
+					if (visited[s])
+						continue;
+					visited[s] = true;
+					states.push_back(s);
+					const std::vector<mint>& epsilons = nfa->states[s].epsilons;
+					for (size_t i = 0; i < epsilons.size(); i++)
+						stack.push_back(epsilons[i]);
+				}
+				std::sort(states.begin(), states.end());
+			}
+
+			mint intern(const std::vector<mint>& states) const
+			{
+				auto it = ids.find(states);
+				if (it != ids.end())
+					return it->second;
+
+				mint id = (mint)sets.size();
+				ids.insert(std::make_pair(states, id));
+				sets.push_back(states);
+
+				mint accept = -1;
+				for (size_t i = 0; i < states.size(); i++)
+				{
+					mint a = nfa->states[states[i]].accept;
+					if (a != -1 && (accept == -1 || a < accept))
+						accept = a;
+				}
+				accepts.push_back(accept);
+				transitions.resize(transitions.size() + alphabet->size, (mint)unknown);
+				return id;
+			}
+
+			mint target(mint state, mint c) const
+			{
+				std::vector<mint> result;
+				const std::vector<mint>& states = sets[state];
+				for (size_t i = 0; i < states.size(); i++)
+				{
+					const NfaState& s = nfa->states[states[i]];
+					if (s.set != -1 && alphabet->contains[s.set][c])
+						result.push_back(s.target);
+				}
+				if (result.empty())
+					return dead;
+				closure(result);
+				return intern(result);
+			}
+
+			/**
+			 * @brief merge the equivalent states by partition refinement
+			 */
+			void minimize()
+			{
+				const mint n = (mint)accepts.size();
+				const mint k = alphabet->size;
+				std::vector<mint> block(n);
+				mint blocks = 0;
+				{
+					std::map<mint, mint> labels;
+					for (mint s = 0; s < n; s++)
+					{
+						auto it = labels.insert(std::make_pair(accepts[s], (mint)labels.size())).first;
+						block[s] = it->second;
+					}
+					blocks = (mint)labels.size();
+				}
+
+				for (;;)
+				{
+					std::map<std::vector<mint>, mint> signatures;
+					std::vector<mint> refined(n);
+					std::vector<mint> signature(k + 1);
+					for (mint s = 0; s < n; s++)
+					{
+						signature[0] = block[s];
+						for (mint c = 0; c < k; c++)
+							signature[c + 1] = block[transitions[s * k + c]];
+						auto it = signatures.insert(std::make_pair(signature, (mint)signatures.size())).first;
+						refined[s] = it->second;
+					}
+					block.swap(refined);
+					if ((mint)signatures.size() == blocks)
+						break;
+					blocks = (mint)signatures.size();
+				}
+
+				// renumber the blocks so that the dead state stays 0
+				std::vector<mint> id(blocks, -1);
+				mint count = 0;
+				id[block[dead]] = count++;
+				for (mint s = 0; s < n; s++)
+				{
+					if (id[block[s]] == -1)
+						id[block[s]] = count++;
+				}
+
+				std::vector<mint> newTransitions(count * k);
+				std::vector<mint> newAccepts(count);
+				for (mint s = 0; s < n; s++)
+				{
+					mint b = id[block[s]];
+					newAccepts[b] = accepts[s];
+					for (mint c = 0; c < k; c++)
+						newTransitions[b * k + c] = id[block[transitions[s * k + c]]];
+				}
+
+				start = id[block[start]];
+				transitions.swap(newTransitions);
+				accepts.swap(newAccepts);
+				sets.clear();
+				ids.clear();
+			}
+		};
+	}
+
+	/**
+	 * @brief a set of patterns matched together, the longest match wins and a tie is won by
+	 * the pattern added first
+	 * @example:
+	 * RegexSet rules;
+	 * mint number = rules.add(L"\\d+(\\.\\d+)?");
+	 * mint word = rules.add(L"[A-Za-z]+");
+	 * rules.compile();
+	 * rules.tokenize(text, [&](mint pattern, size_t start, size_t length) {...});
+	 * @detail the patterns are compiled into one deterministic automaton over utf-16 code
+	 * units, so matching never backtracks and reads every code unit at most once per match.
+	 * An eager set builds and minimizes the whole automaton in compile() and can be shared
+	 * between threads. A lazy set builds the states while matching, which suits large
+	 * patterns, but it must not be used by several threads at the same time.
+	 */
+	class RegexSet
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(RegexSet)
+
+	public:
+		enum Mode
+		{
+			Eager,
+			Lazy
+		};
+
+		/**
+		 * @brief the result of a match, pattern is -1 when nothing matches
+		 */
+		struct Match
+		{
+			mint	pattern;
+			size_t	length;
+		};
+
+		RegexSet(Mode mode = Eager)
+			: mode(mode),
+			count(0),
+			compiled(false)
+		{
+		}
+
+		/**
+		 * @brief add a pattern and return its index
+		 */
+		mint add(const Text& pattern)
+		{
+			MOE_ERROR(!compiled, "RegexSet::add(const Text& pattern): The set is compiled.");
+			std::vector<Regex_Internal::RegexNode> nodes;
+			Regex_Internal::RegexParser parser(pattern.data(), pattern.length(), nodes);
+			mint root = parser.parse();
+			nfa.add(nodes, root, count);
+			return count++;
+		}
+
+		/**
+		 * @brief build the automaton, no pattern can be added afterwards
+		 */
+		void compile()
+		{
+			if (compiled)
+				return;
+			alphabet.build(nfa.sets);
+			dfa.build(nfa, alphabet, mode == Lazy);
+			compiled = true;
+		}
+
+		size_t patternCount() const
+		{
+			return count;
+		}
+
+		/**
+		 * @brief return the longest match that starts at a position
+		 * @param text: the text
+		 * @param from: the position where the match starts
+		 */
+		Match match(const TextView& text, size_t from = 0) const
+		{
+			MOE_ERROR(compiled, "RegexSet::match(const TextView& text, size_t from): The set is not compiled.");
+			MOE_ERROR(from <= text.length(), "RegexSet::match(const TextView& text, size_t from): Argument from out of range.");
+
+			const muint16* p = text.data();
+			mint state = dfa.startState();
+			Match result = { dfa.accept(state), 0 };
+			for (size_t i = from; i < text.length(); i++)
+			{
+				state = dfa.next(state, alphabet.classOf(p[i]));
+				if (state == Regex_Internal::Dfa::dead)
+					break;
+				if (dfa.accept(state) != -1)
+				{
+					result.pattern = dfa.accept(state);
+					result.length = i + 1 - from;
+				}
+			}
+			return result;
+		}
+
+		Match match(const Text& text, size_t from = 0) const
+		{
+			return match(text.view(), from);
+		}
+
+		/**
+		 * @brief split a text into the longest matches from left to right
+		 * @param callback: called as callback(pattern, start, length) for every token, a code
+		 * unit (or surrogate pair) that starts no non-empty match is reported with pattern -1
+		 * @detail the states that are known to reach no accepting state from a position are
+		 * remembered, so the whole text is scanned in time linear in its length even when
+		 * a pattern reads far ahead before failing. Once a lazy automaton drops its states, the
+		 * ids of its states change, so the failed nfa states are remembered from then on.
+		 */
+		template<typename Callback>
+		void tokenize(const TextView& text, Callback callback) const
+		{
+			MOE_ERROR(compiled, "RegexSet::tokenize(const TextView& text, Callback callback): The set is not compiled.");
+
+			const muint16* p = text.data();
+			const size_t length = text.length();
+			std::unordered_set<muint64> failed;
+			std::unordered_set<muint64> failedNfa;
+			std::vector<std::pair<mint, size_t>> visited;
+			std::vector<std::pair<mint, size_t>> visitedNfa;
+			size_t marked = 0;
+			size_t generation = dfa.cacheGeneration();
+			bool thrashing = false;
+
+			size_t position = 0;
+			while (position < length)
+			{
+				mint state = dfa.startState();
+				mint pattern = -1;
+				size_t end = position;
+				visited.clear();
+				visitedNfa.clear();
+
+				for (size_t i = position; i < length; )
+				{
+					state = dfa.next(state, alphabet.classOf(p[i++]));
+					if (dfa.cacheGeneration() != generation)
+					{
+						// a lazy automaton dropped its states, the remembered ids are stale
+						generation = dfa.cacheGeneration();
+						failed.clear();
+						visited.clear();
+						thrashing = true;
+					}
+
+					if (state == Regex_Internal::Dfa::dead)
+						break;
+					if (i <= marked && (failed.count(key(state, i, length)) || (thrashing && allFailed(failedNfa, state, i, length))))
+						break;
+
+					if (dfa.accept(state) != -1)
+					{
+						pattern = dfa.accept(state);
+						end = i;
+						visited.clear();
+						visitedNfa.clear();
+					}
+					else
+					{
+						visited.push_back(std::make_pair(state, i));
+						if (thrashing)
+						{
+							const std::vector<mint>& states = dfa.nfaStates(state);
+							for (size_t j = 0; j < states.size(); j++)
+								visitedNfa.push_back(std::make_pair(states[j], i));
+						}
+					}
+				}
+
+				for (size_t i = 0; i < visited.size(); i++)
+				{
+					failed.insert(key(visited[i].first, visited[i].second, length));
+					if (visited[i].second > marked)
+						marked = visited[i].second;
+				}
+				for (size_t i = 0; i < visitedNfa.size(); i++)
+				{
+					failedNfa.insert(key(visitedNfa[i].first, visitedNfa[i].second, length));
+					if (visitedNfa[i].second > marked)
+						marked = visitedNfa[i].second;
+				}
+
+				if (pattern != -1 && end > position)
+				{
+					callback(pattern, position, end - position);
+					position = end;
+				}
+				else
+				{
+					size_t unit = p[position] >= 0xD800 && p[position] <= 0xDBFF && position + 1 < length
+						&& p[position + 1] >= 0xDC00 && p[position + 1] <= 0xDFFF ? 2 : 1;
+					callback((mint)-1, position, unit);
+					position += unit;
+				}
+			}
+		}
+
+		template<typename Callback>
+		void tokenize(const Text& text, Callback callback) const
+		{
+			tokenize(text.view(), callback);
+		}
+
+	private:
+		Mode					mode;
+		mint					count;
+		bool					compiled;
+		Regex_Internal::Nfa		nfa;
+		Regex_Internal::Alphabet	alphabet;
+		Regex_Internal::Dfa		dfa;
+
+		static muint64 key(mint state, size_t position, size_t length)
+		{
+			return (muint64)state * (length + 1) + position;
+		}
+
+		/**
+		 * @brief whether every nfa state of a state is known to fail from a position
+		 */
+		bool allFailed(const std::unordered_set<muint64>& failedNfa, mint state, size_t position, size_t length) const
+		{
+			const std::vector<mint>& states = dfa.nfaStates(state);
+			for (size_t i = 0; i < states.size(); i++)
+			{
+				if (!failedNfa.count(key(states[i], position, length)))
+					return false;
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * @brief a compiled regular expression, see RegexSet for the syntax and the guarantees
+	 * @example:
+	 * Regex date(L"\\d{4}-\\d{2}-\\d{2}");
+	 * if (date.matches(text)) {...}
+	 */
+	class Regex
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(Regex)
+
+	public:
+		Regex(const Text& pattern, RegexSet::Mode mode = RegexSet::Eager)
+			: patterns(mode)
+		{
+			patterns.add(pattern);
+			patterns.compile();
+		}
+
+		/**
+		 * @brief return true if the whole text matches
+		 */
+		bool matches(const TextView& text) const
+		{
+			RegexSet::Match m = patterns.match(text);
+			return m.pattern != -1 && m.length == text.length();
+		}
+
+		bool matches(const Text& text) const
+		{
+			return matches(text.view());
+		}
+
+		/**
+		 * @brief return the length of the longest match that starts at a position, or -1
+		 */
+		mint match(const TextView& text, size_t from = 0) const
+		{
+			RegexSet::Match m = patterns.match(text, from);
+			return m.pattern == -1 ? -1 : (mint)m.length;
+		}
+
+		mint match(const Text& text, size_t from = 0) const
+		{
+			return match(text.view(), from);
+		}
+
+	private:
+		RegexSet patterns;
+	};
+}
+
+#endif
@@ -4,6 +4,9 @@
 #include "../Base.hpp"
 #include "../Memory.hpp"
 #include "CodeConvert.hpp"
+#include "NumberConvert.hpp"
+#include "TextView.hpp"
+#include "Unicode.hpp"
 
 #include <vector>
 #include <tuple>
@@ -106,11 +109,79 @@ namespace MoeLP
 
 		/**
 		 * @brief return true if the character is Chinese character
+		 * @detail an ideograph of the CJK Unified Ideographs, CJK Extension A or the CJK
+		 * Compatibility Ideographs blocks. Other Han characters such as U+3005, U+3007 and the
+		 * radicals are not included, see isHan().
 		 */
 		bool isChineseCharacter() const
 		{
-			return (data.word >= 0x4E00 && data.word <= 0x9FCB) ?
-				true : false;
+			const muint16 c = data.word;
+			return ((c >= 0x3400 && c <= 0x4DBF) || (c >= 0x4E00 && c <= 0x9FFF) || (c >= 0xF900 && c <= 0xFAFF))
+				&& characterClass() == CharacterClass::Han;
+		}
+
+		/**
+		 * @brief return true if the character has the Han script, as the Han class of classify()
+		 */
+		bool isHan() const
+		{
+			return characterClass() == CharacterClass::Han;
+		}
+
+		/**
+		 * @brief return the Unicode general category
+		 */
+		UnicodeCategory category() const
+		{
+			return Unicode::category(data.word);
+		}
+
+		/**
+		 * @brief return the Unicode script
+		 */
+		UnicodeScript script() const
+		{
+			return Unicode::script(data.word);
+		}
+
+		/**
+		 * @brief return the coarse class used as a character type feature
+		 */
+		CharacterClass characterClass() const
+		{
+			return Unicode::characterClass(data.word);
+		}
+
+		/**
+		 * @brief return true if the character is a punctuation of any script
+		 */
+		bool isPunctuation() const
+		{
+			return characterClass() == CharacterClass::Punctuation;
+		}
+
+		/**
+		 * @brief return true if the character is a symbol of any script
+		 */
+		bool isSymbol() const
+		{
+			return characterClass() == CharacterClass::Symbol;
+		}
+
+		/**
+		 * @brief return true if the character is a separator or a white space control
+		 */
+		bool isSpace() const
+		{
+			return characterClass() == CharacterClass::Space;
+		}
+
+		/**
+		 * @brief return true if the character is a full-width form
+		 */
+		bool isFullWidth() const
+		{
+			return Unicode::isFullWidth(data.word);
 		}
 
 		/**
@@ -247,6 +318,11 @@ namespace MoeLP
 		}data;
 	};
 
+	namespace Text_Internal
+	{
+		struct TextDelimiter;
+	}
+
 	class Text
 	{
 		static const mint localSize = sizeof(void*) == 8 ? 19 : 15;
@@ -320,6 +396,15 @@ namespace MoeLP
 			realSize = size;
 		}
 
+		/**
+		 * @brief copy the characters of a view
+		 * @param view: the view to copy
+		 */
+		explicit Text(const TextView& view)
+			: Text(view.data(), view.length())
+		{
+		}
+
 		/**
 		 * @brief copy a string
 		 * @param str: string to copy, it will contain the zero terminator
@@ -499,9 +584,9 @@ namespace MoeLP
 			size = text.size;
 			start = text.start;
 			realSize = text.realSize;
-			if (text.size <= localSize)
+			if (text.buffer == text.temp)
 			{
-				memcpy(temp, text.temp, sizeof(muint16)*realSize);
+				memcpy(temp, text.temp, sizeof(muint16)*(realSize + 1));
 				buffer = temp;
 			}
 			incrementRefCounter();
@@ -531,9 +616,9 @@ namespace MoeLP
 				size = length;
 				realSize = text.realSize;
 				start = text.start + startpos;
-				if (text.size <= localSize)
+				if (text.buffer == text.temp)
 				{
-					memcpy(temp, text.temp, sizeof(muint16)*realSize);
+					memcpy(temp, text.temp, sizeof(muint16)*(realSize + 1));
 					buffer = temp;
 				}
 				incrementRefCounter();
@@ -545,12 +630,11 @@ namespace MoeLP
 		 */
 		Text(const Text& src1, const Text& src2)
 		{
-			refCounter = (mint*)cpuAllocate(sizeof(muint));
+			refCounter = (mint*)cpuAllocate(sizeof(mint));
 			*refCounter = 1;
 			size = src1.size + src2.size;
 			realSize = size;
 			start = 0;
-			buffer = (muint16*)cpuAllocate(sizeof(muint16)*(size + 1));
 			if (size <= localSize)
 			{
 				memcpy(temp, src1.buffer + src1.start, sizeof(muint16)*src1.size);
@@ -560,6 +644,7 @@ namespace MoeLP
 			}
 			else
 			{
+				buffer = (muint16*)cpuAllocate(sizeof(muint16)*(size + 1));
 				memcpy(buffer, src1.buffer + src1.start, sizeof(muint16)*src1.size);
 				memcpy(buffer + src1.size, src2.buffer + src2.start, sizeof(muint16)*src2.size);
 				buffer[size] = 0;
@@ -577,9 +662,9 @@ namespace MoeLP
 			size = text.size;
 			realSize = text.realSize;
 			start = text.start;
-			if (text.size <= localSize)
+			if (text.buffer == text.temp)
 			{
-				memcpy(temp, text.temp, sizeof(muint16)*realSize);
+				memcpy(temp, text.temp, sizeof(muint16)*(realSize + 1));
 				buffer = temp;
 			}
 
@@ -621,10 +706,51 @@ namespace MoeLP
 		 */
 		static Text fromUTF8(const char* utf8str)
 		{
-			mint length = getBufferLength(utf8str);
+			return fromUTF8(utf8str, strlen(utf8str));
+		}
+
+		/**
+		 * @brief create a text from utf8 bytes
+		 * @param utf8str: the bytes, they need not be zero terminated
+		 * @param length: the number of bytes
+		 * @detail an ill-formed sequence is replaced by U+FFFD. The exact length is counted
+		 * first and the bytes are decoded straight into the buffer of the text.
+		 */
+		static Text fromUTF8(const char* utf8str, size_t length)
+		{
+			size_t size = utf16LengthOfUtf8(utf8str, length);
+			if (size <= localSize)
+			{
+				muint16 local[localSize];
+				return Text(local, utf8ToUtf16(utf8str, length, local));
+			}
+
+			Text t;
+			t.buffer = (muint16*)cpuAllocate(sizeof(muint16)*(size + 1));
+			t.buffer[utf8ToUtf16(utf8str, length, t.buffer)] = 0;
+			t.refCounter = (mint*)cpuAllocate(sizeof(mint));
+			*t.refCounter = 1;
+			t.size = size;
+			t.realSize = size;
+			return t;
+		}
+
+		/**
+		 * @brief create a text from GB18030 bytes, which also reads GBK and GB2312
+		 * @param gb18030: the bytes, they need not be zero terminated
+		 * @param length: the number of bytes
+		 * @detail an ill-formed code is replaced by U+FFFD.
+		 */
+		static Text fromGB18030(const char* gb18030, size_t length)
+		{
+			if (length <= localSize)
+			{
+				muint16 local[localSize];
+				return Text(local, gb18030ToUtf16(gb18030, length, local));
+			}
+
 			muint16* temp = (muint16*)cpuAllocate(sizeof(muint16)*length);
-			size_t size = codeConvert(utf8str, temp);
-			Text t = Text(temp);
+			Text t(temp, gb18030ToUtf16(gb18030, length, temp));
 			cpuDeallocate(temp, sizeof(muint16)*length);
 			return t;
 		}
@@ -658,13 +784,65 @@ namespace MoeLP
 				newBuffer[size] = 0;
 				decrementRefCounter();
 				buffer = newBuffer;
-				refCounter = new mint(1);
+				refCounter = (mint*)cpuAllocate(sizeof(mint));
+				*refCounter = 1;
 				start = 0;
 				realSize = size;
 			}
 			return buffer + start;
 		}
 
+		/**
+		 * @brief return a view of the characters without copying
+		 * @detail the view is valid until the text is modified or destroyed, or data() makes a
+		 * part of a text terminated. A view needs no terminator, so a part is not copied.
+		 */
+		TextView view() const
+		{
+			return TextView(buffer + start, size);
+		}
+
+		/**
+		 * @brief split the text by a character into a lazy range of views
+		 * @example: for (TextView field : line.split(L'\t')) {...}
+		 * @detail the text must outlive the range, nothing is copied while iterating.
+		 */
+		TextSplitRange<TextView_Internal::CharacterDelimiter> split(muint16 delimiter) const
+		{
+			return view().split(delimiter);
+		}
+
+		/**
+		 * @brief split the text by a text into a lazy range of views
+		 * @detail the delimiter is kept by the range, so a temporary delimiter is allowed.
+		 */
+		TextSplitRange<Text_Internal::TextDelimiter> split(const Text& delimiter) const;
+
+		/**
+		 * @brief split the text at every character for which the predicate returns true
+		 */
+		template<typename Predicate>
+		TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>> splitIf(Predicate predicate) const
+		{
+			return view().splitIf(predicate);
+		}
+
+		/**
+		 * @brief the lines of the text, "\r\n" is accepted and a final line break does not add an empty line
+		 */
+		TextSplitRange<TextView_Internal::CharacterDelimiter> lines() const
+		{
+			return view().lines();
+		}
+
+		/**
+		 * @brief the non empty pieces of the text separated by white spaces
+		 */
+		TextSplitRange<TextView_Internal::PredicateDelimiter<TextView_Internal::SpaceCharacter>> tokens() const
+		{
+			return view().tokens();
+		}
+
 		const wchar_t* c_str() const
 		{
 			if (sizeof(wchar_t) == 2)
@@ -674,11 +852,12 @@ namespace MoeLP
 				const muint16* temp = data();
 				if (cstr == 0)
 				{
-					cstr = new muint32[size];
+					cstr = new muint32[size + 1];
 					for (size_t i = 0; i < size; i++)
 					{
 						size_t len = codeConvert(&temp[i], cstr[i]);
 					}
+					cstr[size] = 0;
 				}
 				return (wchar_t*)cstr;
 			}
@@ -799,18 +978,19 @@ namespace MoeLP
 
 		/**
 		 * @brief convert a text into a double precision number
+		 * @detail the conversion is correctly rounded and does not depend on the locale
 		 */
-		double toDouble()
+		double toDouble() const
 		{
-			return wcstod(c_str(), nullptr);
+			return parseDouble(buffer + start, buffer + start + size);
 		}
 
 		/**
 		 * @brief convert a text into a long double precision number
 		 */
-		long double toLongDouble()
+		long double toLongDouble() const
 		{
-			return wcstold(c_str(), nullptr);
+			return parseLongDouble(buffer + start, buffer + start + size);
 		}
 
 		/**
@@ -818,9 +998,9 @@ namespace MoeLP
 		 * @param radix: the radix of the text number
 		 * @detail for example when the text is "0xff" the parameter radix is 16
 		 */
-		mint32 toInt32(mint radix = 10)
+		mint32 toInt32(mint radix = 10) const
 		{
-			return wcstol(c_str(), nullptr, radix);
+			return parseInteger<mint32>(buffer + start, buffer + start + size, radix);
 		}
 
 		/**
@@ -828,9 +1008,9 @@ namespace MoeLP
 		 * @param radix: the radix of the text number
 		 * @detail for example when the text is "0xff" the parameter radix is 16
 		 */
-		mint64 toInt64(mint radix = 10)
+		mint64 toInt64(mint radix = 10) const
 		{
-			return wcstoll(c_str(), nullptr, radix);
+			return parseInteger<mint64>(buffer + start, buffer + start + size, radix);
 		}
 
 		/**
@@ -838,9 +1018,9 @@ namespace MoeLP
 		 * @param radix: the radix of the text number
 		 * @detail for example when the text is "0xff" the parameter radix is 16
 		 */
-		muint32 toUInt32(mint radix = 10)
+		muint32 toUInt32(mint radix = 10) const
 		{
-			return wcstoul(c_str(), nullptr, radix);
+			return parseInteger<muint32>(buffer + start, buffer + start + size, radix);
 		}
 
 		/**
@@ -848,189 +1028,121 @@ namespace MoeLP
 		 * @param radix: the radix of the text number
 		 * @detail for example when the text is "0xff" the parameter radix is 16
 		 */
-		muint64 toUInt64(mint radix = 10)
+		muint64 toUInt64(mint radix = 10) const
 		{
-			return wcstoull(c_str(), nullptr, radix);
+			return parseInteger<muint64>(buffer + start, buffer + start + size, radix);
 		}
 
 		static Text number(mint32 n, mint radix = 10)
 		{
-			wchar_t buf[100];
-			i32tow(n, buf, sizeof(buf) / sizeof(wchar_t), radix);
-			return Text(buf);
+			muint16 buf[maxIntegerLength];
+			return Text(buf, formatInteger(n, buf, radix));
 		}
 
 		static Text number(mint64 n, mint radix = 10)
 		{
-			wchar_t buf[100];
-			i64tow(n, buf, sizeof(buf) / sizeof(wchar_t), radix);
-			return Text(buf);
+			muint16 buf[maxIntegerLength];
+			return Text(buf, formatInteger(n, buf, radix));
 		}
 
 		static Text number(muint32 n, mint radix = 10)
 		{
-			wchar_t buf[100];
-			ui32tow(n, buf, sizeof(buf) / sizeof(wchar_t), radix);
-			return Text(buf);
+			muint16 buf[maxIntegerLength];
+			return Text(buf, formatInteger(n, buf, radix));
 		}
 
 		static Text number(muint64 n, mint radix = 10)
 		{
-			wchar_t buf[100];
-			ui64tow(n, buf, sizeof(buf) / sizeof(wchar_t), radix);
-			return Text(buf);
+			muint16 buf[maxIntegerLength];
+			return Text(buf, formatInteger(n, buf, radix));
 		}
 
-		static Text number(double n, mint precision = 6)
+		/**
+		 * @brief convert a double precision number into a text
+		 * @param precision: the number of significant digits, 0 means the shortest text
+		 * which converts back to the same number
+		 */
+		static Text number(double n, mint precision = 0)
 		{
-			char buf[100];
-			#if defined MOE_MSVC
-			_gcvt_s(buf, 100, n, precision);
-			#elif defined MOE_GCC
-			gcvt(n, precision, buf);
-			#endif
-			return fromLocal(buf);
+			muint16 buf[maxFloatLength];
+			return Text(buf, formatDouble(n, buf, precision));
 		}
 
-		static Text number(long double n, mint precision = 6)
+		/**
+		 * @brief convert a long double precision number into a text
+		 * @param precision: the number of significant digits, 0 means enough digits to
+		 * convert back to the same number
+		 */
+		static Text number(long double n, mint precision = 0)
 		{
-			char buf[100];
-			#if defined MOE_MSVC
-			_gcvt_s(buf, 100, n, precision);
-			#elif defined MOE_GCC
-			gcvt(n, precision, buf);
-			#endif
-			return fromLocal(buf);
+			muint16 buf[maxFloatLength];
+			return Text(buf, formatLongDouble(n, buf, precision));
 		}
 
-		Text toUpper()
+		/**
+		 * @brief return a copy with ascii letters in upper case, the text itself is not changed
+		 */
+		Text toUpper() const
 		{
-			muint16* temp = (muint16*)data();
-			muint16* p = temp;
-			while (*p)
+			Text result(buffer + start, size);
+			muint16* p = result.buffer;
+			for (size_t i = 0; i < size; i++)
 			{
-				if (*p >= 0x0061 && *p <= 0x007A)
-					*p -= 0x0020;
-				p++;
+				if (p[i] >= 0x0061 && p[i] <= 0x007A)
+					p[i] -= 0x0020;
 			}
-			return Text(temp);
+			return result;
 		}
 
-		Text toLower()
+		/**
+		 * @brief return a copy with ascii letters in lower case, the text itself is not changed
+		 * @detail use TextNormalizer for Unicode case folding
+		 */
+		Text toLower() const
 		{
-			muint16* temp = (muint16*)data();
-			muint16* p = temp;
-			while (*p)
+			Text result(buffer + start, size);
+			muint16* p = result.buffer;
+			for (size_t i = 0; i < size; i++)
 			{
-				if (*p >= 0x0041 && *p <= 0x005A)
-					*p += 0x0020;
-				p++;
+				if (p[i] >= 0x0041 && p[i] <= 0x005A)
+					p[i] += 0x0020;
 			}
-			return Text(temp);
+			return result;
 		}
 
 		Text arg(mint32 n, mint radix = 10) const
 		{
-			Text t(*this);
-			Text nt = number(n, radix);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, radix));
 		}
 
 		Text arg(mint64 n, mint radix = 10) const
 		{
-			Text t(*this);
-			Text nt = number(n, radix);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, radix));
 		}
 
 		Text arg(muint32 n, mint radix = 10) const
 		{
-			Text t(*this);
-			Text nt = number(n, radix);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, radix));
 		}
 
 		Text arg(muint64 n, mint radix = 10) const
 		{
-			Text t(*this);
-			Text nt = number(n, radix);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, radix));
 		}
 
-		Text arg(double n, mint precision = 6) const
+		Text arg(double n, mint precision = 0) const
 		{
-			Text t(*this);
-			Text nt = number(n, precision);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, precision));
 		}
 
-		Text arg(long double n, mint precision = 6) const
+		Text arg(long double n, mint precision = 0) const
 		{
-			Text t(*this);
-			Text nt = number(n, precision);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(nt, indices.first + offset, indices.second + offset);
-				offset += nt.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(number(n, precision));
 		}
 
 		Text arg(const Text& text) const
 		{
-			Text t(*this);
-			mint offset = 0;
-
-			for (auto indices : findArgEscapes())
-			{
-				t = t.replace(text, indices.first + offset, indices.second + offset);
-				offset += text.size - (indices.second - indices.first + 1);
-			}
-
-			return t;
+			return replaceArgEscapes(text);
 		}
 
 		size_t length() const
@@ -1048,9 +1160,9 @@ namespace MoeLP
 				realSize = text.realSize;
 				buffer = text.buffer;
 				refCounter = text.refCounter;
-				if (text.size <= localSize)
+				if (text.buffer == text.temp)
 				{
-					memcpy(temp, text.temp, sizeof(muint16)*realSize);
+					memcpy(temp, text.temp, sizeof(muint16)*(realSize + 1));
 					buffer = temp;
 				}
 				incrementRefCounter();
@@ -1068,9 +1180,9 @@ namespace MoeLP
 				size = text.size;
 				realSize = text.realSize;
 				start = text.start;
-				if (text.size <= localSize)
+				if (text.buffer == text.temp)
 				{
-					memcpy(temp, text.temp, sizeof(muint16)*realSize);
+					memcpy(temp, text.temp, sizeof(muint16)*(realSize + 1));
 					buffer = temp;
 				}
 
@@ -1224,7 +1336,7 @@ namespace MoeLP
 			}
 			else
 			{
-				refCounter = (mint*)cpuAllocate(sizeof(muint));
+				refCounter = (mint*)cpuAllocate(sizeof(mint));
 				*refCounter = 1;
 				size = src1.size + src2.size - count;
 				realSize = size;
@@ -1251,17 +1363,18 @@ namespace MoeLP
 			{
 				if (ATOMIC_DECREMENT(refCounter) == 0)
 				{
-					if (size <= localSize)
-						buffer = 0;
-					else
-						cpuDeallocate(buffer, size * sizeof(muint16));
+					if (buffer != temp)
+						cpuDeallocate(buffer, sizeof(muint16)*(realSize + 1));
 
-					cpuDeallocate((void*)refCounter, sizeof(muint16));
-
-					if (cstr)
-						delete[] cstr;
+					cpuDeallocate((void*)refCounter, sizeof(mint));
 				}
 			}
+
+			if (cstr)
+			{
+				delete[] cstr;
+				cstr = 0;
+			}
 		}
 
 		template<typename T>
@@ -1272,138 +1385,98 @@ namespace MoeLP
 			return length;
 		}
 
-		static void i32tow(mint32 n, wchar_t* buffer, size_t size, mint radix)
-		{
-			switch (radix)
-			{
-			case 8:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%o", n)
-					: swprintf(buffer, size - 1, L"-%o", -n);
-				break;
-			case 10:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%d", n)
-					: swprintf(buffer, size - 1, L"-%d", -n);
-				break;
-			case 16:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%X", n)
-					: swprintf(buffer, size - 1, L"-%X", -n);
-				break;
-			default:
-				swprintf(buffer, size - 1, L"%d", 0);
-				break;
-			}
-		}
-
-		static void i64tow(mint64 n, wchar_t* buffer, size_t size, mint radix)
-		{
-			switch (radix)
-			{
-			case 8:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%lo", n)
-					: swprintf(buffer, size - 1, L"-%lo", -n);
-				break;
-			case 10:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%ld", n)
-					: swprintf(buffer, size - 1, L"-%ld", -n);
-				break;
-			case 16:
-				n >= 0 ?
-					swprintf(buffer, size - 1, L"%lX", n)
-					: swprintf(buffer, size - 1, L"-%lX", -n);
-				break;
-			default:
-				swprintf(buffer, size - 1, L"%ld", 0);
-				break;
-			}
-		}
-
-		static void ui32tow(muint32 n, wchar_t* buffer, size_t size, mint radix)
-		{
-			switch (radix)
-			{
-			case 8:
-				swprintf(buffer, size - 1, L"%o", n);
-				break;
-			case 10:
-				swprintf(buffer, size - 1, L"%u", n);
-				break;
-			case 16:
-				swprintf(buffer, size - 1, L"%X", n);
-				break;
-			default:
-				swprintf(buffer, size - 1, L"%u", 0);
-				break;
-			}
-		}
-
-		static void ui64tow(muint64 n, wchar_t* buffer, size_t size, mint radix)
-		{
-			switch (radix)
-			{
-			case 8:
-				swprintf(buffer, size - 1, L"%lo", n);
-				break;
-			case 10:
-				swprintf(buffer, size - 1, L"%lu", n);
-				break;
-			case 16:
-				swprintf(buffer, size - 1, L"%lX", n);
-				break;
-			default:
-				swprintf(buffer, size - 1, L"%lu", 0);
-				break;
-			}
-		}
-
+		/**
+		 * @brief return the [begin, end] indices of all the escapes "{n}" with the smallest n
+		 */
 		std::vector<std::pair<size_t, size_t>> findArgEscapes() const
 		{
 			std::vector<std::pair<size_t, size_t>> indexBuffer;
-			mint minnum = 2147483647;
-			bool begin = false;
-			size_t leftIndex = 0;
-			size_t rightIndex = 0;
+			muint32 minnum = 0xFFFFFFFF;
+			const muint16* p = buffer + start;
 
-			for (size_t i = 0; i < size; i++)
+			size_t i = 0;
+			while (i < size)
 			{
-				muint16* p = buffer + start + i;
-
-				if (*p == 123)
+				if (p[i] != 123)
 				{
-					leftIndex = i;
-					begin = true;
+					i++;
 					continue;
 				}
 
-				if (begin && (!(*p >= 48 && *p <= 57)))
+				size_t j = i + 1;
+				muint32 number = 0;
+				while (j < size && p[j] >= 48 && p[j] <= 57)
+				{
+					number = number * 10 + (p[j] - 48);
+					j++;
+				}
+
+				if (j > i + 1 && j < size && p[j] == 125)
 				{
-					begin = false;
-					if (*p == 125 && *(p - 1) != 123)
+					if (minnum > number)
 					{
-						rightIndex = i;
-						mint32 temp = this->subText(leftIndex + 1, rightIndex - leftIndex - 1).toInt32();
-						
-						if (minnum > temp)
-						{
-							minnum = temp;
-							indexBuffer.clear();
-							indexBuffer.push_back(std::make_pair(leftIndex, rightIndex));
-						}
-						else if (minnum == temp)
-						{
-							indexBuffer.push_back(std::make_pair(leftIndex, rightIndex));
-						}
+						minnum = number;
+						indexBuffer.clear();
+						indexBuffer.push_back(std::make_pair(i, j));
 					}
-					continue;
+					else if (minnum == number)
+					{
+						indexBuffer.push_back(std::make_pair(i, j));
+					}
+					i = j + 1;
+				}
+				else
+				{
+					i = j;
 				}
 			}
 			return indexBuffer;
 		}
 
+		/**
+		 * @brief replace the escapes with the smallest number by a text in one pass
+		 */
+		Text replaceArgEscapes(const Text& text) const
+		{
+			std::vector<std::pair<size_t, size_t>> escapes = findArgEscapes();
+			if (escapes.size() == 0)
+				return *this;
+
+			size_t escapeSize = 0;
+			for (auto indices : escapes)
+				escapeSize += indices.second - indices.first + 1;
+
+			// the characters are written right into the storage of the result
+			size_t sz = size - escapeSize + text.size * escapes.size();
+			Text result;
+			if (sz == 0)
+				return result;
+			result.refCounter = (mint*)cpuAllocate(sizeof(mint));
+			*result.refCounter = 1;
+			if (sz > localSize)
+				result.buffer = (muint16*)cpuAllocate(sizeof(muint16)*(sz + 1));
+			result.size = sz;
+			result.realSize = sz;
+
+			muint16* dest = result.buffer;
+			const muint16* src = buffer + start;
+			const muint16* value = text.buffer + text.start;
+			size_t last = 0;
+			size_t num = 0;
+
+			for (auto indices : escapes)
+			{
+				memcpy(dest + num, src + last, sizeof(muint16)*(indices.first - last));
+				num += indices.first - last;
+				memcpy(dest + num, value, sizeof(muint16)*text.size);
+				num += text.size;
+				last = indices.second + 1;
+			}
+			memcpy(dest + num, src + last, sizeof(muint16)*(size - last));
+			dest[sz] = 0;
+			return result;
+		}
+
 		/**
 		 * @breif KMP
 		 */
@@ -1459,5 +1532,28 @@ namespace MoeLP
 			return -1;
 		}
 	};
+
+	namespace Text_Internal
+	{
+		/**
+		 * @brief a text delimiter that keeps its own copy of the delimiter
+		 */
+		struct TextDelimiter
+		{
+			Text text;
+
+			std::pair<mint, size_t> next(const TextView& view, size_t from) const
+			{
+				TextView_Internal::TextDelimiter delimiter = { text.view() };
+				return delimiter.next(view, from);
+			}
+		};
+	}
+
+	inline TextSplitRange<Text_Internal::TextDelimiter> Text::split(const Text& delimiter) const
+	{
+		Text_Internal::TextDelimiter d = { delimiter };
+		return TextSplitRange<Text_Internal::TextDelimiter>(view(), d);
+	}
 }
 #endif
\ No newline at end of file
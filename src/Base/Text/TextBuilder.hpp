@@ -0,0 +1,193 @@
+#ifndef MoeLP_Base_TextBuilder
+#define MoeLP_Base_TextBuilder
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "Text.hpp"
+
+namespace MoeLP
+{
+	/**
+	 * @brief a growable utf-16 buffer used to build a text in one pass
+	 * @example:
+	 * TextBuilder builder;
+	 * builder.append(L"count: ").append(Text::number(n));
+	 * Text t = builder.toText();
+	 * @detail the buffer is reused after clear(), so one builder can produce many texts
+	 * without reallocating.
+	 */
+	class TextBuilder
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(TextBuilder)
+
+	public:
+		static const size_t defaultCapacity = 64;
+
+		/**
+		 * @brief create an empty builder
+		 * @param capacity: the number of characters to reserve
+		 */
+		TextBuilder(size_t capacity = defaultCapacity)
+			: buffer(0),
+			size(0),
+			capacity_(0)
+		{
+			reserve(capacity);
+		}
+
+		~TextBuilder()
+		{
+			if (buffer)
+				cpuDeallocate(buffer, sizeof(muint16)*capacity_);
+		}
+
+		/**
+		 * @brief make sure the builder can hold at least capacity characters
+		 */
+		void reserve(size_t capacity)
+		{
+			if (capacity <= capacity_)
+				return;
+
+			size_t newCapacity = capacity_ == 0 ? defaultCapacity : capacity_;
+			while (newCapacity < capacity)
+				newCapacity *= 2;
+
+			muint16* newBuffer = (muint16*)cpuAllocate(sizeof(muint16)*newCapacity);
+			if (buffer)
+			{
+				memcpy(newBuffer, buffer, sizeof(muint16)*size);
+				cpuDeallocate(buffer, sizeof(muint16)*capacity_);
+			}
+			buffer = newBuffer;
+			capacity_ = newCapacity;
+		}
+
+		/**
+		 * @brief return a pointer to count writable characters at the end of the builder
+		 * @detail the characters are not part of the text until commit(count) is called.
+		 */
+		muint16* grow(size_t count)
+		{
+			reserve(size + count);
+			return buffer + size;
+		}
+
+		/**
+		 * @brief add count characters written through grow() to the text
+		 */
+		void commit(size_t count)
+		{
+			MOE_ERROR(size + count <= capacity_, "TextBuilder::commit(size_t count): Argument count out of range.");
+			size += count;
+		}
+
+		TextBuilder& append(muint16 c)
+		{
+			if (size == capacity_)
+				reserve(size + 1);
+			buffer[size++] = c;
+			return *this;
+		}
+
+		TextBuilder& append(const muint16* str, size_t length)
+		{
+			if (length == 0)
+				return *this;
+			reserve(size + length);
+			memcpy(buffer + size, str, sizeof(muint16)*length);
+			size += length;
+			return *this;
+		}
+
+		TextBuilder& append(const Text& text)
+		{
+			return append(text.data(), text.length());
+		}
+
+		TextBuilder& append(const TextView& view)
+		{
+			return append(view.data(), view.length());
+		}
+
+		/**
+		 * @brief append a zero terminated ucs2/4 string
+		 */
+		TextBuilder& append(const wchar_t* str)
+		{
+			if (sizeof(wchar_t) == 2)
+			{
+				size_t length = 0;
+				while (str[length]) length++;
+				return append((const muint16*)str, length);
+			}
+
+			for (; *str; str++)
+			{
+				muint32 ucs4 = (muint32)*str;
+				if (ucs4 > 0xFFFF)
+				{
+					muint16* p = grow(2);
+					p[0] = (muint16)(0xD800 + (ucs4 >> 10) - 0x40);
+					p[1] = (muint16)(0xDC00 + (ucs4 & 0x03FF));
+					commit(2);
+				}
+				else
+				{
+					append((muint16)ucs4);
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief append count copies of a character
+		 */
+		TextBuilder& fill(muint16 c, size_t count)
+		{
+			muint16* p = grow(count);
+			for (size_t i = 0; i < count; i++)
+				p[i] = c;
+			commit(count);
+			return *this;
+		}
+
+		/**
+		 * @brief drop the content but keep the buffer for reuse
+		 */
+		void clear()
+		{
+			size = 0;
+		}
+
+		size_t length() const
+		{
+			return size;
+		}
+
+		size_t capacity() const
+		{
+			return capacity_;
+		}
+
+		/**
+		 * @brief return the characters written so far, the buffer is not zero terminated
+		 */
+		const muint16* data() const
+		{
+			return buffer;
+		}
+
+		Text toText() const
+		{
+			return Text(buffer, size);
+		}
+
+	private:
+		muint16*	buffer;
+		size_t		size;
+		size_t		capacity_;
+	};
+}
+
+#endif
@@ -0,0 +1,432 @@
+#ifndef MoeLP_Base_TextColumn
+#define MoeLP_Base_TextColumn
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "Text.hpp"
+#include "TextView.hpp"
+#include "../FileSystem/FileStream.hpp"
+#include "../FileSystem/MappedFile.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace MoeLP
+{
+	namespace TextColumn_Internal
+	{
+		/**
+		 * @brief the header of a stored column, followed by count + 1 offsets and the code units
+		 */
+		struct Header
+		{
+			char	magic[8];
+			muint64	count;
+			muint64	units;
+		};
+
+		static const char magic[8] = { 'M', 'o', 'e', 'T', 'C', 'o', 'l', '1' };
+	}
+
+	/**
+	 * @brief a collection of texts stored in one contiguous utf-16 buffer
+	 * @example:
+	 * TextColumn words;
+	 * words.append(L"hello");
+	 * for (TextView word : words) {...}
+	 * words.store(L"words.col");
+	 * TextColumn mapped;
+	 * mapped.load(L"words.col");	// no copy, the file is mapped into memory
+	 * @detail the i-th text is the code units from offsets[i] to offsets[i + 1], so a text
+	 * costs its characters plus 8 bytes instead of a Text object, a reference counter and a
+	 * buffer. A loaded column reads the file mapping directly; it is copied into memory the
+	 * first time it is modified.
+	 */
+	class TextColumn
+	{
+		MOE_DISALLOW_COPY_AND_ASSIGN(TextColumn)
+
+	public:
+		class Iterator
+		{
+		public:
+			typedef std::random_access_iterator_tag	iterator_category;
+			typedef TextView						value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef const TextView*					pointer;
+			typedef TextView						reference;
+
+			Iterator()
+				: column(0),
+				index(0)
+			{
+			}
+
+			Iterator(const TextColumn* column, size_t index)
+				: column(column),
+				index(index)
+			{
+			}
+
+			TextView operator*() const
+			{
+				return (*column)[index];
+			}
+
+			TextView operator[](difference_type n) const
+			{
+				return (*column)[index + n];
+			}
+
+			Iterator& operator++() { index++; return *this; }
+			Iterator operator++(int) { Iterator it = *this; index++; return it; }
+			Iterator& operator--() { index--; return *this; }
+			Iterator operator--(int) { Iterator it = *this; index--; return it; }
+			Iterator& operator+=(difference_type n) { index += n; return *this; }
+			Iterator& operator-=(difference_type n) { index -= n; return *this; }
+			Iterator operator+(difference_type n) const { return Iterator(column, index + n); }
+			Iterator operator-(difference_type n) const { return Iterator(column, index - n); }
+			difference_type operator-(const Iterator& it) const { return (difference_type)index - (difference_type)it.index; }
+
+			bool operator==(const Iterator& it) const { return index == it.index; }
+			bool operator!=(const Iterator& it) const { return index != it.index; }
+			bool operator<(const Iterator& it) const { return index < it.index; }
+			bool operator<=(const Iterator& it) const { return index <= it.index; }
+			bool operator>(const Iterator& it) const { return index > it.index; }
+			bool operator>=(const Iterator& it) const { return index >= it.index; }
+
+		private:
+			const TextColumn*	column;
+			size_t				index;
+		};
+
+		TextColumn()
+			: offsets(1, 0),
+			unitData(0),
+			offsetData(0),
+			count(0)
+		{
+			attach();
+		}
+
+		TextColumn(TextColumn&& column)
+			: offsets(1, 0),
+			unitData(0),
+			offsetData(0),
+			count(0)
+		{
+			attach();
+			swap(column);
+		}
+
+		TextColumn& operator=(TextColumn&& column)
+		{
+			if (this != &column)
+			{
+				TextColumn temp;
+				temp.swap(column);
+				swap(temp);
+			}
+			return *this;
+		}
+
+		void swap(TextColumn& column)
+		{
+			units.swap(column.units);
+			offsets.swap(column.offsets);
+			std::swap(unitData, column.unitData);
+			std::swap(offsetData, column.offsetData);
+			std::swap(count, column.count);
+			region.swap(column.region);
+		}
+
+		/**
+		 * @brief reserve memory for texts
+		 * @param textCount: the number of texts
+		 * @param unitCount: the total number of utf-16 code units
+		 */
+		void reserve(size_t textCount, size_t unitCount)
+		{
+			detach();
+			offsets.reserve(textCount + 1);
+			units.reserve(unitCount);
+			attach();
+		}
+
+		void append(const muint16* text, size_t length)
+		{
+			const size_t stored = (size_t)offsetData[count];
+			if (length > 0 && text >= unitData && text < unitData + stored)
+			{
+				// a view of the column itself, it is copied by position since the storage can move
+				const size_t from = text - unitData;
+				detach();
+				const size_t old = units.size();
+				units.resize(old + length);
+				memcpy(units.data() + old, units.data() + from, sizeof(muint16)*length);
+			}
+			else
+			{
+				detach();
+				units.insert(units.end(), text, text + length);
+			}
+			offsets.push_back(units.size());
+			count++;
+			attach();
+		}
+
+		void append(const TextView& text)
+		{
+			append(text.data(), text.length());
+		}
+
+		void append(const Text& text)
+		{
+			append(text.data(), text.length());
+		}
+
+		/**
+		 * @brief remove all texts, a mapped file is released
+		 */
+		void clear()
+		{
+			region.close();
+			units.clear();
+			offsets.assign(1, 0);
+			count = 0;
+			attach();
+		}
+
+		size_t size() const
+		{
+			return count;
+		}
+
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		/**
+		 * @brief return the total number of utf-16 code units of all texts
+		 */
+		size_t unitCount() const
+		{
+			return (size_t)offsetData[count];
+		}
+
+		/**
+		 * @brief return true if the texts are read from a mapped file
+		 */
+		bool mapped() const
+		{
+			return region.data() != 0;
+		}
+
+		TextView operator[](size_t index) const
+		{
+			MOE_ERROR(index < count, "TextColumn::operator[](size_t index): Argument index out of range.");
+			return TextView(unitData + offsetData[index], (size_t)(offsetData[index + 1] - offsetData[index]));
+		}
+
+		Text text(size_t index) const
+		{
+			return Text((*this)[index]);
+		}
+
+		Iterator begin() const
+		{
+			return Iterator(this, 0);
+		}
+
+		Iterator end() const
+		{
+			return Iterator(this, count);
+		}
+
+		/**
+		 * @brief return the indices of the texts in ascending order of code units
+		 * @detail the sort is stable, equal texts keep their order.
+		 */
+		std::vector<size_t> sortedOrder() const
+		{
+			std::vector<size_t> order(count);
+			for (size_t i = 0; i < count; i++)
+				order[i] = i;
+			std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b)
+			{
+				return (*this)[a] < (*this)[b];
+			});
+			return order;
+		}
+
+		/**
+		 * @brief rearrange the texts, the i-th text becomes the order[i]-th text of before
+		 * @param order: the indices of the texts, an index can be dropped or repeated
+		 */
+		void permute(const std::vector<size_t>& order)
+		{
+			size_t total = 0;
+			for (size_t i = 0; i < order.size(); i++)
+			{
+				MOE_ERROR(order[i] < count, "TextColumn::permute(const std::vector<size_t>& order): Argument order out of range.");
+				total += (size_t)(offsetData[order[i] + 1] - offsetData[order[i]]);
+			}
+
+			std::vector<muint16> newUnits;
+			std::vector<muint64> newOffsets;
+			newUnits.reserve(total);
+			newOffsets.reserve(order.size() + 1);
+			newOffsets.push_back(0);
+			for (size_t i = 0; i < order.size(); i++)
+			{
+				const muint16* p = unitData + offsetData[order[i]];
+				newUnits.insert(newUnits.end(), p, p + (size_t)(offsetData[order[i] + 1] - offsetData[order[i]]));
+				newOffsets.push_back(newUnits.size());
+			}
+
+			region.close();
+			units.swap(newUnits);
+			offsets.swap(newOffsets);
+			count = order.size();
+			attach();
+		}
+
+		/**
+		 * @brief sort the texts in ascending order of code units
+		 */
+		void sort()
+		{
+			permute(sortedOrder());
+		}
+
+		/**
+		 * @brief write the column into a file which can be mapped by load()
+		 * @return false if the file can not be written
+		 */
+		bool store(const Text& fileName) const
+		{
+			FileStream fs(fileName, FileStream::WriteOnly);
+			if (!fs.writable())
+				return false;
+
+			TextColumn_Internal::Header header;
+			memcpy(header.magic, TextColumn_Internal::magic, sizeof(header.magic));
+			header.count = count;
+			header.units = offsetData[count];
+
+			bool success = write(fs, &header, sizeof(header))
+				&& write(fs, offsetData, sizeof(muint64)*(count + 1))
+				&& write(fs, unitData, sizeof(muint16)*(size_t)offsetData[count]);
+			return success;
+		}
+
+		/**
+		 * @brief map a file written by store() into memory, the texts are not copied
+		 * @return false if the file can not be mapped or is not a stored column, the
+		 * column is left empty in that case
+		 */
+		bool load(const Text& fileName)
+		{
+			clear();
+			if (!region.open(fileName, MappedFile::Random))
+				return false;
+
+			const size_t length = region.length();
+			const char* p = (const char*)region.data();
+			TextColumn_Internal::Header header;
+			if (length < sizeof(header))
+			{
+				clear();
+				return false;
+			}
+			memcpy(&header, p, sizeof(header));
+
+			// the counts are bounded by the length first, so the sizes below can not overflow
+			if (memcmp(header.magic, TextColumn_Internal::magic, sizeof(header.magic)) != 0
+				|| header.count > length / sizeof(muint64)
+				|| header.units > length / sizeof(muint16))
+			{
+				clear();
+				return false;
+			}
+			const muint64 offsetBytes = (header.count + 1) * sizeof(muint64);
+			if (sizeof(header) + offsetBytes + header.units * sizeof(muint16) != length)
+			{
+				clear();
+				return false;
+			}
+
+			offsetData = (const muint64*)(p + sizeof(header));
+			unitData = (const muint16*)(p + sizeof(header) + offsetBytes);
+			count = (size_t)header.count;
+			if (offsetData[0] != 0 || offsetData[count] != header.units)
+			{
+				clear();
+				return false;
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				if (offsetData[i] > offsetData[i + 1])
+				{
+					clear();
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief return the number of bytes used by the texts and the offsets
+		 */
+		size_t memoryUsage() const
+		{
+			if (mapped())
+				return region.length();
+			return units.capacity() * sizeof(muint16) + offsets.capacity() * sizeof(muint64);
+		}
+
+	private:
+		std::vector<muint16>				units;
+		std::vector<muint64>				offsets;
+		const muint16*						unitData;
+		const muint64*						offsetData;
+		size_t								count;
+		MappedFile							region;
+
+		/**
+		 * @brief point the accessors at the vectors
+		 */
+		void attach()
+		{
+			unitData = units.data();
+			offsetData = offsets.data();
+		}
+
+		/**
+		 * @brief copy a mapped file into the vectors before a modification
+		 */
+		void detach()
+		{
+			if (!mapped())
+				return;
+			std::vector<muint16> newUnits(unitData, unitData + (size_t)offsetData[count]);
+			std::vector<muint64> newOffsets(offsetData, offsetData + count + 1);
+			region.close();
+			units.swap(newUnits);
+			offsets.swap(newOffsets);
+			attach();
+		}
+
+		static bool write(FileStream& fs, const void* buffer, size_t size)
+		{
+			if (size == 0)
+				return true;
+			return (size_t)fs.write((void*)buffer, (mint)size) == size;
+		}
+	};
+}
+
+#endif
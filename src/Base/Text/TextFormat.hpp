@@ -0,0 +1,287 @@
+#ifndef MoeLP_Base_TextFormat
+#define MoeLP_Base_TextFormat
+
+#include "../Base.hpp"
+#include "Text.hpp"
+#include "TextBuilder.hpp"
+#include "NumberConvert.hpp"
+
+#include <vector>
+#include <algorithm>
+
+namespace MoeLP
+{
+	namespace TextFormat_Internal
+	{
+		/**
+		 * @brief a type erased reference to one format argument
+		 */
+		class FormatArgument
+		{
+		public:
+			enum Kind
+			{
+				Int32,
+				Int64,
+				UInt32,
+				UInt64,
+				Double,
+				LongDouble,
+				String
+			};
+
+			FormatArgument(mint32 n) : kind(Int32) { value.i32 = n; }
+			FormatArgument(mint64 n) : kind(Int64) { value.i64 = n; }
+			FormatArgument(muint32 n) : kind(UInt32) { value.u32 = n; }
+			FormatArgument(muint64 n) : kind(UInt64) { value.u64 = n; }
+			FormatArgument(double n) : kind(Double) { value.f64 = n; }
+			FormatArgument(long double n) : kind(LongDouble) { value.f80 = n; }
+			FormatArgument(const Text& text) : kind(String), text(&text) {}
+
+			void appendTo(TextBuilder& builder) const
+			{
+				switch (kind)
+				{
+				case Int32:
+					builder.commit(formatInteger(value.i32, builder.grow(maxIntegerLength)));
+					break;
+				case Int64:
+					builder.commit(formatInteger(value.i64, builder.grow(maxIntegerLength)));
+					break;
+				case UInt32:
+					builder.commit(formatInteger(value.u32, builder.grow(maxIntegerLength)));
+					break;
+				case UInt64:
+					builder.commit(formatInteger(value.u64, builder.grow(maxIntegerLength)));
+					break;
+				case Double:
+					builder.commit(formatDouble(value.f64, builder.grow(maxFloatLength)));
+					break;
+				case LongDouble:
+					builder.commit(formatLongDouble(value.f80, builder.grow(maxFloatLength)));
+					break;
+				case String:
+					builder.append(*text);
+					break;
+				}
+			}
+
+		private:
+			Kind kind;
+			union
+			{
+				mint32		i32;
+				mint64		i64;
+				muint32		u32;
+				muint64		u64;
+				double		f64;
+				long double	f80;
+			}value;
+			const Text* text;
+		};
+
+		/**
+		 * @brief keep texts built from non-Text arguments (e.g. const wchar_t*) alive during formatting
+		 */
+		template<typename T>
+		struct ArgumentHolder
+		{
+			typedef const T& type;
+			static const T& hold(const T& arg) { return arg; }
+		};
+
+		template<>
+		struct ArgumentHolder<const wchar_t*>
+		{
+			typedef Text type;
+			static Text hold(const wchar_t* arg) { return Text(arg); }
+		};
+
+		template<>
+		struct ArgumentHolder<wchar_t*>
+		{
+			typedef Text type;
+			static Text hold(const wchar_t* arg) { return Text(arg); }
+		};
+
+		template<size_t N>
+		struct ArgumentHolder<wchar_t[N]>
+		{
+			typedef Text type;
+			static Text hold(const wchar_t* arg) { return Text(arg); }
+		};
+	}
+
+	/**
+	 * @brief a format string that is parsed once and can be applied many times
+	 * @example:
+	 * static const TextFormat format(L"{0}: {1} tokens");
+	 * Text t = format(fileName, count);
+	 * @detail the escapes follow the rules of Text::arg: an escape is "{n}" where n is a decimal
+	 * number, the first argument replaces every escape with the smallest n, the second argument
+	 * replaces the escapes with the next smallest n and so on. Escapes without a matching
+	 * argument are kept as they are. All arguments are written into the output in a single pass.
+	 */
+	class TextFormat
+	{
+	public:
+		TextFormat()
+			: ranks(0)
+		{
+		}
+
+		/**
+		 * @brief parse a format string
+		 * @param pattern: the format string
+		 */
+		explicit TextFormat(const Text& pattern)
+			: pattern(pattern),
+			ranks(0)
+		{
+			parse();
+		}
+
+		explicit TextFormat(const wchar_t* pattern)
+			: pattern(pattern),
+			ranks(0)
+		{
+			parse();
+		}
+
+		/**
+		 * @brief return the number of different escapes in the format string
+		 */
+		size_t argumentCount() const
+		{
+			return ranks;
+		}
+
+		const Text& text() const
+		{
+			return pattern;
+		}
+
+		/**
+		 * @brief write the formatted text into a builder
+		 * @param builder: the builder to append to
+		 * @param args: the arguments, integers, floating numbers and texts are supported
+		 */
+		template<typename... Args>
+		void formatTo(TextBuilder& builder, const Args& ... args) const
+		{
+			formatHold(builder, TextFormat_Internal::ArgumentHolder<Args>::hold(args)...);
+		}
+
+		/**
+		 * @brief return the formatted text
+		 */
+		template<typename... Args>
+		Text format(const Args& ... args) const
+		{
+			TextBuilder builder(pattern.length() + 16 * sizeof...(Args));
+			formatTo(builder, args...);
+			return builder.toText();
+		}
+
+		template<typename... Args>
+		Text operator()(const Args& ... args) const
+		{
+			return format(args...);
+		}
+
+	private:
+		struct Segment
+		{
+			size_t	start;
+			size_t	length;
+			mint	rank;	// -1 means a literal segment
+		};
+
+		Text					pattern;
+		std::vector<Segment>	segments;
+		size_t					ranks;
+
+		void parse()
+		{
+			const muint16* p = pattern.data();
+			size_t size = pattern.length();
+			std::vector<muint32> numbers;
+			std::vector<std::pair<size_t, size_t>> escapes;
+
+			size_t i = 0;
+			while (i < size)
+			{
+				if (p[i] != L'{')
+				{
+					i++;
+					continue;
+				}
+
+				size_t j = i + 1;
+				muint32 number = 0;
+				while (j < size && p[j] >= L'0' && p[j] <= L'9')
+				{
+					number = number * 10 + (p[j] - L'0');
+					j++;
+				}
+
+				if (j > i + 1 && j < size && p[j] == L'}')
+				{
+					escapes.push_back(std::make_pair(i, j + 1));
+					numbers.push_back(number);
+					i = j + 1;
+				}
+				else
+				{
+					i = j;
+				}
+			}
+
+			std::vector<muint32> sorted(numbers);
+			std::sort(sorted.begin(), sorted.end());
+			sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+			ranks = sorted.size();
+
+			size_t last = 0;
+			for (size_t k = 0; k < escapes.size(); k++)
+			{
+				if (escapes[k].first > last)
+				{
+					Segment literal = { last, escapes[k].first - last, -1 };
+					segments.push_back(literal);
+				}
+				mint rank = std::lower_bound(sorted.begin(), sorted.end(), numbers[k]) - sorted.begin();
+				Segment escape = { escapes[k].first, escapes[k].second - escapes[k].first, rank };
+				segments.push_back(escape);
+				last = escapes[k].second;
+			}
+			if (last < size)
+			{
+				Segment literal = { last, size - last, -1 };
+				segments.push_back(literal);
+			}
+		}
+
+		template<typename... Args>
+		void formatHold(TextBuilder& builder, const Args& ... args) const
+		{
+			const TextFormat_Internal::FormatArgument arguments[] = { TextFormat_Internal::FormatArgument(args)..., 0 };
+			apply(builder, arguments, sizeof...(Args));
+		}
+
+		void apply(TextBuilder& builder, const TextFormat_Internal::FormatArgument* arguments, size_t count) const
+		{
+			const muint16* p = pattern.data();
+			for (size_t i = 0; i < segments.size(); i++)
+			{
+				const Segment& segment = segments[i];
+				if (segment.rank >= 0 && (size_t)segment.rank < count)
+					arguments[segment.rank].appendTo(builder);
+				else
+					builder.append(p + segment.start, segment.length);
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef MoeLP_Base_TextNormalizer
+#define MoeLP_Base_TextNormalizer
+
+#include "../Base.hpp"
+#include "Text.hpp"
+#include "TextBuilder.hpp"
+#include "Unicode.hpp"
+#include "TextNormalizerData.hpp"
+
+#include <vector>
+#include <algorithm>
+
+namespace MoeLP
+{
+	/**
+	 * @brief normalize texts before segmentation
+	 * @example:
+	 * TextNormalizer normalizer;
+	 * Text t = normalizer.normalize(L"ＡＢＣ　後來");	// "abc 后来"
+	 * @detail all enabled mappings are composed into one table when the normalizer is created,
+	 * so a text is normalized in a single pass. Runs of ascii characters are processed eight
+	 * code units at a time. Every mapping keeps one code unit as one code unit, only the space
+	 * canonicalization makes the output shorter.
+	 */
+	class TextNormalizer
+	{
+	public:
+		enum Option
+		{
+			FoldWidth = 1,					// full-width forms to ascii, half-width forms to full-width
+			FoldCase = 2,					// Unicode simple case folding
+			CanonicalizeSpace = 4,			// a run of white spaces to one space, or one line break if it contains one
+			TraditionalToSimplified = 8,	// Traditional Chinese characters to Simplified Chinese characters
+			All = 15
+		};
+
+		/**
+		 * @brief create a normalizer
+		 * @param options: a combination of TextNormalizer::Option
+		 */
+		TextNormalizer(mint options = All)
+			: flags(options)
+		{
+			build();
+		}
+
+		mint options() const
+		{
+			return flags;
+		}
+
+		/**
+		 * @brief normalize an utf-16 buffer and append the result to a builder
+		 * @detail the builder can be reused for many texts to avoid allocations.
+		 */
+		void normalize(const muint16* text, size_t length, TextBuilder& builder) const
+		{
+			muint16* out = builder.grow(length);
+			size_t n = 0;
+			size_t i = 0;
+			bool space = false;
+
+			#if defined MOE_SSE2
+			const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+			const __m128i zero = _mm_setzero_si128();
+			while (i + 8 <= length)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)(text + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, nonAscii), zero)) == 0xFFFF)
+				{
+					if (flags & FoldCase)
+						v = _mm_add_epi16(v, _mm_and_si128(Unicode_Internal::rangeMask16(v, 'A', 26), _mm_set1_epi16(0x20)));
+
+					bool simple = true;
+					if (flags & CanonicalizeSpace)
+					{
+						__m128i controls = _mm_or_si128(Unicode_Internal::rangeMask16(v, 0x09, 5), Unicode_Internal::rangeMask16(v, 0x1C, 4));
+						muint32 blanks = (muint32)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(v, _mm_set1_epi16(' ')), zero));
+						simple = _mm_movemask_epi8(controls) == 0 && (blanks & ((blanks << 1) | (space ? 1 : 0))) == 0;
+						if (simple)
+							space = (blanks & 0x80) != 0;
+					}
+
+					if (simple)
+					{
+						_mm_storeu_si128((__m128i*)(out + n), v);
+						n += 8;
+						i += 8;
+						continue;
+					}
+				}
+				else if (!(flags & TraditionalToSimplified)
+					&& _mm_movemask_epi8(Unicode_Internal::hanMask(v)) == 0xFFFF)
+				{
+					_mm_storeu_si128((__m128i*)(out + n), v);
+					space = false;
+					n += 8;
+					i += 8;
+					continue;
+				}
+
+				normalizeRange(text, length, i, i + 8, out, n, space);
+			}
+			#endif
+
+			normalizeRange(text, length, i, length, out, n, space);
+
+			builder.commit(n);
+		}
+
+		Text normalize(const TextView& text) const
+		{
+			TextBuilder builder(text.length());
+			normalize(text.data(), text.length(), builder);
+			return builder.toText();
+		}
+
+		Text normalize(const Text& text) const
+		{
+			return normalize(text.view());
+		}
+
+	private:
+		typedef Unicode_Internal::TwoStageTable<muint16, 0x10000> DeltaTable;
+
+		mint		flags;
+		DeltaTable	deltas;		// the normalized code unit minus the code unit, modulo 0x10000
+
+		void build()
+		{
+			std::vector<muint16> mapping(0x10000), step(0x10000);
+			for (muint32 c = 0; c < 0x10000; c++)
+				mapping[c] = (muint16)c;
+
+			if (flags & FoldWidth)
+				compose(mapping, TextNormalizer_Internal::widthFolding);
+
+			if (flags & FoldCase)
+			{
+				for (muint32 c = 0; c < 0x10000; c++)
+					step[c] = (muint16)c;
+				for (const muint32* pair : TextNormalizer_Internal::simpleCaseFolding)
+				{
+					if (pair[0] < 0x10000)
+						step[pair[0]] = (muint16)pair[1];
+				}
+				for (muint32 c = 0; c < 0x10000; c++)
+					mapping[c] = step[mapping[c]];
+			}
+
+			if (flags & TraditionalToSimplified)
+				compose(mapping, TextNormalizer_Internal::traditionalToSimplified);
+
+			if (flags & CanonicalizeSpace)
+			{
+				for (muint32 c = 0; c < 0x10000; c++)
+				{
+					muint16 m = mapping[c];
+					if (Unicode::characterClass(m) == CharacterClass::Space)
+						mapping[c] = isLineBreak(m) ? L'\n' : L' ';
+				}
+			}
+
+			for (muint32 c = 0; c < 0x10000; c++)
+				step[c] = (muint16)(mapping[c] - c);
+			deltas.build(step.data());
+		}
+
+		template<size_t N>
+		static void compose(std::vector<muint16>& mapping, const muint16 (&pairs)[N][2])
+		{
+			std::vector<muint16> step(0x10000);
+			for (muint32 c = 0; c < 0x10000; c++)
+				step[c] = (muint16)c;
+			for (size_t i = 0; i < N; i++)
+				step[pairs[i][0]] = pairs[i][1];
+			for (muint32 c = 0; c < 0x10000; c++)
+				mapping[c] = step[mapping[c]];
+		}
+
+		static bool isLineBreak(muint16 c)
+		{
+			return (c >= 0x0A && c <= 0x0D) || (c >= 0x1C && c <= 0x1E) || c == 0x85 || c == 0x2028 || c == 0x2029;
+		}
+
+		static muint32 foldSupplementary(muint32 codePoint)
+		{
+			using TextNormalizer_Internal::simpleCaseFolding;
+			const size_t count = sizeof(simpleCaseFolding) / sizeof(simpleCaseFolding[0]);
+			const muint32 (*pair)[2] = std::lower_bound(simpleCaseFolding, simpleCaseFolding + count, codePoint,
+				[](const muint32 (&p)[2], muint32 c) { return p[0] < c; });
+			return pair != simpleCaseFolding + count && (*pair)[0] == codePoint ? (*pair)[1] : codePoint;
+		}
+
+		/**
+		 * @brief normalize the code units from i to end, a surrogate pair at end - 1 is kept together
+		 */
+		void normalizeRange(const muint16* text, size_t length, size_t& position, size_t end, muint16* out, size_t& count, bool& lastSpace) const
+		{
+			const bool canonicalize = (flags & CanonicalizeSpace) != 0;
+			size_t i = position;
+			size_t n = count;
+			bool space = lastSpace;
+
+			while (i < end)
+			{
+				muint16 c = text[i];
+				if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF)
+				{
+					muint32 codePoint = 0x10000 + ((muint32)(c - 0xD800) << 10) + (text[i + 1] - 0xDC00);
+					if (flags & FoldCase)
+						codePoint = foldSupplementary(codePoint);
+					out[n++] = (muint16)(0xD800 + ((codePoint - 0x10000) >> 10));
+					out[n++] = (muint16)(0xDC00 + (codePoint & 0x03FF));
+					space = false;
+					i += 2;
+					continue;
+				}
+
+				muint16 m = (muint16)(c + deltas[c]);
+				i++;
+				if (canonicalize && (m == L' ' || m == L'\n'))
+				{
+					if (space)
+					{
+						if (m == L'\n')
+							out[n - 1] = L'\n';
+						continue;
+					}
+					space = true;
+				}
+				else
+				{
+					space = false;
+				}
+				out[n++] = m;
+			}
+
+			position = i;
+			count = n;
+			lastSpace = space;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef MoeLP_Base_TextSort
+#define MoeLP_Base_TextSort
+
+#include "../Base.hpp"
+#include "../Thead/ThreadPool.hpp"
+#include "Text.hpp"
+#include "TextView.hpp"
+#include "TextColumn.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <future>
+#include <utility>
+
+namespace MoeLP
+{
+	namespace TextSort_Internal
+	{
+		struct Item
+		{
+			const muint16*	text;
+			size_t			length;
+			size_t			index;
+		};
+
+		/**
+		 * @brief the code unit at a depth plus one, or 0 after the end of the text
+		 */
+		inline muint32 unitAt(const Item& item, size_t depth)
+		{
+			return depth < item.length ? (muint32)item.text[depth] + 1 : 0;
+		}
+
+		/**
+		 * @brief compare two items whose first depth code units are equal
+		 */
+		inline bool less(const Item& a, const Item& b, size_t depth, bool stable)
+		{
+			size_t length = a.length < b.length ? a.length : b.length;
+			for (size_t i = depth; i < length; i++)
+			{
+				if (a.text[i] != b.text[i])
+					return a.text[i] < b.text[i];
+			}
+			if (a.length != b.length)
+				return a.length < b.length;
+			return stable && a.index < b.index;
+		}
+
+		inline bool equal(const Item& a, const Item& b)
+		{
+			return a.length == b.length && memcmp(a.text, b.text, sizeof(muint16)*a.length) == 0;
+		}
+
+		/**
+		 * @brief order a group of equal texts
+		 */
+		inline void finishEqual(Item* items, size_t count, bool stable)
+		{
+			if (stable)
+			{
+				std::sort(items, items + count, [](const Item& a, const Item& b) { return a.index < b.index; });
+			}
+		}
+
+		inline void insertionSort(Item* items, size_t count, size_t depth, bool stable)
+		{
+			for (size_t i = 1; i < count; i++)
+			{
+				Item item = items[i];
+				size_t j = i;
+				while (j > 0 && less(item, items[j - 1], depth, stable))
+				{
+					items[j] = items[j - 1];
+					j--;
+				}
+				items[j] = item;
+			}
+		}
+
+		/**
+		 * @brief multikey quicksort of items whose first depth code units are equal
+		 * @detail every partition step looks at one code unit, so a common prefix is read
+		 * once per item instead of once per comparison.
+		 */
+		inline void multikeySort(Item* items, size_t count, size_t depth, bool stable)
+		{
+			static const size_t insertionLimit = 16;
+
+			while (count > insertionLimit)
+			{
+				muint32 a = unitAt(items[0], depth);
+				muint32 b = unitAt(items[count / 2], depth);
+				muint32 c = unitAt(items[count - 1], depth);
+				muint32 pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+				size_t lt = 0, i = 0, gt = count;
+				while (i < gt)
+				{
+					muint32 unit = unitAt(items[i], depth);
+					if (unit < pivot)
+						std::swap(items[lt++], items[i++]);
+					else if (unit > pivot)
+						std::swap(items[i], items[--gt]);
+					else
+						i++;
+				}
+
+				multikeySort(items, lt, depth, stable);
+				multikeySort(items + gt, count - gt, depth, stable);
+
+				items += lt;
+				count = gt - lt;
+				if (pivot == 0)
+				{
+					finishEqual(items, count, stable);
+					return;
+				}
+				depth++;
+			}
+			insertionSort(items, count, depth, stable);
+		}
+
+		/**
+		 * @brief split the items into groups by their code units and sort the groups on a pool
+		 * @detail a group larger than limit is split again on the calling thread by radix
+		 * distribution at the next depth, smaller groups become tasks. The distribution is
+		 * stable, so the tasks see the items in their original order.
+		 */
+		class ParallelSorter
+		{
+		public:
+			ParallelSorter(std::vector<Item>& items, bool stable, ThreadPool& pool, size_t threads)
+				: items(items),
+				buffer(items.size()),
+				counts(0x10001 + 1),
+				stable(stable),
+				pool(pool)
+			{
+				limit = items.size() / (threads * 8);
+				if (limit < minimumTask)
+					limit = minimumTask;
+			}
+
+			void sort()
+			{
+				split(0, items.size(), 0);
+				for (size_t i = 0; i < tasks.size(); i++)
+					tasks[i].get();
+			}
+
+		private:
+			static const size_t minimumTask = 4096;
+			static const size_t maximumDepth = 64;
+
+			std::vector<Item>&				items;
+			std::vector<Item>				buffer;
+			std::vector<size_t>				counts;
+			bool							stable;
+			ThreadPool&						pool;
+			size_t							limit;
+			std::vector<std::future<void>>	tasks;
+
+			void submit(size_t begin, size_t count, size_t depth)
+			{
+				Item* p = items.data() + begin;
+				bool s = stable;
+				tasks.push_back(pool.add([p, count, depth, s]() { multikeySort(p, count, depth, s); }));
+			}
+
+			void split(size_t begin, size_t end, size_t depth)
+			{
+				if (end - begin <= limit || depth >= maximumDepth)
+				{
+					submit(begin, end - begin, depth);
+					return;
+				}
+
+				std::fill(counts.begin(), counts.end(), 0);
+				for (size_t i = begin; i < end; i++)
+					counts[unitAt(items[i], depth) + 1]++;
+				for (size_t k = 1; k < counts.size(); k++)
+					counts[k] += counts[k - 1];
+
+				for (size_t i = begin; i < end; i++)
+					buffer[begin + counts[unitAt(items[i], depth)]++] = items[i];
+				std::copy(buffer.begin() + begin, buffer.begin() + end, items.begin() + begin);
+
+				// counts[k] is now the end of the group of unit k, the groups are kept before
+				// recursing because the recursion reuses counts
+				std::vector<std::pair<size_t, size_t>> groups;
+				size_t start = 0;
+				for (size_t k = 0; k < 0x10001; k++)
+				{
+					// the texts that end at this depth (k == 0) are equal and the distribution kept their order
+					if (k > 0 && counts[k] - start > 1)
+						groups.push_back(std::make_pair(begin + start, begin + counts[k]));
+					start = counts[k];
+				}
+
+				for (size_t g = 0; g < groups.size(); g++)
+					split(groups[g].first, groups[g].second, depth + 1);
+			}
+		};
+	}
+
+	/**
+	 * @brief sort texts by their utf-16 code units
+	 * @example:
+	 * std::vector<Text> words = ...;
+	 * TextSort::sort(words, TextSort::Stable | TextSort::Unique);
+	 * @detail texts are sorted by multikey quicksort, which compares one code unit at a time
+	 * and never compares a common prefix twice. Large inputs are first split by radix
+	 * distribution on the leading code units and the groups are sorted on a ThreadPool. The
+	 * order is the same as TextView::compare.
+	 */
+	class TextSort
+	{
+	public:
+		enum Option
+		{
+			Unstable = 0,
+			Stable = 1,		// equal texts keep their order
+			Unique = 2		// keep one of equal texts, the first one if Stable is set
+		};
+
+		static const size_t parallelThreshold = 1 << 16;
+
+		/**
+		 * @brief return the indices of texts in sorted order
+		 * @param texts: the texts
+		 * @param count: the number of texts
+		 * @param options: a combination of TextSort::Option
+		 * @param pool: the pool to sort on, a temporary pool is used if it is null and
+		 * there are many texts
+		 */
+		static std::vector<size_t> order(const TextView* texts, size_t count, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			std::vector<TextSort_Internal::Item> items(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				items[i].text = texts[i].data();
+				items[i].length = texts[i].length();
+				items[i].index = i;
+			}
+			return sortItems(items, options, pool);
+		}
+
+		static std::vector<size_t> order(const std::vector<TextView>& texts, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			return order(texts.data(), texts.size(), options, pool);
+		}
+
+		static std::vector<size_t> order(const std::vector<Text>& texts, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			std::vector<TextSort_Internal::Item> items(texts.size());
+			for (size_t i = 0; i < texts.size(); i++)
+			{
+				items[i].text = texts[i].data();
+				items[i].length = texts[i].length();
+				items[i].index = i;
+			}
+			return sortItems(items, options, pool);
+		}
+
+		static std::vector<size_t> order(const TextColumn& column, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			std::vector<TextSort_Internal::Item> items(column.size());
+			for (size_t i = 0; i < column.size(); i++)
+			{
+				TextView view = column[i];
+				items[i].text = view.data();
+				items[i].length = view.length();
+				items[i].index = i;
+			}
+			return sortItems(items, options, pool);
+		}
+
+		static void sort(std::vector<Text>& texts, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			std::vector<size_t> indices = order(texts, options, pool);
+			std::vector<Text> sorted;
+			sorted.reserve(indices.size());
+			for (size_t i = 0; i < indices.size(); i++)
+				sorted.push_back(std::move(texts[indices[i]]));
+			texts.swap(sorted);
+		}
+
+		static void sort(std::vector<TextView>& texts, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			std::vector<size_t> indices = order(texts, options, pool);
+			std::vector<TextView> sorted(indices.size());
+			for (size_t i = 0; i < indices.size(); i++)
+				sorted[i] = texts[indices[i]];
+			texts.swap(sorted);
+		}
+
+		static void sort(TextColumn& column, mint options = Unstable, ThreadPool* pool = nullptr)
+		{
+			column.permute(order(column, options, pool));
+		}
+
+	private:
+		static std::vector<size_t> sortItems(std::vector<TextSort_Internal::Item>& items, mint options, ThreadPool* pool)
+		{
+			const bool stable = (options & Stable) != 0;
+			size_t threads = std::thread::hardware_concurrency();
+			if (threads == 0)
+				threads = 1;
+
+			if (items.size() < parallelThreshold || (pool == nullptr && threads == 1))
+			{
+				TextSort_Internal::multikeySort(items.data(), items.size(), 0, stable);
+			}
+			else if (pool)
+			{
+				TextSort_Internal::ParallelSorter(items, stable, *pool, threads).sort();
+			}
+			else
+			{
+				ThreadPool temporary(threads);
+				TextSort_Internal::ParallelSorter(items, stable, temporary, threads).sort();
+			}
+
+			std::vector<size_t> result;
+			result.reserve(items.size());
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				if ((options & Unique) && i > 0 && TextSort_Internal::equal(items[i], items[i - 1]))
+					continue;
+				result.push_back(items[i].index);
+			}
+			return result;
+		}
+	};
+}
+
+#endif
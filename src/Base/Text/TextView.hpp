@@ -0,0 +1,484 @@
+#ifndef MoeLP_Base_TextView
+#define MoeLP_Base_TextView
+
+#include "../Base.hpp"
+
+#include <iterator>
+#include <utility>
+#include <cstring>
+
+namespace MoeLP
+{
+	class TextView;
+
+	template<typename Delimiter, typename View = TextView>
+	class TextSplitRange;
+
+	namespace TextView_Internal
+	{
+		struct CharacterDelimiter;
+		struct TextDelimiter;
+		struct SpaceCharacter;
+
+		template<typename Predicate>
+		struct PredicateDelimiter;
+
+		inline muint32 lowestBit(muint32 mask)
+		{
+			#if defined MOE_MSVC
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return index;
+			#elif defined MOE_GCC
+			return __builtin_ctz(mask);
+			#endif
+		}
+	}
+
+	/**
+	 * @brief a read only view of utf-16 characters owned by someone else
+	 * @detail the view does not copy or own the characters, the owner must outlive the view.
+	 * The characters are not zero terminated.
+	 */
+	class TextView
+	{
+	public:
+		TextView()
+			: buffer(0),
+			size(0)
+		{
+		}
+
+		TextView(const muint16* buffer, size_t length)
+			: buffer(buffer),
+			size(length)
+		{
+		}
+
+		const muint16* data() const
+		{
+			return buffer;
+		}
+
+		size_t length() const
+		{
+			return size;
+		}
+
+		bool empty() const
+		{
+			return size == 0;
+		}
+
+		const muint16* begin() const
+		{
+			return buffer;
+		}
+
+		const muint16* end() const
+		{
+			return buffer + size;
+		}
+
+		muint16 operator[](size_t index) const
+		{
+			MOE_ERROR(index < size, "TextView::operator[](size_t index): Argument index out of range.");
+			return buffer[index];
+		}
+
+		/**
+		 * @brief return a part of the view
+		 * @param index: the begin of the sub view
+		 * @param count: the count of character from index
+		 */
+		TextView subView(size_t index, size_t count) const
+		{
+			MOE_ERROR(index <= size, "TextView::subView(size_t index, size_t count): Argument index out of range.");
+			MOE_ERROR(count <= size - index, "TextView::subView(size_t index, size_t count): Argument count out of range.");
+			return TextView(buffer + index, count);
+		}
+
+		TextView left(size_t count) const
+		{
+			return subView(0, count);
+		}
+
+		TextView right(size_t count) const
+		{
+			MOE_ERROR(count <= size, "TextView::right(size_t count): Argument count out of range.");
+			return TextView(buffer + size - count, count);
+		}
+
+		/**
+		 * @brief return the first position of a character from a position, or -1
+		 */
+		mint find(muint16 c, size_t from = 0) const
+		{
+			size_t i = from;
+			#if defined MOE_SSE2
+			const __m128i pattern = _mm_set1_epi16((short)c);
+			for (; i + 8 <= size; i += 8)
+			{
+				muint32 mask = (muint32)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(buffer + i)), pattern));
+				if (mask != 0)
+					return i + TextView_Internal::lowestBit(mask) / 2;
+			}
+			#endif
+			for (; i < size; i++)
+			{
+				if (buffer[i] == c)
+					return i;
+			}
+			return -1;
+		}
+
+		/**
+		 * @brief return the first position of a text from a position, or -1
+		 */
+		mint find(const TextView& text, size_t from = 0) const
+		{
+			if (text.size == 0)
+				return from <= size ? (mint)from : -1;
+			if (text.size > size)
+				return -1;
+
+			const muint16 first = text.buffer[0];
+			const size_t last = size - text.size;
+			for (size_t i = from; i <= last; i++)
+			{
+				if (buffer[i] == first && memcmp(buffer + i + 1, text.buffer + 1, sizeof(muint16)*(text.size - 1)) == 0)
+					return i;
+			}
+			return -1;
+		}
+
+		/**
+		 * @brief return the last position of a character, or -1
+		 */
+		mint findLast(muint16 c) const
+		{
+			for (size_t i = size; i > 0; i--)
+			{
+				if (buffer[i - 1] == c)
+					return i - 1;
+			}
+			return -1;
+		}
+
+		bool startsWith(const TextView& text) const
+		{
+			return text.size <= size && memcmp(buffer, text.buffer, sizeof(muint16)*text.size) == 0;
+		}
+
+		bool endsWith(const TextView& text) const
+		{
+			return text.size <= size && memcmp(buffer + size - text.size, text.buffer, sizeof(muint16)*text.size) == 0;
+		}
+
+		/**
+		 * @brief compare two views by utf-16 code units
+		 */
+		static mint compare(const TextView& view1, const TextView& view2)
+		{
+			size_t len = view1.size < view2.size ? view1.size : view2.size;
+			for (size_t i = 0; i < len; i++)
+			{
+				mint difference = (mint)view1.buffer[i] - (mint)view2.buffer[i];
+				if (difference != 0)
+					return difference;
+			}
+			return (mint)view1.size - (mint)view2.size;
+		}
+
+		/**
+		 * @brief split the view by a character
+		 * @example: for (TextView field : line.split(L'\t')) {...}
+		 */
+		TextSplitRange<TextView_Internal::CharacterDelimiter> split(muint16 delimiter) const;
+
+		/**
+		 * @brief split the view by a text, the delimiter must outlive the range
+		 */
+		TextSplitRange<TextView_Internal::TextDelimiter> split(const TextView& delimiter) const;
+
+		/**
+		 * @brief split the view at every character for which the predicate returns true
+		 */
+		template<typename Predicate>
+		TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>> splitIf(Predicate predicate) const;
+
+		/**
+		 * @brief the lines of the view, "\r\n" is accepted and a final line break does not add an empty line
+		 */
+		TextSplitRange<TextView_Internal::CharacterDelimiter> lines() const;
+
+		/**
+		 * @brief the non empty pieces of the view separated by white spaces
+		 */
+		TextSplitRange<TextView_Internal::PredicateDelimiter<TextView_Internal::SpaceCharacter>> tokens() const;
+
+		bool operator==(const TextView& view) const
+		{
+			return size == view.size && memcmp(buffer, view.buffer, sizeof(muint16)*size) == 0;
+		}
+
+		bool operator!=(const TextView& view) const
+		{
+			return !(*this == view);
+		}
+
+		bool operator<(const TextView& view) const
+		{
+			return compare(*this, view) < 0;
+		}
+
+		bool operator<=(const TextView& view) const
+		{
+			return compare(*this, view) <= 0;
+		}
+
+		bool operator>(const TextView& view) const
+		{
+			return compare(*this, view) > 0;
+		}
+
+		bool operator>=(const TextView& view) const
+		{
+			return compare(*this, view) >= 0;
+		}
+
+	private:
+		const muint16*	buffer;
+		size_t			size;
+	};
+
+	namespace TextView_Internal
+	{
+		struct CharacterDelimiter
+		{
+			muint16 c;
+
+			/**
+			 * @brief return the position and the length of the next delimiter, the position is -1 if not found
+			 */
+			std::pair<mint, size_t> next(const TextView& view, size_t from) const
+			{
+				return std::make_pair(view.find(c, from), (size_t)1);
+			}
+		};
+
+		struct TextDelimiter
+		{
+			TextView text;
+
+			std::pair<mint, size_t> next(const TextView& view, size_t from) const
+			{
+				if (text.empty())
+					return std::make_pair((mint)-1, (size_t)0);
+				return std::make_pair(view.find(text, from), text.length());
+			}
+		};
+
+		template<typename Predicate>
+		struct PredicateDelimiter
+		{
+			Predicate predicate;
+
+			template<typename View>
+			std::pair<mint, size_t> next(const View& view, size_t from) const
+			{
+				auto p = view.data();
+				for (size_t i = from; i < view.length(); i++)
+				{
+					if (predicate(p[i]))
+						return std::make_pair((mint)i, (size_t)1);
+				}
+				return std::make_pair((mint)-1, (size_t)1);
+			}
+		};
+
+		struct SpaceCharacter
+		{
+			bool operator()(muint16 c) const
+			{
+				return c == 0x0020 || (c >= 0x0009 && c <= 0x000D) || c == 0x00A0 || c == 0x3000
+					|| (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F;
+			}
+		};
+	}
+
+	/**
+	 * @brief a lazy range of the pieces of a view separated by a delimiter
+	 * @detail the pieces are found while iterating, nothing is copied or allocated. View is
+	 * the type of the pieces, TextView or Utf8View.
+	 */
+	template<typename Delimiter, typename View>
+	class TextSplitRange
+	{
+	public:
+		enum Option
+		{
+			KeepEmpty = 0,
+			SkipEmpty = 1,				// drop empty pieces
+			TrimCarriageReturn = 2,		// drop the '\r' at the end of each piece
+			DropLastEmpty = 4			// drop the empty piece after a delimiter at the end
+		};
+
+		class Iterator
+		{
+		public:
+			typedef std::forward_iterator_tag	iterator_category;
+			typedef View						value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef const View*					pointer;
+			typedef const View&					reference;
+
+			Iterator()
+				: range(0),
+				position(0),
+				done(true)
+			{
+			}
+
+			Iterator(const TextSplitRange* range)
+				: range(range),
+				position(0),
+				done(false)
+			{
+				advance();
+			}
+
+			const View& operator*() const
+			{
+				return current;
+			}
+
+			const View* operator->() const
+			{
+				return &current;
+			}
+
+			Iterator& operator++()
+			{
+				advance();
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator it = *this;
+				advance();
+				return it;
+			}
+
+			bool operator==(const Iterator& other) const
+			{
+				if (done || other.done)
+					return done == other.done;
+				return position == other.position && current.data() == other.current.data();
+			}
+
+			bool operator!=(const Iterator& other) const
+			{
+				return !(*this == other);
+			}
+
+		private:
+			const TextSplitRange*	range;
+			View					current;
+			size_t					position;	// the start of the next piece, length + 1 when finished
+			bool					done;
+
+			void advance()
+			{
+				const View& view = range->view;
+				for (;;)
+				{
+					if (position > view.length())
+					{
+						done = true;
+						return;
+					}
+
+					std::pair<mint, size_t> index = range->delimiter.next(view, position);
+					size_t pieceEnd = index.first == -1 ? view.length() : (size_t)index.first;
+					size_t pieceStart = position;
+					position = index.first == -1 ? view.length() + 1 : pieceEnd + index.second;
+
+					if (index.first == -1 && pieceStart == view.length() && pieceStart > 0
+						&& (range->options & DropLastEmpty))
+					{
+						done = true;
+						return;
+					}
+
+					if ((range->options & TrimCarriageReturn) && pieceEnd > pieceStart && view.data()[pieceEnd - 1] == L'\r')
+						pieceEnd--;
+
+					if (pieceEnd == pieceStart && (range->options & SkipEmpty))
+						continue;
+
+					current = View(view.data() + pieceStart, pieceEnd - pieceStart);
+					return;
+				}
+			}
+		};
+
+		TextSplitRange(const View& view, const Delimiter& delimiter, mint options = KeepEmpty)
+			: view(view),
+			delimiter(delimiter),
+			options(options)
+		{
+		}
+
+		Iterator begin() const
+		{
+			return Iterator(this);
+		}
+
+		Iterator end() const
+		{
+			return Iterator();
+		}
+
+	private:
+		View		view;
+		Delimiter	delimiter;
+		mint		options;
+	};
+
+	inline TextSplitRange<TextView_Internal::CharacterDelimiter> TextView::split(muint16 delimiter) const
+	{
+		TextView_Internal::CharacterDelimiter d = { delimiter };
+		return TextSplitRange<TextView_Internal::CharacterDelimiter>(*this, d);
+	}
+
+	inline TextSplitRange<TextView_Internal::TextDelimiter> TextView::split(const TextView& delimiter) const
+	{
+		TextView_Internal::TextDelimiter d = { delimiter };
+		return TextSplitRange<TextView_Internal::TextDelimiter>(*this, d);
+	}
+
+	template<typename Predicate>
+	inline TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>> TextView::splitIf(Predicate predicate) const
+	{
+		TextView_Internal::PredicateDelimiter<Predicate> d = { predicate };
+		return TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>>(*this, d);
+	}
+
+	inline TextSplitRange<TextView_Internal::CharacterDelimiter> TextView::lines() const
+	{
+		typedef TextSplitRange<TextView_Internal::CharacterDelimiter> Range;
+		TextView_Internal::CharacterDelimiter d = { L'\n' };
+		return Range(*this, d, Range::TrimCarriageReturn | Range::DropLastEmpty);
+	}
+
+	inline TextSplitRange<TextView_Internal::PredicateDelimiter<TextView_Internal::SpaceCharacter>> TextView::tokens() const
+	{
+		typedef TextSplitRange<TextView_Internal::PredicateDelimiter<TextView_Internal::SpaceCharacter>> Range;
+		TextView_Internal::PredicateDelimiter<TextView_Internal::SpaceCharacter> d = { TextView_Internal::SpaceCharacter() };
+		return Range(*this, d, Range::SkipEmpty);
+	}
+}
+
+#endif
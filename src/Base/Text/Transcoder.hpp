@@ -0,0 +1,667 @@
+#ifndef MoeLP_Base_Transcoder
+#define MoeLP_Base_Transcoder
+
+#include "../Base.hpp"
+#include "CodeConvert.hpp"
+
+namespace MoeLP
+{
+	/**
+	 * @brief what a transcoder does with an ill-formed sequence
+	 * @detail Replace writes U+FFFD for it, Skip drops it, Stop writes nothing more and
+	 * marks the transcoder as failed.
+	 */
+	enum class TranscodeErrorMode : muint8
+	{
+		Replace,
+		Skip,
+		Stop
+	};
+
+	namespace Transcoder_Internal
+	{
+		/**
+		 * @brief return the length of the sequence a lead byte starts, 1 for a byte that starts none
+		 */
+		inline size_t sequenceLength(muint8 b)
+		{
+			if (b >= 0xC2 && b <= 0xDF)
+				return 2;
+			if (b >= 0xE0 && b <= 0xEF)
+				return 3;
+			if (b >= 0xF0 && b <= 0xF4)
+				return 4;
+			return 1;
+		}
+
+		/**
+		 * @brief return the number of bytes at the end of a buffer that begin a well-formed sequence
+		 * without completing it, 0 if the buffer does not end inside a sequence
+		 */
+		inline size_t incompleteTail(const muint8* begin, const muint8* end)
+		{
+			// only the last non continuation byte can begin an unfinished sequence
+			const muint8* p = end;
+			while (p > begin && end - p < 4 && (p[-1] & 0xC0) == 0x80)
+				p--;
+			if (p == begin)
+				return 0;
+			p--;
+
+			muint32 codePoint;
+			size_t read = CodeConvert_Internal::decodeUtf8(p, end, codePoint);
+			return p + read == end && read < sequenceLength(*p) ? read : 0;
+		}
+
+		/**
+		 * @brief return whether decodeUtf8 gave U+FFFD for an ill-formed sequence
+		 * @detail EF BF BD is the only well-formed encoding of U+FFFD and it is the only
+		 * 3 bytes result beginning with EF.
+		 */
+		inline bool illFormed(const muint8* p, size_t read, muint32 codePoint)
+		{
+			return codePoint == 0xFFFD && !(read == 3 && p[0] == 0xEF);
+		}
+
+		inline void writeUtf16(muint32 codePoint, muint16*& out)
+		{
+			if (codePoint >= 0x10000)
+			{
+				*out++ = (muint16)(0xD800 + ((codePoint - 0x10000) >> 10));
+				*out++ = (muint16)(0xDC00 + (codePoint & 0x03FF));
+			}
+			else
+			{
+				*out++ = (muint16)codePoint;
+			}
+		}
+	}
+
+	/**
+	 * @brief decode utf-8 bytes into utf-16 code units chunk by chunk
+	 * @example:
+	 * Utf8Decoder decoder;
+	 * while ((read = fs.read(bytes, sizeof(bytes))) > 0)
+	 *     builder.commit(decoder.feed(bytes, read, builder.grow(Utf8Decoder::maxOutput(read))));
+	 * builder.commit(decoder.finish(builder.grow(Utf8Decoder::maxFinishOutput)));
+	 * @detail a sequence cut by the end of a chunk is kept, at most 3 bytes, and completed by
+	 * the next chunk, so the chunks can be of any size and every byte is decoded once. The
+	 * result is the same as decoding all the bytes at once with utf8ToUtf16.
+	 */
+	class Utf8Decoder
+	{
+	public:
+		/**
+		 * @brief the largest number of code units feed writes for a number of bytes
+		 */
+		static size_t maxOutput(size_t length)
+		{
+			return length + 3;
+		}
+
+		/**
+		 * @brief the largest number of code units finish writes
+		 */
+		static const size_t maxFinishOutput = 1;
+
+		explicit Utf8Decoder(TranscodeErrorMode mode = TranscodeErrorMode::Replace)
+			: mode(mode)
+		{
+			reset();
+		}
+
+		/**
+		 * @brief forget the bytes kept from the last chunk and the error
+		 */
+		void reset()
+		{
+			pendingCount = 0;
+			position = 0;
+			errorPosition = -1;
+		}
+
+		/**
+		 * @brief decode a chunk
+		 * @param bytes: the bytes of the chunk
+		 * @param length: the number of bytes
+		 * @param out: the output, it should be able to contain maxOutput(length) code units
+		 * @return the number of code units written
+		 */
+		size_t feed(const char* bytes, size_t length, muint16* out)
+		{
+			const muint8* p = (const muint8*)bytes;
+			const muint8* end = p + length;
+			muint16* begin = out;
+			if (failed())
+				return 0;
+
+			if (pendingCount > 0)
+			{
+				// complete the kept sequence with the first bytes of the chunk
+				muint8 sequence[8];
+				size_t count = pendingCount;
+				memcpy(sequence, pending, pendingCount);
+				while (count < 4 && p + (count - pendingCount) < end)
+				{
+					sequence[count] = p[count - pendingCount];
+					count++;
+				}
+
+				muint32 codePoint;
+				size_t read = CodeConvert_Internal::decodeUtf8(sequence, sequence + count, codePoint);
+				if (read == count && read < Transcoder_Internal::sequenceLength(sequence[0]))
+				{
+					memcpy(pending, sequence, count);
+					pendingCount = count;
+					position += length;
+					return 0;
+				}
+
+				p += read - pendingCount;
+				mint64 at = position - (mint64)pendingCount;
+				pendingCount = 0;
+				if (!put(codePoint, Transcoder_Internal::illFormed(sequence, read, codePoint), at, out))
+					return out - begin;
+			}
+
+			size_t tail = Transcoder_Internal::incompleteTail(p, end);
+			const muint8* stop = end - tail;
+			if (mode == TranscodeErrorMode::Replace)
+			{
+				out += utf8ToUtf16((const char*)p, stop - p, out);
+			}
+			else
+			{
+				while (p < stop)
+				{
+					if (*p < 0x80)
+					{
+						*out++ = *p++;
+						continue;
+					}
+
+					muint32 codePoint;
+					size_t read = CodeConvert_Internal::decodeUtf8(p, stop, codePoint);
+					mint64 at = position + (p - (const muint8*)bytes);
+					bool illFormed = Transcoder_Internal::illFormed(p, read, codePoint);
+					p += read;
+					if (!put(codePoint, illFormed, at, out))
+						return out - begin;
+				}
+			}
+
+			memcpy(pending, stop, tail);
+			pendingCount = tail;
+			position += length;
+			return out - begin;
+		}
+
+		/**
+		 * @brief end the input, a sequence left unfinished is an ill-formed sequence
+		 * @param out: the output, it should be able to contain maxFinishOutput code units
+		 * @return the number of code units written
+		 */
+		size_t finish(muint16* out)
+		{
+			muint16* begin = out;
+			if (pendingCount > 0 && !failed())
+				put(0xFFFD, true, position - pendingCount, out);
+			pendingCount = 0;
+			return out - begin;
+		}
+
+		/**
+		 * @brief return whether an ill-formed sequence stopped the decoder, only with TranscodeErrorMode::Stop
+		 */
+		bool failed() const
+		{
+			return mode == TranscodeErrorMode::Stop && errorPosition >= 0;
+		}
+
+		/**
+		 * @brief return the position in bytes of the first ill-formed sequence from the last reset, or -1
+		 * @detail the positions are only tracked with TranscodeErrorMode::Skip and TranscodeErrorMode::Stop,
+		 * the replacing decoder converts in bulk and always returns -1.
+		 */
+		mint64 firstError() const
+		{
+			return errorPosition;
+		}
+
+		/**
+		 * @brief return the number of bytes kept for the next chunk
+		 */
+		size_t pendingBytes() const
+		{
+			return pendingCount;
+		}
+
+	private:
+		TranscodeErrorMode	mode;
+		muint8				pending[4];
+		size_t				pendingCount;
+		mint64				position;			// the number of bytes fed before the current chunk
+		mint64				errorPosition;
+
+		bool put(muint32 codePoint, bool illFormed, mint64 at, muint16*& out)
+		{
+			if (illFormed && mode != TranscodeErrorMode::Replace)
+			{
+				if (errorPosition < 0)
+					errorPosition = at;
+				return mode != TranscodeErrorMode::Stop;
+			}
+			Transcoder_Internal::writeUtf16(codePoint, out);
+			return true;
+		}
+	};
+
+	/**
+	 * @brief encode utf-16 code units into utf-8 bytes chunk by chunk
+	 * @example:
+	 * Utf16Encoder encoder;
+	 * for (const Text& piece : pieces)
+	 *     fs.write(bytes, encoder.feed(piece.data(), piece.length(), bytes));
+	 * fs.write(bytes, encoder.finish(bytes));
+	 * @detail a high surrogate at the end of a chunk is kept and paired with the first code
+	 * unit of the next chunk. An unpaired surrogate is an ill-formed sequence.
+	 */
+	class Utf16Encoder
+	{
+	public:
+		/**
+		 * @brief the largest number of bytes feed writes for a number of code units
+		 */
+		static size_t maxOutput(size_t length)
+		{
+			return length * 3 + 3;
+		}
+
+		/**
+		 * @brief the largest number of bytes finish writes
+		 */
+		static const size_t maxFinishOutput = 3;
+
+		explicit Utf16Encoder(TranscodeErrorMode mode = TranscodeErrorMode::Replace)
+			: mode(mode)
+		{
+			reset();
+		}
+
+		void reset()
+		{
+			pending = 0;
+			position = 0;
+			errorPosition = -1;
+		}
+
+		/**
+		 * @brief encode a chunk
+		 * @param units: the code units of the chunk
+		 * @param length: the number of code units
+		 * @param out: the output, it should be able to contain maxOutput(length) bytes
+		 * @return the number of bytes written
+		 */
+		size_t feed(const muint16* units, size_t length, char* out)
+		{
+			const muint16* p = units;
+			const muint16* end = p + length;
+			muint8* o = (muint8*)out;
+			if (failed() || length == 0)
+				return 0;
+
+			if (pending != 0)
+			{
+				if (*p >= 0xDC00 && *p <= 0xDFFF)
+				{
+					o += CodeConvert_Internal::encodeUtf8(0x10000 + ((pending - 0xD800) << 10) + (*p - 0xDC00), o);
+					p++;
+				}
+				else if (!put(0xFFFD, true, position - 1, o))
+				{
+					pending = 0;
+					return (char*)o - out;
+				}
+				pending = 0;
+			}
+
+			const muint16* stop = end;
+			if (p < stop && stop[-1] >= 0xD800 && stop[-1] <= 0xDBFF)
+				stop--;
+
+			if (mode == TranscodeErrorMode::Replace)
+			{
+				o += utf16ToUtf8(p, stop - p, (char*)o);
+			}
+			else
+			{
+				while (p < stop)
+				{
+					muint32 c = *p;
+					if (c < 0xD800 || c > 0xDFFF)
+					{
+						o += CodeConvert_Internal::encodeUtf8(c, o);
+						p++;
+					}
+					else if (c <= 0xDBFF && p + 1 < stop && p[1] >= 0xDC00 && p[1] <= 0xDFFF)
+					{
+						o += CodeConvert_Internal::encodeUtf8(0x10000 + ((c - 0xD800) << 10) + (p[1] - 0xDC00), o);
+						p += 2;
+					}
+					else
+					{
+						if (!put(0xFFFD, true, position + (p - units), o))
+							return (char*)o - out;
+						p++;
+					}
+				}
+			}
+
+			if (stop != end)
+				pending = *stop;
+			position += length;
+			return (char*)o - out;
+		}
+
+		/**
+		 * @brief end the input, a high surrogate left unpaired is an ill-formed sequence
+		 * @param out: the output, it should be able to contain maxFinishOutput bytes
+		 * @return the number of bytes written
+		 */
+		size_t finish(char* out)
+		{
+			muint8* o = (muint8*)out;
+			if (pending != 0 && !failed())
+				put(0xFFFD, true, position - 1, o);
+			pending = 0;
+			return (char*)o - out;
+		}
+
+		bool failed() const
+		{
+			return mode == TranscodeErrorMode::Stop && errorPosition >= 0;
+		}
+
+		/**
+		 * @brief return the position in code units of the first unpaired surrogate from the last reset, or -1
+		 * @detail like Utf8Decoder::firstError, always -1 with TranscodeErrorMode::Replace.
+		 */
+		mint64 firstError() const
+		{
+			return errorPosition;
+		}
+
+	private:
+		TranscodeErrorMode	mode;
+		muint16				pending;			// a high surrogate waiting for the next chunk, or 0
+		mint64				position;
+		mint64				errorPosition;
+
+		bool put(muint32 codePoint, bool illFormed, mint64 at, muint8*& out)
+		{
+			if (illFormed && mode != TranscodeErrorMode::Replace)
+			{
+				if (errorPosition < 0)
+					errorPosition = at;
+				return mode != TranscodeErrorMode::Stop;
+			}
+			out += CodeConvert_Internal::encodeUtf8(codePoint, out);
+			return true;
+		}
+	};
+
+	/**
+	 * @brief decode GB18030 bytes into utf-16 code units chunk by chunk
+	 * @detail works like Utf8Decoder. A code cut by the end of a chunk is kept, at most 3
+	 * bytes, and the codes are read with the same rules as gb18030ToUtf16.
+	 */
+	class Gb18030Decoder
+	{
+	public:
+		static size_t maxOutput(size_t length)
+		{
+			return length + 3;
+		}
+
+		static const size_t maxFinishOutput = 3;
+
+		explicit Gb18030Decoder(TranscodeErrorMode mode = TranscodeErrorMode::Replace)
+			: mode(mode)
+		{
+			reset();
+		}
+
+		void reset()
+		{
+			pendingCount = 0;
+			position = 0;
+			errorPosition = -1;
+		}
+
+		/**
+		 * @brief decode a chunk
+		 * @param bytes: the bytes of the chunk
+		 * @param length: the number of bytes
+		 * @param out: the output, it should be able to contain maxOutput(length) code units
+		 * @return the number of code units written
+		 */
+		size_t feed(const char* bytes, size_t length, muint16* out)
+		{
+			const muint8* p = (const muint8*)bytes;
+			const muint8* end = p + length;
+			muint16* begin = out;
+			if (failed())
+				return 0;
+
+			if (pendingCount > 0)
+			{
+				// the kept bytes and the first bytes of the chunk hold every code that begins in the kept bytes
+				muint8 sequence[8];
+				size_t taken = length < 4 ? length : 4;
+				memcpy(sequence, pending, pendingCount);
+				memcpy(sequence + pendingCount, p, taken);
+				const muint8* q = sequence;
+				const muint8* last = sequence + pendingCount + taken;
+				while (q < sequence + pendingCount)
+				{
+					if (taken == length && Gb18030_Internal::incomplete(q, last))
+					{
+						pendingCount = last - q;
+						memmove(pending, q, pendingCount);
+						position += length;
+						return out - begin;
+					}
+					if (!decodeOne(q, last, position - (mint64)pendingCount + (q - sequence), out))
+						return out - begin;
+				}
+				p += q - sequence - pendingCount;
+				pendingCount = 0;
+			}
+
+			for (;;)
+			{
+				p = Gb18030_Internal::decodeRun(p, end, out, mode == TranscodeErrorMode::Replace, true);
+				if (p == end || Gb18030_Internal::incomplete(p, end))
+					break;
+				if (!decodeOne(p, end, position + (p - (const muint8*)bytes), out))
+					return out - begin;
+			}
+
+			pendingCount = end - p;
+			memcpy(pending, p, pendingCount);
+			position += length;
+			return out - begin;
+		}
+
+		/**
+		 * @brief end the input, a code left unfinished is ill-formed
+		 * @detail as in gb18030ToUtf16, only the lead byte of the unfinished code is replaced
+		 * and the bytes after it are decoded again.
+		 */
+		size_t finish(muint16* out)
+		{
+			muint16* begin = out;
+			const muint8* p = pending;
+			const muint8* end = pending + pendingCount;
+			while (p < end && !failed())
+				decodeOne(p, end, position - (mint64)(end - p), out);
+			pendingCount = 0;
+			return out - begin;
+		}
+
+		bool failed() const
+		{
+			return mode == TranscodeErrorMode::Stop && errorPosition >= 0;
+		}
+
+		/**
+		 * @brief return the position in bytes of the first ill-formed code from the last reset, or -1
+		 * @detail like Utf8Decoder::firstError, always -1 with TranscodeErrorMode::Replace.
+		 */
+		mint64 firstError() const
+		{
+			return errorPosition;
+		}
+
+	private:
+		TranscodeErrorMode	mode;
+		muint8				pending[4];
+		size_t				pendingCount;
+		mint64				position;
+		mint64				errorPosition;
+
+		bool decodeOne(const muint8*& p, const muint8* end, mint64 at, muint16*& out)
+		{
+			muint32 codePoint;
+			p += Gb18030_Internal::decodeCode(p, end, codePoint);
+			if (codePoint == Gb18030_Internal::illFormed)
+			{
+				if (mode != TranscodeErrorMode::Replace)
+				{
+					if (errorPosition < 0)
+						errorPosition = at;
+					return mode != TranscodeErrorMode::Stop;
+				}
+				codePoint = 0xFFFD;
+			}
+			Transcoder_Internal::writeUtf16(codePoint, out);
+			return true;
+		}
+	};
+
+	/**
+	 * @brief encode utf-16 code units into GB18030 bytes chunk by chunk
+	 * @detail works like Utf16Encoder, a high surrogate at the end of a chunk is kept.
+	 */
+	class Gb18030Encoder
+	{
+	public:
+		static size_t maxOutput(size_t length)
+		{
+			return length * 4 + 4;
+		}
+
+		static const size_t maxFinishOutput = 4;
+
+		explicit Gb18030Encoder(TranscodeErrorMode mode = TranscodeErrorMode::Replace)
+			: mode(mode)
+		{
+			reset();
+		}
+
+		void reset()
+		{
+			pending = 0;
+			position = 0;
+			errorPosition = -1;
+		}
+
+		/**
+		 * @brief encode a chunk
+		 * @param units: the code units of the chunk
+		 * @param length: the number of code units
+		 * @param out: the output, it should be able to contain maxOutput(length) bytes
+		 * @return the number of bytes written
+		 */
+		size_t feed(const muint16* units, size_t length, char* out)
+		{
+			const muint16* p = units;
+			const muint16* end = p + length;
+			muint8* o = (muint8*)out;
+			if (failed() || length == 0)
+				return 0;
+
+			if (pending != 0)
+			{
+				if (*p >= 0xDC00 && *p <= 0xDFFF)
+				{
+					o += Gb18030_Internal::encodeCode(0x10000 + ((pending - 0xD800) << 10) + (*p - 0xDC00), o);
+					p++;
+				}
+				else if (!unpaired(position - 1, o))
+				{
+					pending = 0;
+					return (char*)o - out;
+				}
+				pending = 0;
+			}
+
+			for (;;)
+			{
+				p = Gb18030_Internal::encodeRun(p, end, o, mode == TranscodeErrorMode::Replace, true);
+				if (p == end)
+					break;
+				if (p + 1 == end && *p <= 0xDBFF)
+				{
+					pending = *p;
+					break;
+				}
+				if (!unpaired(position + (p - units), o))
+					return (char*)o - out;
+				p++;
+			}
+
+			position += length;
+			return (char*)o - out;
+		}
+
+		size_t finish(char* out)
+		{
+			muint8* o = (muint8*)out;
+			if (pending != 0 && !failed())
+				unpaired(position - 1, o);
+			pending = 0;
+			return (char*)o - out;
+		}
+
+		bool failed() const
+		{
+			return mode == TranscodeErrorMode::Stop && errorPosition >= 0;
+		}
+
+		mint64 firstError() const
+		{
+			return errorPosition;
+		}
+
+	private:
+		TranscodeErrorMode	mode;
+		muint16				pending;
+		mint64				position;
+		mint64				errorPosition;
+
+		bool unpaired(mint64 at, muint8*& out)
+		{
+			if (mode != TranscodeErrorMode::Replace)
+			{
+				if (errorPosition < 0)
+					errorPosition = at;
+				return mode != TranscodeErrorMode::Stop;
+			}
+			out += Gb18030_Internal::encodeCode(0xFFFD, out);
+			return true;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,446 @@
+#ifndef MoeLP_Base_Unicode
+#define MoeLP_Base_Unicode
+
+#include "../Base.hpp"
+#include "UnicodeData.hpp"
+#include "TextView.hpp"
+
+#include <map>
+#include <string>
+#include <algorithm>
+
+namespace MoeLP
+{
+	/**
+	 * @brief the general category of a code point
+	 */
+	enum class UnicodeCategory : muint8
+	{
+		UppercaseLetter,		// Lu
+		LowercaseLetter,		// Ll
+		TitlecaseLetter,		// Lt
+		ModifierLetter,			// Lm
+		OtherLetter,			// Lo
+		NonspacingMark,			// Mn
+		SpacingMark,			// Mc
+		EnclosingMark,			// Me
+		DecimalNumber,			// Nd
+		LetterNumber,			// Nl
+		OtherNumber,			// No
+		ConnectorPunctuation,	// Pc
+		DashPunctuation,		// Pd
+		OpenPunctuation,		// Ps
+		ClosePunctuation,		// Pe
+		InitialPunctuation,		// Pi
+		FinalPunctuation,		// Pf
+		OtherPunctuation,		// Po
+		MathSymbol,				// Sm
+		CurrencySymbol,			// Sc
+		ModifierSymbol,			// Sk
+		OtherSymbol,			// So
+		SpaceSeparator,			// Zs
+		LineSeparator,			// Zl
+		ParagraphSeparator,		// Zp
+		Control,				// Cc
+		Format,					// Cf
+		Surrogate,				// Cs
+		PrivateUse,				// Co
+		Unassigned				// Cn
+	};
+
+	/**
+	 * @brief the script of a code point
+	 */
+	enum class UnicodeScript : muint8
+	{
+		Unknown, Common, Inherited, Adlam, Ahom, AnatolianHieroglyphs,
+		Arabic, Armenian, Avestan, Balinese, Bamum, BassaVah,
+		Batak, Bengali, Bhaiksuki, Bopomofo, Brahmi, Braille,
+		Buginese, Buhid, CanadianAboriginal, Carian, CaucasianAlbanian, Chakma,
+		Cham, Cherokee, Chorasmian, Coptic, Cuneiform, Cypriot,
+		CyproMinoan, Cyrillic, Deseret, Devanagari, DivesAkuru, Dogra,
+		Duployan, EgyptianHieroglyphs, Elbasan, Elymaic, Ethiopic, Georgian,
+		Glagolitic, Gothic, Grantha, Greek, Gujarati, GunjalaGondi,
+		Gurmukhi, Han, Hangul, HanifiRohingya, Hanunoo, Hatran,
+		Hebrew, Hiragana, ImperialAramaic, InscriptionalPahlavi, InscriptionalParthian, Javanese,
+		Kaithi, Kannada, Katakana, KayahLi, Kharoshthi, KhitanSmallScript,
+		Khmer, Khojki, Khudawadi, Lao, Latin, Lepcha,
+		Limbu, LinearA, LinearB, Lisu, Lycian, Lydian,
+		Mahajani, Makasar, Malayalam, Mandaic, Manichaean, Marchen,
+		MasaramGondi, Medefaidrin, MeeteiMayek, MendeKikakui, MeroiticCursive, MeroiticHieroglyphs,
+		Miao, Modi, Mongolian, Mro, Multani, Myanmar,
+		Nabataean, Nandinagari, NewTaiLue, Newa, Nko, Nushu,
+		NyiakengPuachueHmong, Ogham, OlChiki, OldHungarian, OldItalic, OldNorthArabian,
+		OldPermic, OldPersian, OldSogdian, OldSouthArabian, OldTurkic, OldUyghur,
+		Oriya, Osage, Osmanya, PahawhHmong, Palmyrene, PauCinHau,
+		PhagsPa, Phoenician, PsalterPahlavi, Rejang, Runic, Samaritan,
+		Saurashtra, Sharada, Shavian, Siddham, SignWriting, Sinhala,
+		Sogdian, SoraSompeng, Soyombo, Sundanese, SylotiNagri, Syriac,
+		Tagalog, Tagbanwa, TaiLe, TaiTham, TaiViet, Takri,
+		Tamil, Tangsa, Tangut, Telugu, Thaana, Thai,
+		Tibetan, Tifinagh, Tirhuta, Toto, Ugaritic, Vai,
+		Vithkuqi, Wancho, WarangCiti, Yezidi, Yi, ZanabazarSquare
+	};
+
+	/**
+	 * @brief a coarse class of a character, used as a character type feature
+	 * @detail
+	 * Space: separators and white space controls
+	 * Digit: decimal digits of any script, including full-width digits
+	 * Number: other numbers, e.g. roman numerals and circled numbers
+	 * Letter: letters that are not Han, Kana or Hangul
+	 * Han: Chinese characters, including the extensions and compatibility ideographs
+	 * Kana: Hiragana and Katakana letters
+	 * Hangul: Hangul letters
+	 * Punctuation, Symbol and Mark: the punctuations, symbols and marks of any script
+	 * Other: controls, formats, surrogates, private use and unassigned code points
+	 */
+	enum class CharacterClass : muint8
+	{
+		Other,
+		Space,
+		Digit,
+		Number,
+		Letter,
+		Han,
+		Kana,
+		Hangul,
+		Punctuation,
+		Symbol,
+		Mark
+	};
+
+	namespace Unicode_Internal
+	{
+		/**
+		 * @brief a two-stage table of the properties of the code points below Limit
+		 * @detail the code points are cut into blocks of blockSize, blocks with the same
+		 * content are stored once and the first stage maps a block number to its content.
+		 */
+		template<typename T, muint32 Limit>
+		class TwoStageTable
+		{
+		public:
+			static const muint32 limit = Limit;
+			static const muint32 blockShift = 7;
+			static const muint32 blockSize = 1 << blockShift;
+
+			/**
+			 * @brief build the table from a flat array of limit values
+			 */
+			void build(const T* values)
+			{
+				std::map<std::string, muint16> known;
+				blocks.clear();
+				for (muint32 i = 0; i < (limit >> blockShift); i++)
+				{
+					std::string block((const char*)(values + (i << blockShift)), sizeof(T)*blockSize);
+					auto it = known.find(block);
+					if (it == known.end())
+					{
+						it = known.insert(std::make_pair(block, (muint16)known.size())).first;
+						blocks.insert(blocks.end(), values + (i << blockShift), values + ((i + 1) << blockShift));
+					}
+					index[i] = it->second;
+				}
+			}
+
+			T operator[](muint32 codePoint) const
+			{
+				return blocks[((size_t)index[codePoint >> blockShift] << blockShift) | (codePoint & (blockSize - 1))];
+			}
+
+		private:
+			muint16			index[limit >> blockShift];
+			std::vector<T>	blocks;
+		};
+
+		typedef TwoStageTable<muint8, 0x40000> PropertyTable;
+
+		template<size_t N>
+		inline muint8 findRange(const UnicodeRange (&ranges)[N], muint32 codePoint)
+		{
+			const UnicodeRange* range = std::upper_bound(ranges, ranges + N, codePoint,
+				[](muint32 c, const UnicodeRange& r) { return c < r.start; });
+			return (range - 1)->value;
+		}
+
+		inline CharacterClass toCharacterClass(UnicodeCategory category, UnicodeScript script, muint32 codePoint)
+		{
+			switch (category)
+			{
+			case UnicodeCategory::SpaceSeparator:
+			case UnicodeCategory::LineSeparator:
+			case UnicodeCategory::ParagraphSeparator:
+				return CharacterClass::Space;
+			case UnicodeCategory::Control:
+				return (codePoint >= 0x09 && codePoint <= 0x0D) || (codePoint >= 0x1C && codePoint <= 0x1F) || codePoint == 0x85 ?
+					CharacterClass::Space : CharacterClass::Other;
+			case UnicodeCategory::DecimalNumber:
+				return CharacterClass::Digit;
+			case UnicodeCategory::LetterNumber:
+			case UnicodeCategory::OtherNumber:
+				return script == UnicodeScript::Han ? CharacterClass::Han : CharacterClass::Number;
+			case UnicodeCategory::UppercaseLetter:
+			case UnicodeCategory::LowercaseLetter:
+			case UnicodeCategory::TitlecaseLetter:
+			case UnicodeCategory::ModifierLetter:
+			case UnicodeCategory::OtherLetter:
+				switch (script)
+				{
+				case UnicodeScript::Han:
+					return CharacterClass::Han;
+				case UnicodeScript::Hiragana:
+				case UnicodeScript::Katakana:
+					return CharacterClass::Kana;
+				case UnicodeScript::Hangul:
+					return CharacterClass::Hangul;
+				default:
+					return CharacterClass::Letter;
+				}
+			case UnicodeCategory::ConnectorPunctuation:
+			case UnicodeCategory::DashPunctuation:
+			case UnicodeCategory::OpenPunctuation:
+			case UnicodeCategory::ClosePunctuation:
+			case UnicodeCategory::InitialPunctuation:
+			case UnicodeCategory::FinalPunctuation:
+			case UnicodeCategory::OtherPunctuation:
+				return CharacterClass::Punctuation;
+			case UnicodeCategory::MathSymbol:
+			case UnicodeCategory::CurrencySymbol:
+			case UnicodeCategory::ModifierSymbol:
+			case UnicodeCategory::OtherSymbol:
+				return CharacterClass::Symbol;
+			case UnicodeCategory::NonspacingMark:
+			case UnicodeCategory::SpacingMark:
+			case UnicodeCategory::EnclosingMark:
+				return CharacterClass::Mark;
+			default:
+				return CharacterClass::Other;
+			}
+		}
+
+		/**
+		 * @brief the lookup tables, built from the ranges at the first use
+		 */
+		struct UnicodeTables
+		{
+			PropertyTable category;
+			PropertyTable script;
+			PropertyTable characterClass;
+
+			UnicodeTables()
+			{
+				const muint32 limit = PropertyTable::limit;
+				std::vector<muint8> categories(limit), scripts(limit), classes(limit);
+				fill(categoryRanges, categories);
+				fill(scriptRanges, scripts);
+				for (muint32 c = 0; c < limit; c++)
+					classes[c] = (muint8)toCharacterClass((UnicodeCategory)categories[c], (UnicodeScript)scripts[c], c);
+
+				category.build(categories.data());
+				script.build(scripts.data());
+				characterClass.build(classes.data());
+			}
+
+			template<size_t N>
+			static void fill(const UnicodeRange (&ranges)[N], std::vector<muint8>& values)
+			{
+				for (size_t i = 0; i < N && ranges[i].start < values.size(); i++)
+				{
+					size_t end = i + 1 < N ? min(ranges[i + 1].start, values.size()) : values.size();
+					memset(values.data() + ranges[i].start, ranges[i].value, end - ranges[i].start);
+				}
+			}
+		};
+
+		inline const UnicodeTables& unicodeTables()
+		{
+			static const UnicodeTables tables;
+			return tables;
+		}
+
+		using TextView_Internal::lowestBit;
+
+		#if defined MOE_SSE2
+		/**
+		 * @brief return the 16-bit lanes where the unsigned value minus low is less than count
+		 */
+		inline __m128i rangeMask16(__m128i v, muint16 low, muint16 count)
+		{
+			const __m128i bias = _mm_set1_epi16((short)0x8000);
+			__m128i shifted = _mm_xor_si128(_mm_sub_epi16(v, _mm_set1_epi16((short)low)), bias);
+			return _mm_cmplt_epi16(shifted, _mm_set1_epi16((short)(count ^ 0x8000)));
+		}
+
+		/**
+		 * @brief return the byte lanes where the unsigned value minus low is less than count
+		 */
+		inline __m128i rangeMask8(__m128i v, muint8 low, muint8 count)
+		{
+			__m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8((char)low));
+			return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8((char)(count - 1))), shifted);
+		}
+
+		inline __m128i equalMask8(__m128i v, char c)
+		{
+			return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+		}
+
+		inline __m128i select8(__m128i mask, CharacterClass value, __m128i current)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, _mm_set1_epi8((char)value)), _mm_andnot_si128(mask, current));
+		}
+
+		/**
+		 * @brief classify sixteen ascii bytes, the result of other bytes is undefined
+		 */
+		inline __m128i classifyAscii(__m128i v)
+		{
+			__m128i symbol = _mm_or_si128(
+				_mm_or_si128(equalMask8(v, '$'), equalMask8(v, '+')),
+				_mm_or_si128(equalMask8(v, '^'), equalMask8(v, '`')));
+			symbol = _mm_or_si128(symbol, _mm_or_si128(
+				_mm_or_si128(equalMask8(v, '|'), equalMask8(v, '~')),
+				rangeMask8(v, '<', 3)));
+			__m128i control = _mm_or_si128(rangeMask8(v, 0x00, 0x20), equalMask8(v, 0x7F));
+			__m128i digit = rangeMask8(v, '0', 10);
+			__m128i letter = rangeMask8(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 26);
+			__m128i space = _mm_or_si128(rangeMask8(v, 0x09, 5), rangeMask8(v, 0x1C, 5));
+
+			__m128i result = _mm_set1_epi8((char)CharacterClass::Punctuation);
+			result = select8(symbol, CharacterClass::Symbol, result);
+			result = select8(control, CharacterClass::Other, result);
+			result = select8(digit, CharacterClass::Digit, result);
+			result = select8(letter, CharacterClass::Letter, result);
+			return select8(space, CharacterClass::Space, result);
+		}
+
+		/**
+		 * @brief return the lanes in CJK Unified Ideographs and Extension A
+		 */
+		inline __m128i hanMask(__m128i v)
+		{
+			return _mm_or_si128(rangeMask16(v, 0x4E00, 0x5200), rangeMask16(v, 0x3400, 0x19C0));
+		}
+		#endif
+	}
+
+	/**
+	 * @brief Unicode character properties
+	 * @detail the properties follow Unicode 14.0, code points below 0x40000 are looked up in
+	 * two-stage tables and the rare code points above it are searched in the ranges.
+	 */
+	class Unicode
+	{
+	public:
+		static UnicodeCategory category(muint32 codePoint)
+		{
+			if (codePoint < Unicode_Internal::PropertyTable::limit)
+				return (UnicodeCategory)Unicode_Internal::unicodeTables().category[codePoint];
+			if (codePoint > 0x10FFFF)
+				return UnicodeCategory::Unassigned;
+			return (UnicodeCategory)Unicode_Internal::findRange(Unicode_Internal::categoryRanges, codePoint);
+		}
+
+		static UnicodeScript script(muint32 codePoint)
+		{
+			if (codePoint < Unicode_Internal::PropertyTable::limit)
+				return (UnicodeScript)Unicode_Internal::unicodeTables().script[codePoint];
+			if (codePoint > 0x10FFFF)
+				return UnicodeScript::Unknown;
+			return (UnicodeScript)Unicode_Internal::findRange(Unicode_Internal::scriptRanges, codePoint);
+		}
+
+		static CharacterClass characterClass(muint32 codePoint)
+		{
+			if (codePoint < Unicode_Internal::PropertyTable::limit)
+				return (CharacterClass)Unicode_Internal::unicodeTables().characterClass[codePoint];
+			return Unicode_Internal::toCharacterClass(category(codePoint), script(codePoint), codePoint);
+		}
+
+		/**
+		 * @brief return true if the code point is a full-width form, e.g. U+3000 and U+FF01 ~ U+FF60
+		 */
+		static bool isFullWidth(muint32 codePoint)
+		{
+			return codePoint == 0x3000 || (codePoint >= 0xFF01 && codePoint <= 0xFF60) || (codePoint >= 0xFFE0 && codePoint <= 0xFFE6);
+		}
+
+		/**
+		 * @brief classify every code unit of an utf-16 buffer
+		 * @param text: the utf-16 code units
+		 * @param length: the number of code units
+		 * @param classes: receives one class per code unit, both units of a surrogate pair
+		 * get the class of the pair
+		 * @detail ascii and the common Han blocks are classified sixteen units at a time,
+		 * other units are looked up in the tables.
+		 */
+		static void classify(const muint16* text, size_t length, CharacterClass* classes)
+		{
+			const Unicode_Internal::UnicodeTables& tables = Unicode_Internal::unicodeTables();
+			size_t i = 0;
+
+			#if defined MOE_SSE2
+			const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+			const __m128i zero = _mm_setzero_si128();
+			for (; i + 16 <= length; i += 16)
+			{
+				__m128i v0 = _mm_loadu_si128((const __m128i*)(text + i));
+				__m128i v1 = _mm_loadu_si128((const __m128i*)(text + i + 8));
+				__m128i ascii = _mm_packs_epi16(
+					_mm_cmpeq_epi16(_mm_and_si128(v0, nonAscii), zero),
+					_mm_cmpeq_epi16(_mm_and_si128(v1, nonAscii), zero));
+				muint32 asciiLanes = (muint32)_mm_movemask_epi8(ascii);
+
+				if (asciiLanes == 0xFFFF)
+				{
+					_mm_storeu_si128((__m128i*)(classes + i), Unicode_Internal::classifyAscii(_mm_packus_epi16(v0, v1)));
+					continue;
+				}
+
+				__m128i han = _mm_packs_epi16(Unicode_Internal::hanMask(v0), Unicode_Internal::hanMask(v1));
+				muint32 hanLanes = (muint32)_mm_movemask_epi8(han);
+				if (hanLanes == 0xFFFF)
+				{
+					_mm_storeu_si128((__m128i*)(classes + i), _mm_set1_epi8((char)CharacterClass::Han));
+					continue;
+				}
+
+				__m128i result = asciiLanes ? Unicode_Internal::classifyAscii(_mm_packus_epi16(v0, v1)) : zero;
+				result = Unicode_Internal::select8(han, CharacterClass::Han, result);
+				_mm_storeu_si128((__m128i*)(classes + i), result);
+
+				muint32 unknown = ~(asciiLanes | hanLanes) & 0xFFFF;
+				while (unknown)
+				{
+					muint32 lane = Unicode_Internal::lowestBit(unknown);
+					unknown &= unknown - 1;
+					classes[i + lane] = classifyAt(tables, text, length, i + lane);
+				}
+			}
+			#endif
+
+			for (; i < length; i++)
+				classes[i] = classifyAt(tables, text, length, i);
+		}
+
+		static void classify(const TextView& text, CharacterClass* classes)
+		{
+			classify(text.data(), text.length(), classes);
+		}
+
+	private:
+		static CharacterClass classifyAt(const Unicode_Internal::UnicodeTables& tables, const muint16* text, size_t length, size_t i)
+		{
+			muint32 c = text[i];
+			if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF)
+				return characterClass(0x10000 + ((c - 0xD800) << 10) + (text[i + 1] - 0xDC00));
+			if (c >= 0xDC00 && c <= 0xDFFF && i > 0 && text[i - 1] >= 0xD800 && text[i - 1] <= 0xDBFF)
+				return characterClass(0x10000 + ((text[i - 1] - 0xD800) << 10) + (c - 0xDC00));
+			return (CharacterClass)tables.characterClass[c];
+		}
+	};
+}
+
+#endif
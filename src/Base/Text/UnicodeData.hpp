@@ -0,0 +1,732 @@
+#ifndef MoeLP_Base_UnicodeData
+#define MoeLP_Base_UnicodeData
+
+#include "../Base.hpp"
+
+namespace MoeLP
+{
+	namespace Unicode_Internal
+	{
+		struct UnicodeRange
+		{
+			muint32	start;
+			muint8	value;
+		};
+
+		/**
+		 * @brief general categories and scripts of Unicode 14.0
+		 * @detail each range starts at start and ends before the start of the next range,
+		 * the values are the indices of UnicodeCategory and UnicodeScript.
+		 */
+		static const UnicodeRange categoryRanges[] =
+		{
+			{ 0x0000, 25 }, { 0x0020, 22 }, { 0x0021, 17 }, { 0x0024, 19 }, { 0x0025, 17 }, { 0x0028, 13 }, { 0x0029, 14 }, { 0x002A, 17 },
+			{ 0x002B, 18 }, { 0x002C, 17 }, { 0x002D, 12 }, { 0x002E, 17 }, { 0x0030, 8 }, { 0x003A, 17 }, { 0x003C, 18 }, { 0x003F, 17 },
+			{ 0x0041, 0 }, { 0x005B, 13 }, { 0x005C, 17 }, { 0x005D, 14 }, { 0x005E, 20 }, { 0x005F, 11 }, { 0x0060, 20 }, { 0x0061, 1 },
+			{ 0x007B, 13 }, { 0x007C, 18 }, { 0x007D, 14 }, { 0x007E, 18 }, { 0x007F, 25 }, { 0x00A0, 22 }, { 0x00A1, 17 }, { 0x00A2, 19 },
+			{ 0x00A6, 21 }, { 0x00A7, 17 }, { 0x00A8, 20 }, { 0x00A9, 21 }, { 0x00AA, 4 }, { 0x00AB, 15 }, { 0x00AC, 18 }, { 0x00AD, 26 },
+			{ 0x00AE, 21 }, { 0x00AF, 20 }, { 0x00B0, 21 }, { 0x00B1, 18 }, { 0x00B2, 10 }, { 0x00B4, 20 }, { 0x00B5, 1 }, { 0x00B6, 17 },
+			{ 0x00B8, 20 }, { 0x00B9, 10 }, { 0x00BA, 4 }, { 0x00BB, 16 }, { 0x00BC, 10 }, { 0x00BF, 17 }, { 0x00C0, 0 }, { 0x00D7, 18 },
+			{ 0x00D8, 0 }, { 0x00DF, 1 }, { 0x00F7, 18 }, { 0x00F8, 1 }, { 0x0100, 0 }, { 0x0101, 1 }, { 0x0102, 0 }, { 0x0103, 1 },
+			{ 0x0104, 0 }, { 0x0105, 1 }, { 0x0106, 0 }, { 0x0107, 1 }, { 0x0108, 0 }, { 0x0109, 1 }, { 0x010A, 0 }, { 0x010B, 1 },
+			{ 0x010C, 0 }, { 0x010D, 1 }, { 0x010E, 0 }, { 0x010F, 1 }, { 0x0110, 0 }, { 0x0111, 1 }, { 0x0112, 0 }, { 0x0113, 1 },
+			{ 0x0114, 0 }, { 0x0115, 1 }, { 0x0116, 0 }, { 0x0117, 1 }, { 0x0118, 0 }, { 0x0119, 1 }, { 0x011A, 0 }, { 0x011B, 1 },
+			{ 0x011C, 0 }, { 0x011D, 1 }, { 0x011E, 0 }, { 0x011F, 1 }, { 0x0120, 0 }, { 0x0121, 1 }, { 0x0122, 0 }, { 0x0123, 1 },
+			{ 0x0124, 0 }, { 0x0125, 1 }, { 0x0126, 0 }, { 0x0127, 1 }, { 0x0128, 0 }, { 0x0129, 1 }, { 0x012A, 0 }, { 0x012B, 1 },
+			{ 0x012C, 0 }, { 0x012D, 1 }, { 0x012E, 0 }, { 0x012F, 1 }, { 0x0130, 0 }, { 0x0131, 1 }, { 0x0132, 0 }, { 0x0133, 1 },
+			{ 0x0134, 0 }, { 0x0135, 1 }, { 0x0136, 0 }, { 0x0137, 1 }, { 0x0139, 0 }, { 0x013A, 1 }, { 0x013B, 0 }, { 0x013C, 1 },
+			{ 0x013D, 0 }, { 0x013E, 1 }, { 0x013F, 0 }, { 0x0140, 1 }, { 0x0141, 0 }, { 0x0142, 1 }, { 0x0143, 0 }, { 0x0144, 1 },
+			{ 0x0145, 0 }, { 0x0146, 1 }, { 0x0147, 0 }, { 0x0148, 1 }, { 0x014A, 0 }, { 0x014B, 1 }, { 0x014C, 0 }, { 0x014D, 1 },
+			{ 0x014E, 0 }, { 0x014F, 1 }, { 0x0150, 0 }, { 0x0151, 1 }, { 0x0152, 0 }, { 0x0153, 1 }, { 0x0154, 0 }, { 0x0155, 1 },
+			{ 0x0156, 0 }, { 0x0157, 1 }, { 0x0158, 0 }, { 0x0159, 1 }, { 0x015A, 0 }, { 0x015B, 1 }, { 0x015C, 0 }, { 0x015D, 1 },
+			{ 0x015E, 0 }, { 0x015F, 1 }, { 0x0160, 0 }, { 0x0161, 1 }, { 0x0162, 0 }, { 0x0163, 1 }, { 0x0164, 0 }, { 0x0165, 1 },
+			{ 0x0166, 0 }, { 0x0167, 1 }, { 0x0168, 0 }, { 0x0169, 1 }, { 0x016A, 0 }, { 0x016B, 1 }, { 0x016C, 0 }, { 0x016D, 1 },
+			{ 0x016E, 0 }, { 0x016F, 1 }, { 0x0170, 0 }, { 0x0171, 1 }, { 0x0172, 0 }, { 0x0173, 1 }, { 0x0174, 0 }, { 0x0175, 1 },
+			{ 0x0176, 0 }, { 0x0177, 1 }, { 0x0178, 0 }, { 0x017A, 1 }, { 0x017B, 0 }, { 0x017C, 1 }, { 0x017D, 0 }, { 0x017E, 1 },
+			{ 0x0181, 0 }, { 0x0183, 1 }, { 0x0184, 0 }, { 0x0185, 1 }, { 0x0186, 0 }, { 0x0188, 1 }, { 0x0189, 0 }, { 0x018C, 1 },
+			{ 0x018E, 0 }, { 0x0192, 1 }, { 0x0193, 0 }, { 0x0195, 1 }, { 0x0196, 0 }, { 0x0199, 1 }, { 0x019C, 0 }, { 0x019E, 1 },
+			{ 0x019F, 0 }, { 0x01A1, 1 }, { 0x01A2, 0 }, { 0x01A3, 1 }, { 0x01A4, 0 }, { 0x01A5, 1 }, { 0x01A6, 0 }, { 0x01A8, 1 },
+			{ 0x01A9, 0 }, { 0x01AA, 1 }, { 0x01AC, 0 }, { 0x01AD, 1 }, { 0x01AE, 0 }, { 0x01B0, 1 }, { 0x01B1, 0 }, { 0x01B4, 1 },
+			{ 0x01B5, 0 }, { 0x01B6, 1 }, { 0x01B7, 0 }, { 0x01B9, 1 }, { 0x01BB, 4 }, { 0x01BC, 0 }, { 0x01BD, 1 }, { 0x01C0, 4 },
+			{ 0x01C4, 0 }, { 0x01C5, 2 }, { 0x01C6, 1 }, { 0x01C7, 0 }, { 0x01C8, 2 }, { 0x01C9, 1 }, { 0x01CA, 0 }, { 0x01CB, 2 },
+			{ 0x01CC, 1 }, { 0x01CD, 0 }, { 0x01CE, 1 }, { 0x01CF, 0 }, { 0x01D0, 1 }, { 0x01D1, 0 }, { 0x01D2, 1 }, { 0x01D3, 0 },
+			{ 0x01D4, 1 }, { 0x01D5, 0 }, { 0x01D6, 1 }, { 0x01D7, 0 }, { 0x01D8, 1 }, { 0x01D9, 0 }, { 0x01DA, 1 }, { 0x01DB, 0 },
+			{ 0x01DC, 1 }, { 0x01DE, 0 }, { 0x01DF, 1 }, { 0x01E0, 0 }, { 0x01E1, 1 }, { 0x01E2, 0 }, { 0x01E3, 1 }, { 0x01E4, 0 },
+			{ 0x01E5, 1 }, { 0x01E6, 0 }, { 0x01E7, 1 }, { 0x01E8, 0 }, { 0x01E9, 1 }, { 0x01EA, 0 }, { 0x01EB, 1 }, { 0x01EC, 0 },
+			{ 0x01ED, 1 }, { 0x01EE, 0 }, { 0x01EF, 1 }, { 0x01F1, 0 }, { 0x01F2, 2 }, { 0x01F3, 1 }, { 0x01F4, 0 }, { 0x01F5, 1 },
+			{ 0x01F6, 0 }, { 0x01F9, 1 }, { 0x01FA, 0 }, { 0x01FB, 1 }, { 0x01FC, 0 }, { 0x01FD, 1 }, { 0x01FE, 0 }, { 0x01FF, 1 },
+			{ 0x0200, 0 }, { 0x0201, 1 }, { 0x0202, 0 }, { 0x0203, 1 }, { 0x0204, 0 }, { 0x0205, 1 }, { 0x0206, 0 }, { 0x0207, 1 },
+			{ 0x0208, 0 }, { 0x0209, 1 }, { 0x020A, 0 }, { 0x020B, 1 }, { 0x020C, 0 }, { 0x020D, 1 }, { 0x020E, 0 }, { 0x020F, 1 },
+			{ 0x0210, 0 }, { 0x0211, 1 }, { 0x0212, 0 }, { 0x0213, 1 }, { 0x0214, 0 }, { 0x0215, 1 }, { 0x0216, 0 }, { 0x0217, 1 },
+			{ 0x0218, 0 }, { 0x0219, 1 }, { 0x021A, 0 }, { 0x021B, 1 }, { 0x021C, 0 }, { 0x021D, 1 }, { 0x021E, 0 }, { 0x021F, 1 },
+			{ 0x0220, 0 }, { 0x0221, 1 }, { 0x0222, 0 }, { 0x0223, 1 }, { 0x0224, 0 }, { 0x0225, 1 }, { 0x0226, 0 }, { 0x0227, 1 },
+			{ 0x0228, 0 }, { 0x0229, 1 }, { 0x022A, 0 }, { 0x022B, 1 }, { 0x022C, 0 }, { 0x022D, 1 }, { 0x022E, 0 }, { 0x022F, 1 },
+			{ 0x0230, 0 }, { 0x0231, 1 }, { 0x0232, 0 }, { 0x0233, 1 }, { 0x023A, 0 }, { 0x023C, 1 }, { 0x023D, 0 }, { 0x023F, 1 },
+			{ 0x0241, 0 }, { 0x0242, 1 }, { 0x0243, 0 }, { 0x0247, 1 }, { 0x0248, 0 }, { 0x0249, 1 }, { 0x024A, 0 }, { 0x024B, 1 },
+			{ 0x024C, 0 }, { 0x024D, 1 }, { 0x024E, 0 }, { 0x024F, 1 }, { 0x0294, 4 }, { 0x0295, 1 }, { 0x02B0, 3 }, { 0x02C2, 20 },
+			{ 0x02C6, 3 }, { 0x02D2, 20 }, { 0x02E0, 3 }, { 0x02E5, 20 }, { 0x02EC, 3 }, { 0x02ED, 20 }, { 0x02EE, 3 }, { 0x02EF, 20 },
+			{ 0x0300, 5 }, { 0x0370, 0 }, { 0x0371, 1 }, { 0x0372, 0 }, { 0x0373, 1 }, { 0x0374, 3 }, { 0x0375, 20 }, { 0x0376, 0 },
+			{ 0x0377, 1 }, { 0x0378, 29 }, { 0x037A, 3 }, { 0x037B, 1 }, { 0x037E, 17 }, { 0x037F, 0 }, { 0x0380, 29 }, { 0x0384, 20 },
+			{ 0x0386, 0 }, { 0x0387, 17 }, { 0x0388, 0 }, { 0x038B, 29 }, { 0x038C, 0 }, { 0x038D, 29 }, { 0x038E, 0 }, { 0x0390, 1 },
+			{ 0x0391, 0 }, { 0x03A2, 29 }, { 0x03A3, 0 }, { 0x03AC, 1 }, { 0x03CF, 0 }, { 0x03D0, 1 }, { 0x03D2, 0 }, { 0x03D5, 1 },
+			{ 0x03D8, 0 }, { 0x03D9, 1 }, { 0x03DA, 0 }, { 0x03DB, 1 }, { 0x03DC, 0 }, { 0x03DD, 1 }, { 0x03DE, 0 }, { 0x03DF, 1 },
+			{ 0x03E0, 0 }, { 0x03E1, 1 }, { 0x03E2, 0 }, { 0x03E3, 1 }, { 0x03E4, 0 }, { 0x03E5, 1 }, { 0x03E6, 0 }, { 0x03E7, 1 },
+			{ 0x03E8, 0 }, { 0x03E9, 1 }, { 0x03EA, 0 }, { 0x03EB, 1 }, { 0x03EC, 0 }, { 0x03ED, 1 }, { 0x03EE, 0 }, { 0x03EF, 1 },
+			{ 0x03F4, 0 }, { 0x03F5, 1 }, { 0x03F6, 18 }, { 0x03F7, 0 }, { 0x03F8, 1 }, { 0x03F9, 0 }, { 0x03FB, 1 }, { 0x03FD, 0 },
+			{ 0x0430, 1 }, { 0x0460, 0 }, { 0x0461, 1 }, { 0x0462, 0 }, { 0x0463, 1 }, { 0x0464, 0 }, { 0x0465, 1 }, { 0x0466, 0 },
+			{ 0x0467, 1 }, { 0x0468, 0 }, { 0x0469, 1 }, { 0x046A, 0 }, { 0x046B, 1 }, { 0x046C, 0 }, { 0x046D, 1 }, { 0x046E, 0 },
+			{ 0x046F, 1 }, { 0x0470, 0 }, { 0x0471, 1 }, { 0x0472, 0 }, { 0x0473, 1 }, { 0x0474, 0 }, { 0x0475, 1 }, { 0x0476, 0 },
+			{ 0x0477, 1 }, { 0x0478, 0 }, { 0x0479, 1 }, { 0x047A, 0 }, { 0x047B, 1 }, { 0x047C, 0 }, { 0x047D, 1 }, { 0x047E, 0 },
+			{ 0x047F, 1 }, { 0x0480, 0 }, { 0x0481, 1 }, { 0x0482, 21 }, { 0x0483, 5 }, { 0x0488, 7 }, { 0x048A, 0 }, { 0x048B, 1 },
+			{ 0x048C, 0 }, { 0x048D, 1 }, { 0x048E, 0 }, { 0x048F, 1 }, { 0x0490, 0 }, { 0x0491, 1 }, { 0x0492, 0 }, { 0x0493, 1 },
+			{ 0x0494, 0 }, { 0x0495, 1 }, { 0x0496, 0 }, { 0x0497, 1 }, { 0x0498, 0 }, { 0x0499, 1 }, { 0x049A, 0 }, { 0x049B, 1 },
+			{ 0x049C, 0 }, { 0x049D, 1 }, { 0x049E, 0 }, { 0x049F, 1 }, { 0x04A0, 0 }, { 0x04A1, 1 }, { 0x04A2, 0 }, { 0x04A3, 1 },
+			{ 0x04A4, 0 }, { 0x04A5, 1 }, { 0x04A6, 0 }, { 0x04A7, 1 }, { 0x04A8, 0 }, { 0x04A9, 1 }, { 0x04AA, 0 }, { 0x04AB, 1 },
+			{ 0x04AC, 0 }, { 0x04AD, 1 }, { 0x04AE, 0 }, { 0x04AF, 1 }, { 0x04B0, 0 }, { 0x04B1, 1 }, { 0x04B2, 0 }, { 0x04B3, 1 },
+			{ 0x04B4, 0 }, { 0x04B5, 1 }, { 0x04B6, 0 }, { 0x04B7, 1 }, { 0x04B8, 0 }, { 0x04B9, 1 }, { 0x04BA, 0 }, { 0x04BB, 1 },
+			{ 0x04BC, 0 }, { 0x04BD, 1 }, { 0x04BE, 0 }, { 0x04BF, 1 }, { 0x04C0, 0 }, { 0x04C2, 1 }, { 0x04C3, 0 }, { 0x04C4, 1 },
+			{ 0x04C5, 0 }, { 0x04C6, 1 }, { 0x04C7, 0 }, { 0x04C8, 1 }, { 0x04C9, 0 }, { 0x04CA, 1 }, { 0x04CB, 0 }, { 0x04CC, 1 },
+			{ 0x04CD, 0 }, { 0x04CE, 1 }, { 0x04D0, 0 }, { 0x04D1, 1 }, { 0x04D2, 0 }, { 0x04D3, 1 }, { 0x04D4, 0 }, { 0x04D5, 1 },
+			{ 0x04D6, 0 }, { 0x04D7, 1 }, { 0x04D8, 0 }, { 0x04D9, 1 }, { 0x04DA, 0 }, { 0x04DB, 1 }, { 0x04DC, 0 }, { 0x04DD, 1 },
+			{ 0x04DE, 0 }, { 0x04DF, 1 }, { 0x04E0, 0 }, { 0x04E1, 1 }, { 0x04E2, 0 }, { 0x04E3, 1 }, { 0x04E4, 0 }, { 0x04E5, 1 },
+			{ 0x04E6, 0 }, { 0x04E7, 1 }, { 0x04E8, 0 }, { 0x04E9, 1 }, { 0x04EA, 0 }, { 0x04EB, 1 }, { 0x04EC, 0 }, { 0x04ED, 1 },
+			{ 0x04EE, 0 }, { 0x04EF, 1 }, { 0x04F0, 0 }, { 0x04F1, 1 }, { 0x04F2, 0 }, { 0x04F3, 1 }, { 0x04F4, 0 }, { 0x04F5, 1 },
+			{ 0x04F6, 0 }, { 0x04F7, 1 }, { 0x04F8, 0 }, { 0x04F9, 1 }, { 0x04FA, 0 }, { 0x04FB, 1 }, { 0x04FC, 0 }, { 0x04FD, 1 },
+			{ 0x04FE, 0 }, { 0x04FF, 1 }, { 0x0500, 0 }, { 0x0501, 1 }, { 0x0502, 0 }, { 0x0503, 1 }, { 0x0504, 0 }, { 0x0505, 1 },
+			{ 0x0506, 0 }, { 0x0507, 1 }, { 0x0508, 0 }, { 0x0509, 1 }, { 0x050A, 0 }, { 0x050B, 1 }, { 0x050C, 0 }, { 0x050D, 1 },
+			{ 0x050E, 0 }, { 0x050F, 1 }, { 0x0510, 0 }, { 0x0511, 1 }, { 0x0512, 0 }, { 0x0513, 1 }, { 0x0514, 0 }, { 0x0515, 1 },
+			{ 0x0516, 0 }, { 0x0517, 1 }, { 0x0518, 0 }, { 0x0519, 1 }, { 0x051A, 0 }, { 0x051B, 1 }, { 0x051C, 0 }, { 0x051D, 1 },
+			{ 0x051E, 0 }, { 0x051F, 1 }, { 0x0520, 0 }, { 0x0521, 1 }, { 0x0522, 0 }, { 0x0523, 1 }, { 0x0524, 0 }, { 0x0525, 1 },
+			{ 0x0526, 0 }, { 0x0527, 1 }, { 0x0528, 0 }, { 0x0529, 1 }, { 0x052A, 0 }, { 0x052B, 1 }, { 0x052C, 0 }, { 0x052D, 1 },
+			{ 0x052E, 0 }, { 0x052F, 1 }, { 0x0530, 29 }, { 0x0531, 0 }, { 0x0557, 29 }, { 0x0559, 3 }, { 0x055A, 17 }, { 0x0560, 1 },
+			{ 0x0589, 17 }, { 0x058A, 12 }, { 0x058B, 29 }, { 0x058D, 21 }, { 0x058F, 19 }, { 0x0590, 29 }, { 0x0591, 5 }, { 0x05BE, 12 },
+			{ 0x05BF, 5 }, { 0x05C0, 17 }, { 0x05C1, 5 }, { 0x05C3, 17 }, { 0x05C4, 5 }, { 0x05C6, 17 }, { 0x05C7, 5 }, { 0x05C8, 29 },
+			{ 0x05D0, 4 }, { 0x05EB, 29 }, { 0x05EF, 4 }, { 0x05F3, 17 }, { 0x05F5, 29 }, { 0x0600, 26 }, { 0x0606, 18 }, { 0x0609, 17 },
+			{ 0x060B, 19 }, { 0x060C, 17 }, { 0x060E, 21 }, { 0x0610, 5 }, { 0x061B, 17 }, { 0x061C, 26 }, { 0x061D, 17 }, { 0x0620, 4 },
+			{ 0x0640, 3 }, { 0x0641, 4 }, { 0x064B, 5 }, { 0x0660, 8 }, { 0x066A, 17 }, { 0x066E, 4 }, { 0x0670, 5 }, { 0x0671, 4 },
+			{ 0x06D4, 17 }, { 0x06D5, 4 }, { 0x06D6, 5 }, { 0x06DD, 26 }, { 0x06DE, 21 }, { 0x06DF, 5 }, { 0x06E5, 3 }, { 0x06E7, 5 },
+			{ 0x06E9, 21 }, { 0x06EA, 5 }, { 0x06EE, 4 }, { 0x06F0, 8 }, { 0x06FA, 4 }, { 0x06FD, 21 }, { 0x06FF, 4 }, { 0x0700, 17 },
+			{ 0x070E, 29 }, { 0x070F, 26 }, { 0x0710, 4 }, { 0x0711, 5 }, { 0x0712, 4 }, { 0x0730, 5 }, { 0x074B, 29 }, { 0x074D, 4 },
+			{ 0x07A6, 5 }, { 0x07B1, 4 }, { 0x07B2, 29 }, { 0x07C0, 8 }, { 0x07CA, 4 }, { 0x07EB, 5 }, { 0x07F4, 3 }, { 0x07F6, 21 },
+			{ 0x07F7, 17 }, { 0x07FA, 3 }, { 0x07FB, 29 }, { 0x07FD, 5 }, { 0x07FE, 19 }, { 0x0800, 4 }, { 0x0816, 5 }, { 0x081A, 3 },
+			{ 0x081B, 5 }, { 0x0824, 3 }, { 0x0825, 5 }, { 0x0828, 3 }, { 0x0829, 5 }, { 0x082E, 29 }, { 0x0830, 17 }, { 0x083F, 29 },
+			{ 0x0840, 4 }, { 0x0859, 5 }, { 0x085C, 29 }, { 0x085E, 17 }, { 0x085F, 29 }, { 0x0860, 4 }, { 0x086B, 29 }, { 0x0870, 4 },
+			{ 0x0888, 20 }, { 0x0889, 4 }, { 0x088F, 29 }, { 0x0890, 26 }, { 0x0892, 29 }, { 0x0898, 5 }, { 0x08A0, 4 }, { 0x08C9, 3 },
+			{ 0x08CA, 5 }, { 0x08E2, 26 }, { 0x08E3, 5 }, { 0x0903, 6 }, { 0x0904, 4 }, { 0x093A, 5 }, { 0x093B, 6 }, { 0x093C, 5 },
+			{ 0x093D, 4 }, { 0x093E, 6 }, { 0x0941, 5 }, { 0x0949, 6 }, { 0x094D, 5 }, { 0x094E, 6 }, { 0x0950, 4 }, { 0x0951, 5 },
+			{ 0x0958, 4 }, { 0x0962, 5 }, { 0x0964, 17 }, { 0x0966, 8 }, { 0x0970, 17 }, { 0x0971, 3 }, { 0x0972, 4 }, { 0x0981, 5 },
+			{ 0x0982, 6 }, { 0x0984, 29 }, { 0x0985, 4 }, { 0x098D, 29 }, { 0x098F, 4 }, { 0x0991, 29 }, { 0x0993, 4 }, { 0x09A9, 29 },
+			{ 0x09AA, 4 }, { 0x09B1, 29 }, { 0x09B2, 4 }, { 0x09B3, 29 }, { 0x09B6, 4 }, { 0x09BA, 29 }, { 0x09BC, 5 }, { 0x09BD, 4 },
+			{ 0x09BE, 6 }, { 0x09C1, 5 }, { 0x09C5, 29 }, { 0x09C7, 6 }, { 0x09C9, 29 }, { 0x09CB, 6 }, { 0x09CD, 5 }, { 0x09CE, 4 },
+			{ 0x09CF, 29 }, { 0x09D7, 6 }, { 0x09D8, 29 }, { 0x09DC, 4 }, { 0x09DE, 29 }, { 0x09DF, 4 }, { 0x09E2, 5 }, { 0x09E4, 29 },
+			{ 0x09E6, 8 }, { 0x09F0, 4 }, { 0x09F2, 19 }, { 0x09F4, 10 }, { 0x09FA, 21 }, { 0x09FB, 19 }, { 0x09FC, 4 }, { 0x09FD, 17 },
+			{ 0x09FE, 5 }, { 0x09FF, 29 }, { 0x0A01, 5 }, { 0x0A03, 6 }, { 0x0A04, 29 }, { 0x0A05, 4 }, { 0x0A0B, 29 }, { 0x0A0F, 4 },
+			{ 0x0A11, 29 }, { 0x0A13, 4 }, { 0x0A29, 29 }, { 0x0A2A, 4 }, { 0x0A31, 29 }, { 0x0A32, 4 }, { 0x0A34, 29 }, { 0x0A35, 4 },
+			{ 0x0A37, 29 }, { 0x0A38, 4 }, { 0x0A3A, 29 }, { 0x0A3C, 5 }, { 0x0A3D, 29 }, { 0x0A3E, 6 }, { 0x0A41, 5 }, { 0x0A43, 29 },
+			{ 0x0A47, 5 }, { 0x0A49, 29 }, { 0x0A4B, 5 }, { 0x0A4E, 29 }, { 0x0A51, 5 }, { 0x0A52, 29 }, { 0x0A59, 4 }, { 0x0A5D, 29 },
+			{ 0x0A5E, 4 }, { 0x0A5F, 29 }, { 0x0A66, 8 }, { 0x0A70, 5 }, { 0x0A72, 4 }, { 0x0A75, 5 }, { 0x0A76, 17 }, { 0x0A77, 29 },
+			{ 0x0A81, 5 }, { 0x0A83, 6 }, { 0x0A84, 29 }, { 0x0A85, 4 }, { 0x0A8E, 29 }, { 0x0A8F, 4 }, { 0x0A92, 29 }, { 0x0A93, 4 },
+			{ 0x0AA9, 29 }, { 0x0AAA, 4 }, { 0x0AB1, 29 }, { 0x0AB2, 4 }, { 0x0AB4, 29 }, { 0x0AB5, 4 }, { 0x0ABA, 29 }, { 0x0ABC, 5 },
+			{ 0x0ABD, 4 }, { 0x0ABE, 6 }, { 0x0AC1, 5 }, { 0x0AC6, 29 }, { 0x0AC7, 5 }, { 0x0AC9, 6 }, { 0x0ACA, 29 }, { 0x0ACB, 6 },
+			{ 0x0ACD, 5 }, { 0x0ACE, 29 }, { 0x0AD0, 4 }, { 0x0AD1, 29 }, { 0x0AE0, 4 }, { 0x0AE2, 5 }, { 0x0AE4, 29 }, { 0x0AE6, 8 },
+			{ 0x0AF0, 17 }, { 0x0AF1, 19 }, { 0x0AF2, 29 }, { 0x0AF9, 4 }, { 0x0AFA, 5 }, { 0x0B00, 29 }, { 0x0B01, 5 }, { 0x0B02, 6 },
+			{ 0x0B04, 29 }, { 0x0B05, 4 }, { 0x0B0D, 29 }, { 0x0B0F, 4 }, { 0x0B11, 29 }, { 0x0B13, 4 }, { 0x0B29, 29 }, { 0x0B2A, 4 },
+			{ 0x0B31, 29 }, { 0x0B32, 4 }, { 0x0B34, 29 }, { 0x0B35, 4 }, { 0x0B3A, 29 }, { 0x0B3C, 5 }, { 0x0B3D, 4 }, { 0x0B3E, 6 },
+			{ 0x0B3F, 5 }, { 0x0B40, 6 }, { 0x0B41, 5 }, { 0x0B45, 29 }, { 0x0B47, 6 }, { 0x0B49, 29 }, { 0x0B4B, 6 }, { 0x0B4D, 5 },
+			{ 0x0B4E, 29 }, { 0x0B55, 5 }, { 0x0B57, 6 }, { 0x0B58, 29 }, { 0x0B5C, 4 }, { 0x0B5E, 29 }, { 0x0B5F, 4 }, { 0x0B62, 5 },
+			{ 0x0B64, 29 }, { 0x0B66, 8 }, { 0x0B70, 21 }, { 0x0B71, 4 }, { 0x0B72, 10 }, { 0x0B78, 29 }, { 0x0B82, 5 }, { 0x0B83, 4 },
+			{ 0x0B84, 29 }, { 0x0B85, 4 }, { 0x0B8B, 29 }, { 0x0B8E, 4 }, { 0x0B91, 29 }, { 0x0B92, 4 }, { 0x0B96, 29 }, { 0x0B99, 4 },
+			{ 0x0B9B, 29 }, { 0x0B9C, 4 }, { 0x0B9D, 29 }, { 0x0B9E, 4 }, { 0x0BA0, 29 }, { 0x0BA3, 4 }, { 0x0BA5, 29 }, { 0x0BA8, 4 },
+			{ 0x0BAB, 29 }, { 0x0BAE, 4 }, { 0x0BBA, 29 }, { 0x0BBE, 6 }, { 0x0BC0, 5 }, { 0x0BC1, 6 }, { 0x0BC3, 29 }, { 0x0BC6, 6 },
+			{ 0x0BC9, 29 }, { 0x0BCA, 6 }, { 0x0BCD, 5 }, { 0x0BCE, 29 }, { 0x0BD0, 4 }, { 0x0BD1, 29 }, { 0x0BD7, 6 }, { 0x0BD8, 29 },
+			{ 0x0BE6, 8 }, { 0x0BF0, 10 }, { 0x0BF3, 21 }, { 0x0BF9, 19 }, { 0x0BFA, 21 }, { 0x0BFB, 29 }, { 0x0C00, 5 }, { 0x0C01, 6 },
+			{ 0x0C04, 5 }, { 0x0C05, 4 }, { 0x0C0D, 29 }, { 0x0C0E, 4 }, { 0x0C11, 29 }, { 0x0C12, 4 }, { 0x0C29, 29 }, { 0x0C2A, 4 },
+			{ 0x0C3A, 29 }, { 0x0C3C, 5 }, { 0x0C3D, 4 }, { 0x0C3E, 5 }, { 0x0C41, 6 }, { 0x0C45, 29 }, { 0x0C46, 5 }, { 0x0C49, 29 },
+			{ 0x0C4A, 5 }, { 0x0C4E, 29 }, { 0x0C55, 5 }, { 0x0C57, 29 }, { 0x0C58, 4 }, { 0x0C5B, 29 }, { 0x0C5D, 4 }, { 0x0C5E, 29 },
+			{ 0x0C60, 4 }, { 0x0C62, 5 }, { 0x0C64, 29 }, { 0x0C66, 8 }, { 0x0C70, 29 }, { 0x0C77, 17 }, { 0x0C78, 10 }, { 0x0C7F, 21 },
+			{ 0x0C80, 4 }, { 0x0C81, 5 }, { 0x0C82, 6 }, { 0x0C84, 17 }, { 0x0C85, 4 }, { 0x0C8D, 29 }, { 0x0C8E, 4 }, { 0x0C91, 29 },
+			{ 0x0C92, 4 }, { 0x0CA9, 29 }, { 0x0CAA, 4 }, { 0x0CB4, 29 }, { 0x0CB5, 4 }, { 0x0CBA, 29 }, { 0x0CBC, 5 }, { 0x0CBD, 4 },
+			{ 0x0CBE, 6 }, { 0x0CBF, 5 }, { 0x0CC0, 6 }, { 0x0CC5, 29 }, { 0x0CC6, 5 }, { 0x0CC7, 6 }, { 0x0CC9, 29 }, { 0x0CCA, 6 },
+			{ 0x0CCC, 5 }, { 0x0CCE, 29 }, { 0x0CD5, 6 }, { 0x0CD7, 29 }, { 0x0CDD, 4 }, { 0x0CDF, 29 }, { 0x0CE0, 4 }, { 0x0CE2, 5 },
+			{ 0x0CE4, 29 }, { 0x0CE6, 8 }, { 0x0CF0, 29 }, { 0x0CF1, 4 }, { 0x0CF3, 29 }, { 0x0D00, 5 }, { 0x0D02, 6 }, { 0x0D04, 4 },
+			{ 0x0D0D, 29 }, { 0x0D0E, 4 }, { 0x0D11, 29 }, { 0x0D12, 4 }, { 0x0D3B, 5 }, { 0x0D3D, 4 }, { 0x0D3E, 6 }, { 0x0D41, 5 },
+			{ 0x0D45, 29 }, { 0x0D46, 6 }, { 0x0D49, 29 }, { 0x0D4A, 6 }, { 0x0D4D, 5 }, { 0x0D4E, 4 }, { 0x0D4F, 21 }, { 0x0D50, 29 },
+			{ 0x0D54, 4 }, { 0x0D57, 6 }, { 0x0D58, 10 }, { 0x0D5F, 4 }, { 0x0D62, 5 }, { 0x0D64, 29 }, { 0x0D66, 8 }, { 0x0D70, 10 },
+			{ 0x0D79, 21 }, { 0x0D7A, 4 }, { 0x0D80, 29 }, { 0x0D81, 5 }, { 0x0D82, 6 }, { 0x0D84, 29 }, { 0x0D85, 4 }, { 0x0D97, 29 },
+			{ 0x0D9A, 4 }, { 0x0DB2, 29 }, { 0x0DB3, 4 }, { 0x0DBC, 29 }, { 0x0DBD, 4 }, { 0x0DBE, 29 }, { 0x0DC0, 4 }, { 0x0DC7, 29 },
+			{ 0x0DCA, 5 }, { 0x0DCB, 29 }, { 0x0DCF, 6 }, { 0x0DD2, 5 }, { 0x0DD5, 29 }, { 0x0DD6, 5 }, { 0x0DD7, 29 }, { 0x0DD8, 6 },
+			{ 0x0DE0, 29 }, { 0x0DE6, 8 }, { 0x0DF0, 29 }, { 0x0DF2, 6 }, { 0x0DF4, 17 }, { 0x0DF5, 29 }, { 0x0E01, 4 }, { 0x0E31, 5 },
+			{ 0x0E32, 4 }, { 0x0E34, 5 }, { 0x0E3B, 29 }, { 0x0E3F, 19 }, { 0x0E40, 4 }, { 0x0E46, 3 }, { 0x0E47, 5 }, { 0x0E4F, 17 },
+			{ 0x0E50, 8 }, { 0x0E5A, 17 }, { 0x0E5C, 29 }, { 0x0E81, 4 }, { 0x0E83, 29 }, { 0x0E84, 4 }, { 0x0E85, 29 }, { 0x0E86, 4 },
+			{ 0x0E8B, 29 }, { 0x0E8C, 4 }, { 0x0EA4, 29 }, { 0x0EA5, 4 }, { 0x0EA6, 29 }, { 0x0EA7, 4 }, { 0x0EB1, 5 }, { 0x0EB2, 4 },
+			{ 0x0EB4, 5 }, { 0x0EBD, 4 }, { 0x0EBE, 29 }, { 0x0EC0, 4 }, { 0x0EC5, 29 }, { 0x0EC6, 3 }, { 0x0EC7, 29 }, { 0x0EC8, 5 },
+			{ 0x0ECE, 29 }, { 0x0ED0, 8 }, { 0x0EDA, 29 }, { 0x0EDC, 4 }, { 0x0EE0, 29 }, { 0x0F00, 4 }, { 0x0F01, 21 }, { 0x0F04, 17 },
+			{ 0x0F13, 21 }, { 0x0F14, 17 }, { 0x0F15, 21 }, { 0x0F18, 5 }, { 0x0F1A, 21 }, { 0x0F20, 8 }, { 0x0F2A, 10 }, { 0x0F34, 21 },
+			{ 0x0F35, 5 }, { 0x0F36, 21 }, { 0x0F37, 5 }, { 0x0F38, 21 }, { 0x0F39, 5 }, { 0x0F3A, 13 }, { 0x0F3B, 14 }, { 0x0F3C, 13 },
+			{ 0x0F3D, 14 }, { 0x0F3E, 6 }, { 0x0F40, 4 }, { 0x0F48, 29 }, { 0x0F49, 4 }, { 0x0F6D, 29 }, { 0x0F71, 5 }, { 0x0F7F, 6 },
+			{ 0x0F80, 5 }, { 0x0F85, 17 }, { 0x0F86, 5 }, { 0x0F88, 4 }, { 0x0F8D, 5 }, { 0x0F98, 29 }, { 0x0F99, 5 }, { 0x0FBD, 29 },
+			{ 0x0FBE, 21 }, { 0x0FC6, 5 }, { 0x0FC7, 21 }, { 0x0FCD, 29 }, { 0x0FCE, 21 }, { 0x0FD0, 17 }, { 0x0FD5, 21 }, { 0x0FD9, 17 },
+			{ 0x0FDB, 29 }, { 0x1000, 4 }, { 0x102B, 6 }, { 0x102D, 5 }, { 0x1031, 6 }, { 0x1032, 5 }, { 0x1038, 6 }, { 0x1039, 5 },
+			{ 0x103B, 6 }, { 0x103D, 5 }, { 0x103F, 4 }, { 0x1040, 8 }, { 0x104A, 17 }, { 0x1050, 4 }, { 0x1056, 6 }, { 0x1058, 5 },
+			{ 0x105A, 4 }, { 0x105E, 5 }, { 0x1061, 4 }, { 0x1062, 6 }, { 0x1065, 4 }, { 0x1067, 6 }, { 0x106E, 4 }, { 0x1071, 5 },
+			{ 0x1075, 4 }, { 0x1082, 5 }, { 0x1083, 6 }, { 0x1085, 5 }, { 0x1087, 6 }, { 0x108D, 5 }, { 0x108E, 4 }, { 0x108F, 6 },
+			{ 0x1090, 8 }, { 0x109A, 6 }, { 0x109D, 5 }, { 0x109E, 21 }, { 0x10A0, 0 }, { 0x10C6, 29 }, { 0x10C7, 0 }, { 0x10C8, 29 },
+			{ 0x10CD, 0 }, { 0x10CE, 29 }, { 0x10D0, 1 }, { 0x10FB, 17 }, { 0x10FC, 3 }, { 0x10FD, 1 }, { 0x1100, 4 }, { 0x1249, 29 },
+			{ 0x124A, 4 }, { 0x124E, 29 }, { 0x1250, 4 }, { 0x1257, 29 }, { 0x1258, 4 }, { 0x1259, 29 }, { 0x125A, 4 }, { 0x125E, 29 },
+			{ 0x1260, 4 }, { 0x1289, 29 }, { 0x128A, 4 }, { 0x128E, 29 }, { 0x1290, 4 }, { 0x12B1, 29 }, { 0x12B2, 4 }, { 0x12B6, 29 },
+			{ 0x12B8, 4 }, { 0x12BF, 29 }, { 0x12C0, 4 }, { 0x12C1, 29 }, { 0x12C2, 4 }, { 0x12C6, 29 }, { 0x12C8, 4 }, { 0x12D7, 29 },
+			{ 0x12D8, 4 }, { 0x1311, 29 }, { 0x1312, 4 }, { 0x1316, 29 }, { 0x1318, 4 }, { 0x135B, 29 }, { 0x135D, 5 }, { 0x1360, 17 },
+			{ 0x1369, 10 }, { 0x137D, 29 }, { 0x1380, 4 }, { 0x1390, 21 }, { 0x139A, 29 }, { 0x13A0, 0 }, { 0x13F6, 29 }, { 0x13F8, 1 },
+			{ 0x13FE, 29 }, { 0x1400, 12 }, { 0x1401, 4 }, { 0x166D, 21 }, { 0x166E, 17 }, { 0x166F, 4 }, { 0x1680, 22 }, { 0x1681, 4 },
+			{ 0x169B, 13 }, { 0x169C, 14 }, { 0x169D, 29 }, { 0x16A0, 4 }, { 0x16EB, 17 }, { 0x16EE, 9 }, { 0x16F1, 4 }, { 0x16F9, 29 },
+			{ 0x1700, 4 }, { 0x1712, 5 }, { 0x1715, 6 }, { 0x1716, 29 }, { 0x171F, 4 }, { 0x1732, 5 }, { 0x1734, 6 }, { 0x1735, 17 },
+			{ 0x1737, 29 }, { 0x1740, 4 }, { 0x1752, 5 }, { 0x1754, 29 }, { 0x1760, 4 }, { 0x176D, 29 }, { 0x176E, 4 }, { 0x1771, 29 },
+			{ 0x1772, 5 }, { 0x1774, 29 }, { 0x1780, 4 }, { 0x17B4, 5 }, { 0x17B6, 6 }, { 0x17B7, 5 }, { 0x17BE, 6 }, { 0x17C6, 5 },
+			{ 0x17C7, 6 }, { 0x17C9, 5 }, { 0x17D4, 17 }, { 0x17D7, 3 }, { 0x17D8, 17 }, { 0x17DB, 19 }, { 0x17DC, 4 }, { 0x17DD, 5 },
+			{ 0x17DE, 29 }, { 0x17E0, 8 }, { 0x17EA, 29 }, { 0x17F0, 10 }, { 0x17FA, 29 }, { 0x1800, 17 }, { 0x1806, 12 }, { 0x1807, 17 },
+			{ 0x180B, 5 }, { 0x180E, 26 }, { 0x180F, 5 }, { 0x1810, 8 }, { 0x181A, 29 }, { 0x1820, 4 }, { 0x1843, 3 }, { 0x1844, 4 },
+			{ 0x1879, 29 }, { 0x1880, 4 }, { 0x1885, 5 }, { 0x1887, 4 }, { 0x18A9, 5 }, { 0x18AA, 4 }, { 0x18AB, 29 }, { 0x18B0, 4 },
+			{ 0x18F6, 29 }, { 0x1900, 4 }, { 0x191F, 29 }, { 0x1920, 5 }, { 0x1923, 6 }, { 0x1927, 5 }, { 0x1929, 6 }, { 0x192C, 29 },
+			{ 0x1930, 6 }, { 0x1932, 5 }, { 0x1933, 6 }, { 0x1939, 5 }, { 0x193C, 29 }, { 0x1940, 21 }, { 0x1941, 29 }, { 0x1944, 17 },
+			{ 0x1946, 8 }, { 0x1950, 4 }, { 0x196E, 29 }, { 0x1970, 4 }, { 0x1975, 29 }, { 0x1980, 4 }, { 0x19AC, 29 }, { 0x19B0, 4 },
+			{ 0x19CA, 29 }, { 0x19D0, 8 }, { 0x19DA, 10 }, { 0x19DB, 29 }, { 0x19DE, 21 }, { 0x1A00, 4 }, { 0x1A17, 5 }, { 0x1A19, 6 },
+			{ 0x1A1B, 5 }, { 0x1A1C, 29 }, { 0x1A1E, 17 }, { 0x1A20, 4 }, { 0x1A55, 6 }, { 0x1A56, 5 }, { 0x1A57, 6 }, { 0x1A58, 5 },
+			{ 0x1A5F, 29 }, { 0x1A60, 5 }, { 0x1A61, 6 }, { 0x1A62, 5 }, { 0x1A63, 6 }, { 0x1A65, 5 }, { 0x1A6D, 6 }, { 0x1A73, 5 },
+			{ 0x1A7D, 29 }, { 0x1A7F, 5 }, { 0x1A80, 8 }, { 0x1A8A, 29 }, { 0x1A90, 8 }, { 0x1A9A, 29 }, { 0x1AA0, 17 }, { 0x1AA7, 3 },
+			{ 0x1AA8, 17 }, { 0x1AAE, 29 }, { 0x1AB0, 5 }, { 0x1ABE, 7 }, { 0x1ABF, 5 }, { 0x1ACF, 29 }, { 0x1B00, 5 }, { 0x1B04, 6 },
+			{ 0x1B05, 4 }, { 0x1B34, 5 }, { 0x1B35, 6 }, { 0x1B36, 5 }, { 0x1B3B, 6 }, { 0x1B3C, 5 }, { 0x1B3D, 6 }, { 0x1B42, 5 },
+			{ 0x1B43, 6 }, { 0x1B45, 4 }, { 0x1B4D, 29 }, { 0x1B50, 8 }, { 0x1B5A, 17 }, { 0x1B61, 21 }, { 0x1B6B, 5 }, { 0x1B74, 21 },
+			{ 0x1B7D, 17 }, { 0x1B7F, 29 }, { 0x1B80, 5 }, { 0x1B82, 6 }, { 0x1B83, 4 }, { 0x1BA1, 6 }, { 0x1BA2, 5 }, { 0x1BA6, 6 },
+			{ 0x1BA8, 5 }, { 0x1BAA, 6 }, { 0x1BAB, 5 }, { 0x1BAE, 4 }, { 0x1BB0, 8 }, { 0x1BBA, 4 }, { 0x1BE6, 5 }, { 0x1BE7, 6 },
+			{ 0x1BE8, 5 }, { 0x1BEA, 6 }, { 0x1BED, 5 }, { 0x1BEE, 6 }, { 0x1BEF, 5 }, { 0x1BF2, 6 }, { 0x1BF4, 29 }, { 0x1BFC, 17 },
+			{ 0x1C00, 4 }, { 0x1C24, 6 }, { 0x1C2C, 5 }, { 0x1C34, 6 }, { 0x1C36, 5 }, { 0x1C38, 29 }, { 0x1C3B, 17 }, { 0x1C40, 8 },
+			{ 0x1C4A, 29 }, { 0x1C4D, 4 }, { 0x1C50, 8 }, { 0x1C5A, 4 }, { 0x1C78, 3 }, { 0x1C7E, 17 }, { 0x1C80, 1 }, { 0x1C89, 29 },
+			{ 0x1C90, 0 }, { 0x1CBB, 29 }, { 0x1CBD, 0 }, { 0x1CC0, 17 }, { 0x1CC8, 29 }, { 0x1CD0, 5 }, { 0x1CD3, 17 }, { 0x1CD4, 5 },
+			{ 0x1CE1, 6 }, { 0x1CE2, 5 }, { 0x1CE9, 4 }, { 0x1CED, 5 }, { 0x1CEE, 4 }, { 0x1CF4, 5 }, { 0x1CF5, 4 }, { 0x1CF7, 6 },
+			{ 0x1CF8, 5 }, { 0x1CFA, 4 }, { 0x1CFB, 29 }, { 0x1D00, 1 }, { 0x1D2C, 3 }, { 0x1D6B, 1 }, { 0x1D78, 3 }, { 0x1D79, 1 },
+			{ 0x1D9B, 3 }, { 0x1DC0, 5 }, { 0x1E00, 0 }, { 0x1E01, 1 }, { 0x1E02, 0 }, { 0x1E03, 1 }, { 0x1E04, 0 }, { 0x1E05, 1 },
+			{ 0x1E06, 0 }, { 0x1E07, 1 }, { 0x1E08, 0 }, { 0x1E09, 1 }, { 0x1E0A, 0 }, { 0x1E0B, 1 }, { 0x1E0C, 0 }, { 0x1E0D, 1 },
+			{ 0x1E0E, 0 }, { 0x1E0F, 1 }, { 0x1E10, 0 }, { 0x1E11, 1 }, { 0x1E12, 0 }, { 0x1E13, 1 }, { 0x1E14, 0 }, { 0x1E15, 1 },
+			{ 0x1E16, 0 }, { 0x1E17, 1 }, { 0x1E18, 0 }, { 0x1E19, 1 }, { 0x1E1A, 0 }, { 0x1E1B, 1 }, { 0x1E1C, 0 }, { 0x1E1D, 1 },
+			{ 0x1E1E, 0 }, { 0x1E1F, 1 }, { 0x1E20, 0 }, { 0x1E21, 1 }, { 0x1E22, 0 }, { 0x1E23, 1 }, { 0x1E24, 0 }, { 0x1E25, 1 },
+			{ 0x1E26, 0 }, { 0x1E27, 1 }, { 0x1E28, 0 }, { 0x1E29, 1 }, { 0x1E2A, 0 }, { 0x1E2B, 1 }, { 0x1E2C, 0 }, { 0x1E2D, 1 },
+			{ 0x1E2E, 0 }, { 0x1E2F, 1 }, { 0x1E30, 0 }, { 0x1E31, 1 }, { 0x1E32, 0 }, { 0x1E33, 1 }, { 0x1E34, 0 }, { 0x1E35, 1 },
+			{ 0x1E36, 0 }, { 0x1E37, 1 }, { 0x1E38, 0 }, { 0x1E39, 1 }, { 0x1E3A, 0 }, { 0x1E3B, 1 }, { 0x1E3C, 0 }, { 0x1E3D, 1 },
+			{ 0x1E3E, 0 }, { 0x1E3F, 1 }, { 0x1E40, 0 }, { 0x1E41, 1 }, { 0x1E42, 0 }, { 0x1E43, 1 }, { 0x1E44, 0 }, { 0x1E45, 1 },
+			{ 0x1E46, 0 }, { 0x1E47, 1 }, { 0x1E48, 0 }, { 0x1E49, 1 }, { 0x1E4A, 0 }, { 0x1E4B, 1 }, { 0x1E4C, 0 }, { 0x1E4D, 1 },
+			{ 0x1E4E, 0 }, { 0x1E4F, 1 }, { 0x1E50, 0 }, { 0x1E51, 1 }, { 0x1E52, 0 }, { 0x1E53, 1 }, { 0x1E54, 0 }, { 0x1E55, 1 },
+			{ 0x1E56, 0 }, { 0x1E57, 1 }, { 0x1E58, 0 }, { 0x1E59, 1 }, { 0x1E5A, 0 }, { 0x1E5B, 1 }, { 0x1E5C, 0 }, { 0x1E5D, 1 },
+			{ 0x1E5E, 0 }, { 0x1E5F, 1 }, { 0x1E60, 0 }, { 0x1E61, 1 }, { 0x1E62, 0 }, { 0x1E63, 1 }, { 0x1E64, 0 }, { 0x1E65, 1 },
+			{ 0x1E66, 0 }, { 0x1E67, 1 }, { 0x1E68, 0 }, { 0x1E69, 1 }, { 0x1E6A, 0 }, { 0x1E6B, 1 }, { 0x1E6C, 0 }, { 0x1E6D, 1 },
+			{ 0x1E6E, 0 }, { 0x1E6F, 1 }, { 0x1E70, 0 }, { 0x1E71, 1 }, { 0x1E72, 0 }, { 0x1E73, 1 }, { 0x1E74, 0 }, { 0x1E75, 1 },
+			{ 0x1E76, 0 }, { 0x1E77, 1 }, { 0x1E78, 0 }, { 0x1E79, 1 }, { 0x1E7A, 0 }, { 0x1E7B, 1 }, { 0x1E7C, 0 }, { 0x1E7D, 1 },
+			{ 0x1E7E, 0 }, { 0x1E7F, 1 }, { 0x1E80, 0 }, { 0x1E81, 1 }, { 0x1E82, 0 }, { 0x1E83, 1 }, { 0x1E84, 0 }, { 0x1E85, 1 },
+			{ 0x1E86, 0 }, { 0x1E87, 1 }, { 0x1E88, 0 }, { 0x1E89, 1 }, { 0x1E8A, 0 }, { 0x1E8B, 1 }, { 0x1E8C, 0 }, { 0x1E8D, 1 },
+			{ 0x1E8E, 0 }, { 0x1E8F, 1 }, { 0x1E90, 0 }, { 0x1E91, 1 }, { 0x1E92, 0 }, { 0x1E93, 1 }, { 0x1E94, 0 }, { 0x1E95, 1 },
+			{ 0x1E9E, 0 }, { 0x1E9F, 1 }, { 0x1EA0, 0 }, { 0x1EA1, 1 }, { 0x1EA2, 0 }, { 0x1EA3, 1 }, { 0x1EA4, 0 }, { 0x1EA5, 1 },
+			{ 0x1EA6, 0 }, { 0x1EA7, 1 }, { 0x1EA8, 0 }, { 0x1EA9, 1 }, { 0x1EAA, 0 }, { 0x1EAB, 1 }, { 0x1EAC, 0 }, { 0x1EAD, 1 },
+			{ 0x1EAE, 0 }, { 0x1EAF, 1 }, { 0x1EB0, 0 }, { 0x1EB1, 1 }, { 0x1EB2, 0 }, { 0x1EB3, 1 }, { 0x1EB4, 0 }, { 0x1EB5, 1 },
+			{ 0x1EB6, 0 }, { 0x1EB7, 1 }, { 0x1EB8, 0 }, { 0x1EB9, 1 }, { 0x1EBA, 0 }, { 0x1EBB, 1 }, { 0x1EBC, 0 }, { 0x1EBD, 1 },
+			{ 0x1EBE, 0 }, { 0x1EBF, 1 }, { 0x1EC0, 0 }, { 0x1EC1, 1 }, { 0x1EC2, 0 }, { 0x1EC3, 1 }, { 0x1EC4, 0 }, { 0x1EC5, 1 },
+			{ 0x1EC6, 0 }, { 0x1EC7, 1 }, { 0x1EC8, 0 }, { 0x1EC9, 1 }, { 0x1ECA, 0 }, { 0x1ECB, 1 }, { 0x1ECC, 0 }, { 0x1ECD, 1 },
+			{ 0x1ECE, 0 }, { 0x1ECF, 1 }, { 0x1ED0, 0 }, { 0x1ED1, 1 }, { 0x1ED2, 0 }, { 0x1ED3, 1 }, { 0x1ED4, 0 }, { 0x1ED5, 1 },
+			{ 0x1ED6, 0 }, { 0x1ED7, 1 }, { 0x1ED8, 0 }, { 0x1ED9, 1 }, { 0x1EDA, 0 }, { 0x1EDB, 1 }, { 0x1EDC, 0 }, { 0x1EDD, 1 },
+			{ 0x1EDE, 0 }, { 0x1EDF, 1 }, { 0x1EE0, 0 }, { 0x1EE1, 1 }, { 0x1EE2, 0 }, { 0x1EE3, 1 }, { 0x1EE4, 0 }, { 0x1EE5, 1 },
+			{ 0x1EE6, 0 }, { 0x1EE7, 1 }, { 0x1EE8, 0 }, { 0x1EE9, 1 }, { 0x1EEA, 0 }, { 0x1EEB, 1 }, { 0x1EEC, 0 }, { 0x1EED, 1 },
+			{ 0x1EEE, 0 }, { 0x1EEF, 1 }, { 0x1EF0, 0 }, { 0x1EF1, 1 }, { 0x1EF2, 0 }, { 0x1EF3, 1 }, { 0x1EF4, 0 }, { 0x1EF5, 1 },
+			{ 0x1EF6, 0 }, { 0x1EF7, 1 }, { 0x1EF8, 0 }, { 0x1EF9, 1 }, { 0x1EFA, 0 }, { 0x1EFB, 1 }, { 0x1EFC, 0 }, { 0x1EFD, 1 },
+			{ 0x1EFE, 0 }, { 0x1EFF, 1 }, { 0x1F08, 0 }, { 0x1F10, 1 }, { 0x1F16, 29 }, { 0x1F18, 0 }, { 0x1F1E, 29 }, { 0x1F20, 1 },
+			{ 0x1F28, 0 }, { 0x1F30, 1 }, { 0x1F38, 0 }, { 0x1F40, 1 }, { 0x1F46, 29 }, { 0x1F48, 0 }, { 0x1F4E, 29 }, { 0x1F50, 1 },
+			{ 0x1F58, 29 }, { 0x1F59, 0 }, { 0x1F5A, 29 }, { 0x1F5B, 0 }, { 0x1F5C, 29 }, { 0x1F5D, 0 }, { 0x1F5E, 29 }, { 0x1F5F, 0 },
+			{ 0x1F60, 1 }, { 0x1F68, 0 }, { 0x1F70, 1 }, { 0x1F7E, 29 }, { 0x1F80, 1 }, { 0x1F88, 2 }, { 0x1F90, 1 }, { 0x1F98, 2 },
+			{ 0x1FA0, 1 }, { 0x1FA8, 2 }, { 0x1FB0, 1 }, { 0x1FB5, 29 }, { 0x1FB6, 1 }, { 0x1FB8, 0 }, { 0x1FBC, 2 }, { 0x1FBD, 20 },
+			{ 0x1FBE, 1 }, { 0x1FBF, 20 }, { 0x1FC2, 1 }, { 0x1FC5, 29 }, { 0x1FC6, 1 }, { 0x1FC8, 0 }, { 0x1FCC, 2 }, { 0x1FCD, 20 },
+			{ 0x1FD0, 1 }, { 0x1FD4, 29 }, { 0x1FD6, 1 }, { 0x1FD8, 0 }, { 0x1FDC, 29 }, { 0x1FDD, 20 }, { 0x1FE0, 1 }, { 0x1FE8, 0 },
+			{ 0x1FED, 20 }, { 0x1FF0, 29 }, { 0x1FF2, 1 }, { 0x1FF5, 29 }, { 0x1FF6, 1 }, { 0x1FF8, 0 }, { 0x1FFC, 2 }, { 0x1FFD, 20 },
+			{ 0x1FFF, 29 }, { 0x2000, 22 }, { 0x200B, 26 }, { 0x2010, 12 }, { 0x2016, 17 }, { 0x2018, 15 }, { 0x2019, 16 }, { 0x201A, 13 },
+			{ 0x201B, 15 }, { 0x201D, 16 }, { 0x201E, 13 }, { 0x201F, 15 }, { 0x2020, 17 }, { 0x2028, 23 }, { 0x2029, 24 }, { 0x202A, 26 },
+			{ 0x202F, 22 }, { 0x2030, 17 }, { 0x2039, 15 }, { 0x203A, 16 }, { 0x203B, 17 }, { 0x203F, 11 }, { 0x2041, 17 }, { 0x2044, 18 },
+			{ 0x2045, 13 }, { 0x2046, 14 }, { 0x2047, 17 }, { 0x2052, 18 }, { 0x2053, 17 }, { 0x2054, 11 }, { 0x2055, 17 }, { 0x205F, 22 },
+			{ 0x2060, 26 }, { 0x2065, 29 }, { 0x2066, 26 }, { 0x2070, 10 }, { 0x2071, 3 }, { 0x2072, 29 }, { 0x2074, 10 }, { 0x207A, 18 },
+			{ 0x207D, 13 }, { 0x207E, 14 }, { 0x207F, 3 }, { 0x2080, 10 }, { 0x208A, 18 }, { 0x208D, 13 }, { 0x208E, 14 }, { 0x208F, 29 },
+			{ 0x2090, 3 }, { 0x209D, 29 }, { 0x20A0, 19 }, { 0x20C1, 29 }, { 0x20D0, 5 }, { 0x20DD, 7 }, { 0x20E1, 5 }, { 0x20E2, 7 },
+			{ 0x20E5, 5 }, { 0x20F1, 29 }, { 0x2100, 21 }, { 0x2102, 0 }, { 0x2103, 21 }, { 0x2107, 0 }, { 0x2108, 21 }, { 0x210A, 1 },
+			{ 0x210B, 0 }, { 0x210E, 1 }, { 0x2110, 0 }, { 0x2113, 1 }, { 0x2114, 21 }, { 0x2115, 0 }, { 0x2116, 21 }, { 0x2118, 18 },
+			{ 0x2119, 0 }, { 0x211E, 21 }, { 0x2124, 0 }, { 0x2125, 21 }, { 0x2126, 0 }, { 0x2127, 21 }, { 0x2128, 0 }, { 0x2129, 21 },
+			{ 0x212A, 0 }, { 0x212E, 21 }, { 0x212F, 1 }, { 0x2130, 0 }, { 0x2134, 1 }, { 0x2135, 4 }, { 0x2139, 1 }, { 0x213A, 21 },
+			{ 0x213C, 1 }, { 0x213E, 0 }, { 0x2140, 18 }, { 0x2145, 0 }, { 0x2146, 1 }, { 0x214A, 21 }, { 0x214B, 18 }, { 0x214C, 21 },
+			{ 0x214E, 1 }, { 0x214F, 21 }, { 0x2150, 10 }, { 0x2160, 9 }, { 0x2183, 0 }, { 0x2184, 1 }, { 0x2185, 9 }, { 0x2189, 10 },
+			{ 0x218A, 21 }, { 0x218C, 29 }, { 0x2190, 18 }, { 0x2195, 21 }, { 0x219A, 18 }, { 0x219C, 21 }, { 0x21A0, 18 }, { 0x21A1, 21 },
+			{ 0x21A3, 18 }, { 0x21A4, 21 }, { 0x21A6, 18 }, { 0x21A7, 21 }, { 0x21AE, 18 }, { 0x21AF, 21 }, { 0x21CE, 18 }, { 0x21D0, 21 },
+			{ 0x21D2, 18 }, { 0x21D3, 21 }, { 0x21D4, 18 }, { 0x21D5, 21 }, { 0x21F4, 18 }, { 0x2300, 21 }, { 0x2308, 13 }, { 0x2309, 14 },
+			{ 0x230A, 13 }, { 0x230B, 14 }, { 0x230C, 21 }, { 0x2320, 18 }, { 0x2322, 21 }, { 0x2329, 13 }, { 0x232A, 14 }, { 0x232B, 21 },
+			{ 0x237C, 18 }, { 0x237D, 21 }, { 0x239B, 18 }, { 0x23B4, 21 }, { 0x23DC, 18 }, { 0x23E2, 21 }, { 0x2427, 29 }, { 0x2440, 21 },
+			{ 0x244B, 29 }, { 0x2460, 10 }, { 0x249C, 21 }, { 0x24EA, 10 }, { 0x2500, 21 }, { 0x25B7, 18 }, { 0x25B8, 21 }, { 0x25C1, 18 },
+			{ 0x25C2, 21 }, { 0x25F8, 18 }, { 0x2600, 21 }, { 0x266F, 18 }, { 0x2670, 21 }, { 0x2768, 13 }, { 0x2769, 14 }, { 0x276A, 13 },
+			{ 0x276B, 14 }, { 0x276C, 13 }, { 0x276D, 14 }, { 0x276E, 13 }, { 0x276F, 14 }, { 0x2770, 13 }, { 0x2771, 14 }, { 0x2772, 13 },
+			{ 0x2773, 14 }, { 0x2774, 13 }, { 0x2775, 14 }, { 0x2776, 10 }, { 0x2794, 21 }, { 0x27C0, 18 }, { 0x27C5, 13 }, { 0x27C6, 14 },
+			{ 0x27C7, 18 }, { 0x27E6, 13 }, { 0x27E7, 14 }, { 0x27E8, 13 }, { 0x27E9, 14 }, { 0x27EA, 13 }, { 0x27EB, 14 }, { 0x27EC, 13 },
+			{ 0x27ED, 14 }, { 0x27EE, 13 }, { 0x27EF, 14 }, { 0x27F0, 18 }, { 0x2800, 21 }, { 0x2900, 18 }, { 0x2983, 13 }, { 0x2984, 14 },
+			{ 0x2985, 13 }, { 0x2986, 14 }, { 0x2987, 13 }, { 0x2988, 14 }, { 0x2989, 13 }, { 0x298A, 14 }, { 0x298B, 13 }, { 0x298C, 14 },
+			{ 0x298D, 13 }, { 0x298E, 14 }, { 0x298F, 13 }, { 0x2990, 14 }, { 0x2991, 13 }, { 0x2992, 14 }, { 0x2993, 13 }, { 0x2994, 14 },
+			{ 0x2995, 13 }, { 0x2996, 14 }, { 0x2997, 13 }, { 0x2998, 14 }, { 0x2999, 18 }, { 0x29D8, 13 }, { 0x29D9, 14 }, { 0x29DA, 13 },
+			{ 0x29DB, 14 }, { 0x29DC, 18 }, { 0x29FC, 13 }, { 0x29FD, 14 }, { 0x29FE, 18 }, { 0x2B00, 21 }, { 0x2B30, 18 }, { 0x2B45, 21 },
+			{ 0x2B47, 18 }, { 0x2B4D, 21 }, { 0x2B74, 29 }, { 0x2B76, 21 }, { 0x2B96, 29 }, { 0x2B97, 21 }, { 0x2C00, 0 }, { 0x2C30, 1 },
+			{ 0x2C60, 0 }, { 0x2C61, 1 }, { 0x2C62, 0 }, { 0x2C65, 1 }, { 0x2C67, 0 }, { 0x2C68, 1 }, { 0x2C69, 0 }, { 0x2C6A, 1 },
+			{ 0x2C6B, 0 }, { 0x2C6C, 1 }, { 0x2C6D, 0 }, { 0x2C71, 1 }, { 0x2C72, 0 }, { 0x2C73, 1 }, { 0x2C75, 0 }, { 0x2C76, 1 },
+			{ 0x2C7C, 3 }, { 0x2C7E, 0 }, { 0x2C81, 1 }, { 0x2C82, 0 }, { 0x2C83, 1 }, { 0x2C84, 0 }, { 0x2C85, 1 }, { 0x2C86, 0 },
+			{ 0x2C87, 1 }, { 0x2C88, 0 }, { 0x2C89, 1 }, { 0x2C8A, 0 }, { 0x2C8B, 1 }, { 0x2C8C, 0 }, { 0x2C8D, 1 }, { 0x2C8E, 0 },
+			{ 0x2C8F, 1 }, { 0x2C90, 0 }, { 0x2C91, 1 }, { 0x2C92, 0 }, { 0x2C93, 1 }, { 0x2C94, 0 }, { 0x2C95, 1 }, { 0x2C96, 0 },
+			{ 0x2C97, 1 }, { 0x2C98, 0 }, { 0x2C99, 1 }, { 0x2C9A, 0 }, { 0x2C9B, 1 }, { 0x2C9C, 0 }, { 0x2C9D, 1 }, { 0x2C9E, 0 },
+			{ 0x2C9F, 1 }, { 0x2CA0, 0 }, { 0x2CA1, 1 }, { 0x2CA2, 0 }, { 0x2CA3, 1 }, { 0x2CA4, 0 }, { 0x2CA5, 1 }, { 0x2CA6, 0 },
+			{ 0x2CA7, 1 }, { 0x2CA8, 0 }, { 0x2CA9, 1 }, { 0x2CAA, 0 }, { 0x2CAB, 1 }, { 0x2CAC, 0 }, { 0x2CAD, 1 }, { 0x2CAE, 0 },
+			{ 0x2CAF, 1 }, { 0x2CB0, 0 }, { 0x2CB1, 1 }, { 0x2CB2, 0 }, { 0x2CB3, 1 }, { 0x2CB4, 0 }, { 0x2CB5, 1 }, { 0x2CB6, 0 },
+			{ 0x2CB7, 1 }, { 0x2CB8, 0 }, { 0x2CB9, 1 }, { 0x2CBA, 0 }, { 0x2CBB, 1 }, { 0x2CBC, 0 }, { 0x2CBD, 1 }, { 0x2CBE, 0 },
+			{ 0x2CBF, 1 }, { 0x2CC0, 0 }, { 0x2CC1, 1 }, { 0x2CC2, 0 }, { 0x2CC3, 1 }, { 0x2CC4, 0 }, { 0x2CC5, 1 }, { 0x2CC6, 0 },
+			{ 0x2CC7, 1 }, { 0x2CC8, 0 }, { 0x2CC9, 1 }, { 0x2CCA, 0 }, { 0x2CCB, 1 }, { 0x2CCC, 0 }, { 0x2CCD, 1 }, { 0x2CCE, 0 },
+			{ 0x2CCF, 1 }, { 0x2CD0, 0 }, { 0x2CD1, 1 }, { 0x2CD2, 0 }, { 0x2CD3, 1 }, { 0x2CD4, 0 }, { 0x2CD5, 1 }, { 0x2CD6, 0 },
+			{ 0x2CD7, 1 }, { 0x2CD8, 0 }, { 0x2CD9, 1 }, { 0x2CDA, 0 }, { 0x2CDB, 1 }, { 0x2CDC, 0 }, { 0x2CDD, 1 }, { 0x2CDE, 0 },
+			{ 0x2CDF, 1 }, { 0x2CE0, 0 }, { 0x2CE1, 1 }, { 0x2CE2, 0 }, { 0x2CE3, 1 }, { 0x2CE5, 21 }, { 0x2CEB, 0 }, { 0x2CEC, 1 },
+			{ 0x2CED, 0 }, { 0x2CEE, 1 }, { 0x2CEF, 5 }, { 0x2CF2, 0 }, { 0x2CF3, 1 }, { 0x2CF4, 29 }, { 0x2CF9, 17 }, { 0x2CFD, 10 },
+			{ 0x2CFE, 17 }, { 0x2D00, 1 }, { 0x2D26, 29 }, { 0x2D27, 1 }, { 0x2D28, 29 }, { 0x2D2D, 1 }, { 0x2D2E, 29 }, { 0x2D30, 4 },
+			{ 0x2D68, 29 }, { 0x2D6F, 3 }, { 0x2D70, 17 }, { 0x2D71, 29 }, { 0x2D7F, 5 }, { 0x2D80, 4 }, { 0x2D97, 29 }, { 0x2DA0, 4 },
+			{ 0x2DA7, 29 }, { 0x2DA8, 4 }, { 0x2DAF, 29 }, { 0x2DB0, 4 }, { 0x2DB7, 29 }, { 0x2DB8, 4 }, { 0x2DBF, 29 }, { 0x2DC0, 4 },
+			{ 0x2DC7, 29 }, { 0x2DC8, 4 }, { 0x2DCF, 29 }, { 0x2DD0, 4 }, { 0x2DD7, 29 }, { 0x2DD8, 4 }, { 0x2DDF, 29 }, { 0x2DE0, 5 },
+			{ 0x2E00, 17 }, { 0x2E02, 15 }, { 0x2E03, 16 }, { 0x2E04, 15 }, { 0x2E05, 16 }, { 0x2E06, 17 }, { 0x2E09, 15 }, { 0x2E0A, 16 },
+			{ 0x2E0B, 17 }, { 0x2E0C, 15 }, { 0x2E0D, 16 }, { 0x2E0E, 17 }, { 0x2E17, 12 }, { 0x2E18, 17 }, { 0x2E1A, 12 }, { 0x2E1B, 17 },
+			{ 0x2E1C, 15 }, { 0x2E1D, 16 }, { 0x2E1E, 17 }, { 0x2E20, 15 }, { 0x2E21, 16 }, { 0x2E22, 13 }, { 0x2E23, 14 }, { 0x2E24, 13 },
+			{ 0x2E25, 14 }, { 0x2E26, 13 }, { 0x2E27, 14 }, { 0x2E28, 13 }, { 0x2E29, 14 }, { 0x2E2A, 17 }, { 0x2E2F, 3 }, { 0x2E30, 17 },
+			{ 0x2E3A, 12 }, { 0x2E3C, 17 }, { 0x2E40, 12 }, { 0x2E41, 17 }, { 0x2E42, 13 }, { 0x2E43, 17 }, { 0x2E50, 21 }, { 0x2E52, 17 },
+			{ 0x2E55, 13 }, { 0x2E56, 14 }, { 0x2E57, 13 }, { 0x2E58, 14 }, { 0x2E59, 13 }, { 0x2E5A, 14 }, { 0x2E5B, 13 }, { 0x2E5C, 14 },
+			{ 0x2E5D, 12 }, { 0x2E5E, 29 }, { 0x2E80, 21 }, { 0x2E9A, 29 }, { 0x2E9B, 21 }, { 0x2EF4, 29 }, { 0x2F00, 21 }, { 0x2FD6, 29 },
+			{ 0x2FF0, 21 }, { 0x2FFC, 29 }, { 0x3000, 22 }, { 0x3001, 17 }, { 0x3004, 21 }, { 0x3005, 3 }, { 0x3006, 4 }, { 0x3007, 9 },
+			{ 0x3008, 13 }, { 0x3009, 14 }, { 0x300A, 13 }, { 0x300B, 14 }, { 0x300C, 13 }, { 0x300D, 14 }, { 0x300E, 13 }, { 0x300F, 14 },
+			{ 0x3010, 13 }, { 0x3011, 14 }, { 0x3012, 21 }, { 0x3014, 13 }, { 0x3015, 14 }, { 0x3016, 13 }, { 0x3017, 14 }, { 0x3018, 13 },
+			{ 0x3019, 14 }, { 0x301A, 13 }, { 0x301B, 14 }, { 0x301C, 12 }, { 0x301D, 13 }, { 0x301E, 14 }, { 0x3020, 21 }, { 0x3021, 9 },
+			{ 0x302A, 5 }, { 0x302E, 6 }, { 0x3030, 12 }, { 0x3031, 3 }, { 0x3036, 21 }, { 0x3038, 9 }, { 0x303B, 3 }, { 0x303C, 4 },
+			{ 0x303D, 17 }, { 0x303E, 21 }, { 0x3040, 29 }, { 0x3041, 4 }, { 0x3097, 29 }, { 0x3099, 5 }, { 0x309B, 20 }, { 0x309D, 3 },
+			{ 0x309F, 4 }, { 0x30A0, 12 }, { 0x30A1, 4 }, { 0x30FB, 17 }, { 0x30FC, 3 }, { 0x30FF, 4 }, { 0x3100, 29 }, { 0x3105, 4 },
+			{ 0x3130, 29 }, { 0x3131, 4 }, { 0x318F, 29 }, { 0x3190, 21 }, { 0x3192, 10 }, { 0x3196, 21 }, { 0x31A0, 4 }, { 0x31C0, 21 },
+			{ 0x31E4, 29 }, { 0x31F0, 4 }, { 0x3200, 21 }, { 0x321F, 29 }, { 0x3220, 10 }, { 0x322A, 21 }, { 0x3248, 10 }, { 0x3250, 21 },
+			{ 0x3251, 10 }, { 0x3260, 21 }, { 0x3280, 10 }, { 0x328A, 21 }, { 0x32B1, 10 }, { 0x32C0, 21 }, { 0x3400, 4 }, { 0x4DC0, 21 },
+			{ 0x4E00, 4 }, { 0xA015, 3 }, { 0xA016, 4 }, { 0xA48D, 29 }, { 0xA490, 21 }, { 0xA4C7, 29 }, { 0xA4D0, 4 }, { 0xA4F8, 3 },
+			{ 0xA4FE, 17 }, { 0xA500, 4 }, { 0xA60C, 3 }, { 0xA60D, 17 }, { 0xA610, 4 }, { 0xA620, 8 }, { 0xA62A, 4 }, { 0xA62C, 29 },
+			{ 0xA640, 0 }, { 0xA641, 1 }, { 0xA642, 0 }, { 0xA643, 1 }, { 0xA644, 0 }, { 0xA645, 1 }, { 0xA646, 0 }, { 0xA647, 1 },
+			{ 0xA648, 0 }, { 0xA649, 1 }, { 0xA64A, 0 }, { 0xA64B, 1 }, { 0xA64C, 0 }, { 0xA64D, 1 }, { 0xA64E, 0 }, { 0xA64F, 1 },
+			{ 0xA650, 0 }, { 0xA651, 1 }, { 0xA652, 0 }, { 0xA653, 1 }, { 0xA654, 0 }, { 0xA655, 1 }, { 0xA656, 0 }, { 0xA657, 1 },
+			{ 0xA658, 0 }, { 0xA659, 1 }, { 0xA65A, 0 }, { 0xA65B, 1 }, { 0xA65C, 0 }, { 0xA65D, 1 }, { 0xA65E, 0 }, { 0xA65F, 1 },
+			{ 0xA660, 0 }, { 0xA661, 1 }, { 0xA662, 0 }, { 0xA663, 1 }, { 0xA664, 0 }, { 0xA665, 1 }, { 0xA666, 0 }, { 0xA667, 1 },
+			{ 0xA668, 0 }, { 0xA669, 1 }, { 0xA66A, 0 }, { 0xA66B, 1 }, { 0xA66C, 0 }, { 0xA66D, 1 }, { 0xA66E, 4 }, { 0xA66F, 5 },
+			{ 0xA670, 7 }, { 0xA673, 17 }, { 0xA674, 5 }, { 0xA67E, 17 }, { 0xA67F, 3 }, { 0xA680, 0 }, { 0xA681, 1 }, { 0xA682, 0 },
+			{ 0xA683, 1 }, { 0xA684, 0 }, { 0xA685, 1 }, { 0xA686, 0 }, { 0xA687, 1 }, { 0xA688, 0 }, { 0xA689, 1 }, { 0xA68A, 0 },
+			{ 0xA68B, 1 }, { 0xA68C, 0 }, { 0xA68D, 1 }, { 0xA68E, 0 }, { 0xA68F, 1 }, { 0xA690, 0 }, { 0xA691, 1 }, { 0xA692, 0 },
+			{ 0xA693, 1 }, { 0xA694, 0 }, { 0xA695, 1 }, { 0xA696, 0 }, { 0xA697, 1 }, { 0xA698, 0 }, { 0xA699, 1 }, { 0xA69A, 0 },
+			{ 0xA69B, 1 }, { 0xA69C, 3 }, { 0xA69E, 5 }, { 0xA6A0, 4 }, { 0xA6E6, 9 }, { 0xA6F0, 5 }, { 0xA6F2, 17 }, { 0xA6F8, 29 },
+			{ 0xA700, 20 }, { 0xA717, 3 }, { 0xA720, 20 }, { 0xA722, 0 }, { 0xA723, 1 }, { 0xA724, 0 }, { 0xA725, 1 }, { 0xA726, 0 },
+			{ 0xA727, 1 }, { 0xA728, 0 }, { 0xA729, 1 }, { 0xA72A, 0 }, { 0xA72B, 1 }, { 0xA72C, 0 }, { 0xA72D, 1 }, { 0xA72E, 0 },
+			{ 0xA72F, 1 }, { 0xA732, 0 }, { 0xA733, 1 }, { 0xA734, 0 }, { 0xA735, 1 }, { 0xA736, 0 }, { 0xA737, 1 }, { 0xA738, 0 },
+			{ 0xA739, 1 }, { 0xA73A, 0 }, { 0xA73B, 1 }, { 0xA73C, 0 }, { 0xA73D, 1 }, { 0xA73E, 0 }, { 0xA73F, 1 }, { 0xA740, 0 },
+			{ 0xA741, 1 }, { 0xA742, 0 }, { 0xA743, 1 }, { 0xA744, 0 }, { 0xA745, 1 }, { 0xA746, 0 }, { 0xA747, 1 }, { 0xA748, 0 },
+			{ 0xA749, 1 }, { 0xA74A, 0 }, { 0xA74B, 1 }, { 0xA74C, 0 }, { 0xA74D, 1 }, { 0xA74E, 0 }, { 0xA74F, 1 }, { 0xA750, 0 },
+			{ 0xA751, 1 }, { 0xA752, 0 }, { 0xA753, 1 }, { 0xA754, 0 }, { 0xA755, 1 }, { 0xA756, 0 }, { 0xA757, 1 }, { 0xA758, 0 },
+			{ 0xA759, 1 }, { 0xA75A, 0 }, { 0xA75B, 1 }, { 0xA75C, 0 }, { 0xA75D, 1 }, { 0xA75E, 0 }, { 0xA75F, 1 }, { 0xA760, 0 },
+			{ 0xA761, 1 }, { 0xA762, 0 }, { 0xA763, 1 }, { 0xA764, 0 }, { 0xA765, 1 }, { 0xA766, 0 }, { 0xA767, 1 }, { 0xA768, 0 },
+			{ 0xA769, 1 }, { 0xA76A, 0 }, { 0xA76B, 1 }, { 0xA76C, 0 }, { 0xA76D, 1 }, { 0xA76E, 0 }, { 0xA76F, 1 }, { 0xA770, 3 },
+			{ 0xA771, 1 }, { 0xA779, 0 }, { 0xA77A, 1 }, { 0xA77B, 0 }, { 0xA77C, 1 }, { 0xA77D, 0 }, { 0xA77F, 1 }, { 0xA780, 0 },
+			{ 0xA781, 1 }, { 0xA782, 0 }, { 0xA783, 1 }, { 0xA784, 0 }, { 0xA785, 1 }, { 0xA786, 0 }, { 0xA787, 1 }, { 0xA788, 3 },
+			{ 0xA789, 20 }, { 0xA78B, 0 }, { 0xA78C, 1 }, { 0xA78D, 0 }, { 0xA78E, 1 }, { 0xA78F, 4 }, { 0xA790, 0 }, { 0xA791, 1 },
+			{ 0xA792, 0 }, { 0xA793, 1 }, { 0xA796, 0 }, { 0xA797, 1 }, { 0xA798, 0 }, { 0xA799, 1 }, { 0xA79A, 0 }, { 0xA79B, 1 },
+			{ 0xA79C, 0 }, { 0xA79D, 1 }, { 0xA79E, 0 }, { 0xA79F, 1 }, { 0xA7A0, 0 }, { 0xA7A1, 1 }, { 0xA7A2, 0 }, { 0xA7A3, 1 },
+			{ 0xA7A4, 0 }, { 0xA7A5, 1 }, { 0xA7A6, 0 }, { 0xA7A7, 1 }, { 0xA7A8, 0 }, { 0xA7A9, 1 }, { 0xA7AA, 0 }, { 0xA7AF, 1 },
+			{ 0xA7B0, 0 }, { 0xA7B5, 1 }, { 0xA7B6, 0 }, { 0xA7B7, 1 }, { 0xA7B8, 0 }, { 0xA7B9, 1 }, { 0xA7BA, 0 }, { 0xA7BB, 1 },
+			{ 0xA7BC, 0 }, { 0xA7BD, 1 }, { 0xA7BE, 0 }, { 0xA7BF, 1 }, { 0xA7C0, 0 }, { 0xA7C1, 1 }, { 0xA7C2, 0 }, { 0xA7C3, 1 },
+			{ 0xA7C4, 0 }, { 0xA7C8, 1 }, { 0xA7C9, 0 }, { 0xA7CA, 1 }, { 0xA7CB, 29 }, { 0xA7D0, 0 }, { 0xA7D1, 1 }, { 0xA7D2, 29 },
+			{ 0xA7D3, 1 }, { 0xA7D4, 29 }, { 0xA7D5, 1 }, { 0xA7D6, 0 }, { 0xA7D7, 1 }, { 0xA7D8, 0 }, { 0xA7D9, 1 }, { 0xA7DA, 29 },
+			{ 0xA7F2, 3 }, { 0xA7F5, 0 }, { 0xA7F6, 1 }, { 0xA7F7, 4 }, { 0xA7F8, 3 }, { 0xA7FA, 1 }, { 0xA7FB, 4 }, { 0xA802, 5 },
+			{ 0xA803, 4 }, { 0xA806, 5 }, { 0xA807, 4 }, { 0xA80B, 5 }, { 0xA80C, 4 }, { 0xA823, 6 }, { 0xA825, 5 }, { 0xA827, 6 },
+			{ 0xA828, 21 }, { 0xA82C, 5 }, { 0xA82D, 29 }, { 0xA830, 10 }, { 0xA836, 21 }, { 0xA838, 19 }, { 0xA839, 21 }, { 0xA83A, 29 },
+			{ 0xA840, 4 }, { 0xA874, 17 }, { 0xA878, 29 }, { 0xA880, 6 }, { 0xA882, 4 }, { 0xA8B4, 6 }, { 0xA8C4, 5 }, { 0xA8C6, 29 },
+			{ 0xA8CE, 17 }, { 0xA8D0, 8 }, { 0xA8DA, 29 }, { 0xA8E0, 5 }, { 0xA8F2, 4 }, { 0xA8F8, 17 }, { 0xA8FB, 4 }, { 0xA8FC, 17 },
+			{ 0xA8FD, 4 }, { 0xA8FF, 5 }, { 0xA900, 8 }, { 0xA90A, 4 }, { 0xA926, 5 }, { 0xA92E, 17 }, { 0xA930, 4 }, { 0xA947, 5 },
+			{ 0xA952, 6 }, { 0xA954, 29 }, { 0xA95F, 17 }, { 0xA960, 4 }, { 0xA97D, 29 }, { 0xA980, 5 }, { 0xA983, 6 }, { 0xA984, 4 },
+			{ 0xA9B3, 5 }, { 0xA9B4, 6 }, { 0xA9B6, 5 }, { 0xA9BA, 6 }, { 0xA9BC, 5 }, { 0xA9BE, 6 }, { 0xA9C1, 17 }, { 0xA9CE, 29 },
+			{ 0xA9CF, 3 }, { 0xA9D0, 8 }, { 0xA9DA, 29 }, { 0xA9DE, 17 }, { 0xA9E0, 4 }, { 0xA9E5, 5 }, { 0xA9E6, 3 }, { 0xA9E7, 4 },
+			{ 0xA9F0, 8 }, { 0xA9FA, 4 }, { 0xA9FF, 29 }, { 0xAA00, 4 }, { 0xAA29, 5 }, { 0xAA2F, 6 }, { 0xAA31, 5 }, { 0xAA33, 6 },
+			{ 0xAA35, 5 }, { 0xAA37, 29 }, { 0xAA40, 4 }, { 0xAA43, 5 }, { 0xAA44, 4 }, { 0xAA4C, 5 }, { 0xAA4D, 6 }, { 0xAA4E, 29 },
+			{ 0xAA50, 8 }, { 0xAA5A, 29 }, { 0xAA5C, 17 }, { 0xAA60, 4 }, { 0xAA70, 3 }, { 0xAA71, 4 }, { 0xAA77, 21 }, { 0xAA7A, 4 },
+			{ 0xAA7B, 6 }, { 0xAA7C, 5 }, { 0xAA7D, 6 }, { 0xAA7E, 4 }, { 0xAAB0, 5 }, { 0xAAB1, 4 }, { 0xAAB2, 5 }, { 0xAAB5, 4 },
+			{ 0xAAB7, 5 }, { 0xAAB9, 4 }, { 0xAABE, 5 }, { 0xAAC0, 4 }, { 0xAAC1, 5 }, { 0xAAC2, 4 }, { 0xAAC3, 29 }, { 0xAADB, 4 },
+			{ 0xAADD, 3 }, { 0xAADE, 17 }, { 0xAAE0, 4 }, { 0xAAEB, 6 }, { 0xAAEC, 5 }, { 0xAAEE, 6 }, { 0xAAF0, 17 }, { 0xAAF2, 4 },
+			{ 0xAAF3, 3 }, { 0xAAF5, 6 }, { 0xAAF6, 5 }, { 0xAAF7, 29 }, { 0xAB01, 4 }, { 0xAB07, 29 }, { 0xAB09, 4 }, { 0xAB0F, 29 },
+			{ 0xAB11, 4 }, { 0xAB17, 29 }, { 0xAB20, 4 }, { 0xAB27, 29 }, { 0xAB28, 4 }, { 0xAB2F, 29 }, { 0xAB30, 1 }, { 0xAB5B, 20 },
+			{ 0xAB5C, 3 }, { 0xAB60, 1 }, { 0xAB69, 3 }, { 0xAB6A, 20 }, { 0xAB6C, 29 }, { 0xAB70, 1 }, { 0xABC0, 4 }, { 0xABE3, 6 },
+			{ 0xABE5, 5 }, { 0xABE6, 6 }, { 0xABE8, 5 }, { 0xABE9, 6 }, { 0xABEB, 17 }, { 0xABEC, 6 }, { 0xABED, 5 }, { 0xABEE, 29 },
+			{ 0xABF0, 8 }, { 0xABFA, 29 }, { 0xAC00, 4 }, { 0xD7A4, 29 }, { 0xD7B0, 4 }, { 0xD7C7, 29 }, { 0xD7CB, 4 }, { 0xD7FC, 29 },
+			{ 0xD800, 27 }, { 0xE000, 28 }, { 0xF900, 4 }, { 0xFA6E, 29 }, { 0xFA70, 4 }, { 0xFADA, 29 }, { 0xFB00, 1 }, { 0xFB07, 29 },
+			{ 0xFB13, 1 }, { 0xFB18, 29 }, { 0xFB1D, 4 }, { 0xFB1E, 5 }, { 0xFB1F, 4 }, { 0xFB29, 18 }, { 0xFB2A, 4 }, { 0xFB37, 29 },
+			{ 0xFB38, 4 }, { 0xFB3D, 29 }, { 0xFB3E, 4 }, { 0xFB3F, 29 }, { 0xFB40, 4 }, { 0xFB42, 29 }, { 0xFB43, 4 }, { 0xFB45, 29 },
+			{ 0xFB46, 4 }, { 0xFBB2, 20 }, { 0xFBC3, 29 }, { 0xFBD3, 4 }, { 0xFD3E, 14 }, { 0xFD3F, 13 }, { 0xFD40, 21 }, { 0xFD50, 4 },
+			{ 0xFD90, 29 }, { 0xFD92, 4 }, { 0xFDC8, 29 }, { 0xFDCF, 21 }, { 0xFDD0, 29 }, { 0xFDF0, 4 }, { 0xFDFC, 19 }, { 0xFDFD, 21 },
+			{ 0xFE00, 5 }, { 0xFE10, 17 }, { 0xFE17, 13 }, { 0xFE18, 14 }, { 0xFE19, 17 }, { 0xFE1A, 29 }, { 0xFE20, 5 }, { 0xFE30, 17 },
+			{ 0xFE31, 12 }, { 0xFE33, 11 }, { 0xFE35, 13 }, { 0xFE36, 14 }, { 0xFE37, 13 }, { 0xFE38, 14 }, { 0xFE39, 13 }, { 0xFE3A, 14 },
+			{ 0xFE3B, 13 }, { 0xFE3C, 14 }, { 0xFE3D, 13 }, { 0xFE3E, 14 }, { 0xFE3F, 13 }, { 0xFE40, 14 }, { 0xFE41, 13 }, { 0xFE42, 14 },
+			{ 0xFE43, 13 }, { 0xFE44, 14 }, { 0xFE45, 17 }, { 0xFE47, 13 }, { 0xFE48, 14 }, { 0xFE49, 17 }, { 0xFE4D, 11 }, { 0xFE50, 17 },
+			{ 0xFE53, 29 }, { 0xFE54, 17 }, { 0xFE58, 12 }, { 0xFE59, 13 }, { 0xFE5A, 14 }, { 0xFE5B, 13 }, { 0xFE5C, 14 }, { 0xFE5D, 13 },
+			{ 0xFE5E, 14 }, { 0xFE5F, 17 }, { 0xFE62, 18 }, { 0xFE63, 12 }, { 0xFE64, 18 }, { 0xFE67, 29 }, { 0xFE68, 17 }, { 0xFE69, 19 },
+			{ 0xFE6A, 17 }, { 0xFE6C, 29 }, { 0xFE70, 4 }, { 0xFE75, 29 }, { 0xFE76, 4 }, { 0xFEFD, 29 }, { 0xFEFF, 26 }, { 0xFF00, 29 },
+			{ 0xFF01, 17 }, { 0xFF04, 19 }, { 0xFF05, 17 }, { 0xFF08, 13 }, { 0xFF09, 14 }, { 0xFF0A, 17 }, { 0xFF0B, 18 }, { 0xFF0C, 17 },
+			{ 0xFF0D, 12 }, { 0xFF0E, 17 }, { 0xFF10, 8 }, { 0xFF1A, 17 }, { 0xFF1C, 18 }, { 0xFF1F, 17 }, { 0xFF21, 0 }, { 0xFF3B, 13 },
+			{ 0xFF3C, 17 }, { 0xFF3D, 14 }, { 0xFF3E, 20 }, { 0xFF3F, 11 }, { 0xFF40, 20 }, { 0xFF41, 1 }, { 0xFF5B, 13 }, { 0xFF5C, 18 },
+			{ 0xFF5D, 14 }, { 0xFF5E, 18 }, { 0xFF5F, 13 }, { 0xFF60, 14 }, { 0xFF61, 17 }, { 0xFF62, 13 }, { 0xFF63, 14 }, { 0xFF64, 17 },
+			{ 0xFF66, 4 }, { 0xFF70, 3 }, { 0xFF71, 4 }, { 0xFF9E, 3 }, { 0xFFA0, 4 }, { 0xFFBF, 29 }, { 0xFFC2, 4 }, { 0xFFC8, 29 },
+			{ 0xFFCA, 4 }, { 0xFFD0, 29 }, { 0xFFD2, 4 }, { 0xFFD8, 29 }, { 0xFFDA, 4 }, { 0xFFDD, 29 }, { 0xFFE0, 19 }, { 0xFFE2, 18 },
+			{ 0xFFE3, 20 }, { 0xFFE4, 21 }, { 0xFFE5, 19 }, { 0xFFE7, 29 }, { 0xFFE8, 21 }, { 0xFFE9, 18 }, { 0xFFED, 21 }, { 0xFFEF, 29 },
+			{ 0xFFF9, 26 }, { 0xFFFC, 21 }, { 0xFFFE, 29 }, { 0x10000, 4 }, { 0x1000C, 29 }, { 0x1000D, 4 }, { 0x10027, 29 }, { 0x10028, 4 },
+			{ 0x1003B, 29 }, { 0x1003C, 4 }, { 0x1003E, 29 }, { 0x1003F, 4 }, { 0x1004E, 29 }, { 0x10050, 4 }, { 0x1005E, 29 }, { 0x10080, 4 },
+			{ 0x100FB, 29 }, { 0x10100, 17 }, { 0x10103, 29 }, { 0x10107, 10 }, { 0x10134, 29 }, { 0x10137, 21 }, { 0x10140, 9 }, { 0x10175, 10 },
+			{ 0x10179, 21 }, { 0x1018A, 10 }, { 0x1018C, 21 }, { 0x1018F, 29 }, { 0x10190, 21 }, { 0x1019D, 29 }, { 0x101A0, 21 }, { 0x101A1, 29 },
+			{ 0x101D0, 21 }, { 0x101FD, 5 }, { 0x101FE, 29 }, { 0x10280, 4 }, { 0x1029D, 29 }, { 0x102A0, 4 }, { 0x102D1, 29 }, { 0x102E0, 5 },
+			{ 0x102E1, 10 }, { 0x102FC, 29 }, { 0x10300, 4 }, { 0x10320, 10 }, { 0x10324, 29 }, { 0x1032D, 4 }, { 0x10341, 9 }, { 0x10342, 4 },
+			{ 0x1034A, 9 }, { 0x1034B, 29 }, { 0x10350, 4 }, { 0x10376, 5 }, { 0x1037B, 29 }, { 0x10380, 4 }, { 0x1039E, 29 }, { 0x1039F, 17 },
+			{ 0x103A0, 4 }, { 0x103C4, 29 }, { 0x103C8, 4 }, { 0x103D0, 17 }, { 0x103D1, 9 }, { 0x103D6, 29 }, { 0x10400, 0 }, { 0x10428, 1 },
+			{ 0x10450, 4 }, { 0x1049E, 29 }, { 0x104A0, 8 }, { 0x104AA, 29 }, { 0x104B0, 0 }, { 0x104D4, 29 }, { 0x104D8, 1 }, { 0x104FC, 29 },
+			{ 0x10500, 4 }, { 0x10528, 29 }, { 0x10530, 4 }, { 0x10564, 29 }, { 0x1056F, 17 }, { 0x10570, 0 }, { 0x1057B, 29 }, { 0x1057C, 0 },
+			{ 0x1058B, 29 }, { 0x1058C, 0 }, { 0x10593, 29 }, { 0x10594, 0 }, { 0x10596, 29 }, { 0x10597, 1 }, { 0x105A2, 29 }, { 0x105A3, 1 },
+			{ 0x105B2, 29 }, { 0x105B3, 1 }, { 0x105BA, 29 }, { 0x105BB, 1 }, { 0x105BD, 29 }, { 0x10600, 4 }, { 0x10737, 29 }, { 0x10740, 4 },
+			{ 0x10756, 29 }, { 0x10760, 4 }, { 0x10768, 29 }, { 0x10780, 3 }, { 0x10786, 29 }, { 0x10787, 3 }, { 0x107B1, 29 }, { 0x107B2, 3 },
+			{ 0x107BB, 29 }, { 0x10800, 4 }, { 0x10806, 29 }, { 0x10808, 4 }, { 0x10809, 29 }, { 0x1080A, 4 }, { 0x10836, 29 }, { 0x10837, 4 },
+			{ 0x10839, 29 }, { 0x1083C, 4 }, { 0x1083D, 29 }, { 0x1083F, 4 }, { 0x10856, 29 }, { 0x10857, 17 }, { 0x10858, 10 }, { 0x10860, 4 },
+			{ 0x10877, 21 }, { 0x10879, 10 }, { 0x10880, 4 }, { 0x1089F, 29 }, { 0x108A7, 10 }, { 0x108B0, 29 }, { 0x108E0, 4 }, { 0x108F3, 29 },
+			{ 0x108F4, 4 }, { 0x108F6, 29 }, { 0x108FB, 10 }, { 0x10900, 4 }, { 0x10916, 10 }, { 0x1091C, 29 }, { 0x1091F, 17 }, { 0x10920, 4 },
+			{ 0x1093A, 29 }, { 0x1093F, 17 }, { 0x10940, 29 }, { 0x10980, 4 }, { 0x109B8, 29 }, { 0x109BC, 10 }, { 0x109BE, 4 }, { 0x109C0, 10 },
+			{ 0x109D0, 29 }, { 0x109D2, 10 }, { 0x10A00, 4 }, { 0x10A01, 5 }, { 0x10A04, 29 }, { 0x10A05, 5 }, { 0x10A07, 29 }, { 0x10A0C, 5 },
+			{ 0x10A10, 4 }, { 0x10A14, 29 }, { 0x10A15, 4 }, { 0x10A18, 29 }, { 0x10A19, 4 }, { 0x10A36, 29 }, { 0x10A38, 5 }, { 0x10A3B, 29 },
+			{ 0x10A3F, 5 }, { 0x10A40, 10 }, { 0x10A49, 29 }, { 0x10A50, 17 }, { 0x10A59, 29 }, { 0x10A60, 4 }, { 0x10A7D, 10 }, { 0x10A7F, 17 },
+			{ 0x10A80, 4 }, { 0x10A9D, 10 }, { 0x10AA0, 29 }, { 0x10AC0, 4 }, { 0x10AC8, 21 }, { 0x10AC9, 4 }, { 0x10AE5, 5 }, { 0x10AE7, 29 },
+			{ 0x10AEB, 10 }, { 0x10AF0, 17 }, { 0x10AF7, 29 }, { 0x10B00, 4 }, { 0x10B36, 29 }, { 0x10B39, 17 }, { 0x10B40, 4 }, { 0x10B56, 29 },
+			{ 0x10B58, 10 }, { 0x10B60, 4 }, { 0x10B73, 29 }, { 0x10B78, 10 }, { 0x10B80, 4 }, { 0x10B92, 29 }, { 0x10B99, 17 }, { 0x10B9D, 29 },
+			{ 0x10BA9, 10 }, { 0x10BB0, 29 }, { 0x10C00, 4 }, { 0x10C49, 29 }, { 0x10C80, 0 }, { 0x10CB3, 29 }, { 0x10CC0, 1 }, { 0x10CF3, 29 },
+			{ 0x10CFA, 10 }, { 0x10D00, 4 }, { 0x10D24, 5 }, { 0x10D28, 29 }, { 0x10D30, 8 }, { 0x10D3A, 29 }, { 0x10E60, 10 }, { 0x10E7F, 29 },
+			{ 0x10E80, 4 }, { 0x10EAA, 29 }, { 0x10EAB, 5 }, { 0x10EAD, 12 }, { 0x10EAE, 29 }, { 0x10EB0, 4 }, { 0x10EB2, 29 }, { 0x10F00, 4 },
+			{ 0x10F1D, 10 }, { 0x10F27, 4 }, { 0x10F28, 29 }, { 0x10F30, 4 }, { 0x10F46, 5 }, { 0x10F51, 10 }, { 0x10F55, 17 }, { 0x10F5A, 29 },
+			{ 0x10F70, 4 }, { 0x10F82, 5 }, { 0x10F86, 17 }, { 0x10F8A, 29 }, { 0x10FB0, 4 }, { 0x10FC5, 10 }, { 0x10FCC, 29 }, { 0x10FE0, 4 },
+			{ 0x10FF7, 29 }, { 0x11000, 6 }, { 0x11001, 5 }, { 0x11002, 6 }, { 0x11003, 4 }, { 0x11038, 5 }, { 0x11047, 17 }, { 0x1104E, 29 },
+			{ 0x11052, 10 }, { 0x11066, 8 }, { 0x11070, 5 }, { 0x11071, 4 }, { 0x11073, 5 }, { 0x11075, 4 }, { 0x11076, 29 }, { 0x1107F, 5 },
+			{ 0x11082, 6 }, { 0x11083, 4 }, { 0x110B0, 6 }, { 0x110B3, 5 }, { 0x110B7, 6 }, { 0x110B9, 5 }, { 0x110BB, 17 }, { 0x110BD, 26 },
+			{ 0x110BE, 17 }, { 0x110C2, 5 }, { 0x110C3, 29 }, { 0x110CD, 26 }, { 0x110CE, 29 }, { 0x110D0, 4 }, { 0x110E9, 29 }, { 0x110F0, 8 },
+			{ 0x110FA, 29 }, { 0x11100, 5 }, { 0x11103, 4 }, { 0x11127, 5 }, { 0x1112C, 6 }, { 0x1112D, 5 }, { 0x11135, 29 }, { 0x11136, 8 },
+			{ 0x11140, 17 }, { 0x11144, 4 }, { 0x11145, 6 }, { 0x11147, 4 }, { 0x11148, 29 }, { 0x11150, 4 }, { 0x11173, 5 }, { 0x11174, 17 },
+			{ 0x11176, 4 }, { 0x11177, 29 }, { 0x11180, 5 }, { 0x11182, 6 }, { 0x11183, 4 }, { 0x111B3, 6 }, { 0x111B6, 5 }, { 0x111BF, 6 },
+			{ 0x111C1, 4 }, { 0x111C5, 17 }, { 0x111C9, 5 }, { 0x111CD, 17 }, { 0x111CE, 6 }, { 0x111CF, 5 }, { 0x111D0, 8 }, { 0x111DA, 4 },
+			{ 0x111DB, 17 }, { 0x111DC, 4 }, { 0x111DD, 17 }, { 0x111E0, 29 }, { 0x111E1, 10 }, { 0x111F5, 29 }, { 0x11200, 4 }, { 0x11212, 29 },
+			{ 0x11213, 4 }, { 0x1122C, 6 }, { 0x1122F, 5 }, { 0x11232, 6 }, { 0x11234, 5 }, { 0x11235, 6 }, { 0x11236, 5 }, { 0x11238, 17 },
+			{ 0x1123E, 5 }, { 0x1123F, 29 }, { 0x11280, 4 }, { 0x11287, 29 }, { 0x11288, 4 }, { 0x11289, 29 }, { 0x1128A, 4 }, { 0x1128E, 29 },
+			{ 0x1128F, 4 }, { 0x1129E, 29 }, { 0x1129F, 4 }, { 0x112A9, 17 }, { 0x112AA, 29 }, { 0x112B0, 4 }, { 0x112DF, 5 }, { 0x112E0, 6 },
+			{ 0x112E3, 5 }, { 0x112EB, 29 }, { 0x112F0, 8 }, { 0x112FA, 29 }, { 0x11300, 5 }, { 0x11302, 6 }, { 0x11304, 29 }, { 0x11305, 4 },
+			{ 0x1130D, 29 }, { 0x1130F, 4 }, { 0x11311, 29 }, { 0x11313, 4 }, { 0x11329, 29 }, { 0x1132A, 4 }, { 0x11331, 29 }, { 0x11332, 4 },
+			{ 0x11334, 29 }, { 0x11335, 4 }, { 0x1133A, 29 }, { 0x1133B, 5 }, { 0x1133D, 4 }, { 0x1133E, 6 }, { 0x11340, 5 }, { 0x11341, 6 },
+			{ 0x11345, 29 }, { 0x11347, 6 }, { 0x11349, 29 }, { 0x1134B, 6 }, { 0x1134E, 29 }, { 0x11350, 4 }, { 0x11351, 29 }, { 0x11357, 6 },
+			{ 0x11358, 29 }, { 0x1135D, 4 }, { 0x11362, 6 }, { 0x11364, 29 }, { 0x11366, 5 }, { 0x1136D, 29 }, { 0x11370, 5 }, { 0x11375, 29 },
+			{ 0x11400, 4 }, { 0x11435, 6 }, { 0x11438, 5 }, { 0x11440, 6 }, { 0x11442, 5 }, { 0x11445, 6 }, { 0x11446, 5 }, { 0x11447, 4 },
+			{ 0x1144B, 17 }, { 0x11450, 8 }, { 0x1145A, 17 }, { 0x1145C, 29 }, { 0x1145D, 17 }, { 0x1145E, 5 }, { 0x1145F, 4 }, { 0x11462, 29 },
+			{ 0x11480, 4 }, { 0x114B0, 6 }, { 0x114B3, 5 }, { 0x114B9, 6 }, { 0x114BA, 5 }, { 0x114BB, 6 }, { 0x114BF, 5 }, { 0x114C1, 6 },
+			{ 0x114C2, 5 }, { 0x114C4, 4 }, { 0x114C6, 17 }, { 0x114C7, 4 }, { 0x114C8, 29 }, { 0x114D0, 8 }, { 0x114DA, 29 }, { 0x11580, 4 },
+			{ 0x115AF, 6 }, { 0x115B2, 5 }, { 0x115B6, 29 }, { 0x115B8, 6 }, { 0x115BC, 5 }, { 0x115BE, 6 }, { 0x115BF, 5 }, { 0x115C1, 17 },
+			{ 0x115D8, 4 }, { 0x115DC, 5 }, { 0x115DE, 29 }, { 0x11600, 4 }, { 0x11630, 6 }, { 0x11633, 5 }, { 0x1163B, 6 }, { 0x1163D, 5 },
+			{ 0x1163E, 6 }, { 0x1163F, 5 }, { 0x11641, 17 }, { 0x11644, 4 }, { 0x11645, 29 }, { 0x11650, 8 }, { 0x1165A, 29 }, { 0x11660, 17 },
+			{ 0x1166D, 29 }, { 0x11680, 4 }, { 0x116AB, 5 }, { 0x116AC, 6 }, { 0x116AD, 5 }, { 0x116AE, 6 }, { 0x116B0, 5 }, { 0x116B6, 6 },
+			{ 0x116B7, 5 }, { 0x116B8, 4 }, { 0x116B9, 17 }, { 0x116BA, 29 }, { 0x116C0, 8 }, { 0x116CA, 29 }, { 0x11700, 4 }, { 0x1171B, 29 },
+			{ 0x1171D, 5 }, { 0x11720, 6 }, { 0x11722, 5 }, { 0x11726, 6 }, { 0x11727, 5 }, { 0x1172C, 29 }, { 0x11730, 8 }, { 0x1173A, 10 },
+			{ 0x1173C, 17 }, { 0x1173F, 21 }, { 0x11740, 4 }, { 0x11747, 29 }, { 0x11800, 4 }, { 0x1182C, 6 }, { 0x1182F, 5 }, { 0x11838, 6 },
+			{ 0x11839, 5 }, { 0x1183B, 17 }, { 0x1183C, 29 }, { 0x118A0, 0 }, { 0x118C0, 1 }, { 0x118E0, 8 }, { 0x118EA, 10 }, { 0x118F3, 29 },
+			{ 0x118FF, 4 }, { 0x11907, 29 }, { 0x11909, 4 }, { 0x1190A, 29 }, { 0x1190C, 4 }, { 0x11914, 29 }, { 0x11915, 4 }, { 0x11917, 29 },
+			{ 0x11918, 4 }, { 0x11930, 6 }, { 0x11936, 29 }, { 0x11937, 6 }, { 0x11939, 29 }, { 0x1193B, 5 }, { 0x1193D, 6 }, { 0x1193E, 5 },
+			{ 0x1193F, 4 }, { 0x11940, 6 }, { 0x11941, 4 }, { 0x11942, 6 }, { 0x11943, 5 }, { 0x11944, 17 }, { 0x11947, 29 }, { 0x11950, 8 },
+			{ 0x1195A, 29 }, { 0x119A0, 4 }, { 0x119A8, 29 }, { 0x119AA, 4 }, { 0x119D1, 6 }, { 0x119D4, 5 }, { 0x119D8, 29 }, { 0x119DA, 5 },
+			{ 0x119DC, 6 }, { 0x119E0, 5 }, { 0x119E1, 4 }, { 0x119E2, 17 }, { 0x119E3, 4 }, { 0x119E4, 6 }, { 0x119E5, 29 }, { 0x11A00, 4 },
+			{ 0x11A01, 5 }, { 0x11A0B, 4 }, { 0x11A33, 5 }, { 0x11A39, 6 }, { 0x11A3A, 4 }, { 0x11A3B, 5 }, { 0x11A3F, 17 }, { 0x11A47, 5 },
+			{ 0x11A48, 29 }, { 0x11A50, 4 }, { 0x11A51, 5 }, { 0x11A57, 6 }, { 0x11A59, 5 }, { 0x11A5C, 4 }, { 0x11A8A, 5 }, { 0x11A97, 6 },
+			{ 0x11A98, 5 }, { 0x11A9A, 17 }, { 0x11A9D, 4 }, { 0x11A9E, 17 }, { 0x11AA3, 29 }, { 0x11AB0, 4 }, { 0x11AF9, 29 }, { 0x11C00, 4 },
+			{ 0x11C09, 29 }, { 0x11C0A, 4 }, { 0x11C2F, 6 }, { 0x11C30, 5 }, { 0x11C37, 29 }, { 0x11C38, 5 }, { 0x11C3E, 6 }, { 0x11C3F, 5 },
+			{ 0x11C40, 4 }, { 0x11C41, 17 }, { 0x11C46, 29 }, { 0x11C50, 8 }, { 0x11C5A, 10 }, { 0x11C6D, 29 }, { 0x11C70, 17 }, { 0x11C72, 4 },
+			{ 0x11C90, 29 }, { 0x11C92, 5 }, { 0x11CA8, 29 }, { 0x11CA9, 6 }, { 0x11CAA, 5 }, { 0x11CB1, 6 }, { 0x11CB2, 5 }, { 0x11CB4, 6 },
+			{ 0x11CB5, 5 }, { 0x11CB7, 29 }, { 0x11D00, 4 }, { 0x11D07, 29 }, { 0x11D08, 4 }, { 0x11D0A, 29 }, { 0x11D0B, 4 }, { 0x11D31, 5 },
+			{ 0x11D37, 29 }, { 0x11D3A, 5 }, { 0x11D3B, 29 }, { 0x11D3C, 5 }, { 0x11D3E, 29 }, { 0x11D3F, 5 }, { 0x11D46, 4 }, { 0x11D47, 5 },
+			{ 0x11D48, 29 }, { 0x11D50, 8 }, { 0x11D5A, 29 }, { 0x11D60, 4 }, { 0x11D66, 29 }, { 0x11D67, 4 }, { 0x11D69, 29 }, { 0x11D6A, 4 },
+			{ 0x11D8A, 6 }, { 0x11D8F, 29 }, { 0x11D90, 5 }, { 0x11D92, 29 }, { 0x11D93, 6 }, { 0x11D95, 5 }, { 0x11D96, 6 }, { 0x11D97, 5 },
+			{ 0x11D98, 4 }, { 0x11D99, 29 }, { 0x11DA0, 8 }, { 0x11DAA, 29 }, { 0x11EE0, 4 }, { 0x11EF3, 5 }, { 0x11EF5, 6 }, { 0x11EF7, 17 },
+			{ 0x11EF9, 29 }, { 0x11FB0, 4 }, { 0x11FB1, 29 }, { 0x11FC0, 10 }, { 0x11FD5, 21 }, { 0x11FDD, 19 }, { 0x11FE1, 21 }, { 0x11FF2, 29 },
+			{ 0x11FFF, 17 }, { 0x12000, 4 }, { 0x1239A, 29 }, { 0x12400, 9 }, { 0x1246F, 29 }, { 0x12470, 17 }, { 0x12475, 29 }, { 0x12480, 4 },
+			{ 0x12544, 29 }, { 0x12F90, 4 }, { 0x12FF1, 17 }, { 0x12FF3, 29 }, { 0x13000, 4 }, { 0x1342F, 29 }, { 0x13430, 26 }, { 0x13439, 29 },
+			{ 0x14400, 4 }, { 0x14647, 29 }, { 0x16800, 4 }, { 0x16A39, 29 }, { 0x16A40, 4 }, { 0x16A5F, 29 }, { 0x16A60, 8 }, { 0x16A6A, 29 },
+			{ 0x16A6E, 17 }, { 0x16A70, 4 }, { 0x16ABF, 29 }, { 0x16AC0, 8 }, { 0x16ACA, 29 }, { 0x16AD0, 4 }, { 0x16AEE, 29 }, { 0x16AF0, 5 },
+			{ 0x16AF5, 17 }, { 0x16AF6, 29 }, { 0x16B00, 4 }, { 0x16B30, 5 }, { 0x16B37, 17 }, { 0x16B3C, 21 }, { 0x16B40, 3 }, { 0x16B44, 17 },
+			{ 0x16B45, 21 }, { 0x16B46, 29 }, { 0x16B50, 8 }, { 0x16B5A, 29 }, { 0x16B5B, 10 }, { 0x16B62, 29 }, { 0x16B63, 4 }, { 0x16B78, 29 },
+			{ 0x16B7D, 4 }, { 0x16B90, 29 }, { 0x16E40, 0 }, { 0x16E60, 1 }, { 0x16E80, 10 }, { 0x16E97, 17 }, { 0x16E9B, 29 }, { 0x16F00, 4 },
+			{ 0x16F4B, 29 }, { 0x16F4F, 5 }, { 0x16F50, 4 }, { 0x16F51, 6 }, { 0x16F88, 29 }, { 0x16F8F, 5 }, { 0x16F93, 3 }, { 0x16FA0, 29 },
+			{ 0x16FE0, 3 }, { 0x16FE2, 17 }, { 0x16FE3, 3 }, { 0x16FE4, 5 }, { 0x16FE5, 29 }, { 0x16FF0, 6 }, { 0x16FF2, 29 }, { 0x17000, 4 },
+			{ 0x187F8, 29 }, { 0x18800, 4 }, { 0x18CD6, 29 }, { 0x18D00, 4 }, { 0x18D09, 29 }, { 0x1AFF0, 3 }, { 0x1AFF4, 29 }, { 0x1AFF5, 3 },
+			{ 0x1AFFC, 29 }, { 0x1AFFD, 3 }, { 0x1AFFF, 29 }, { 0x1B000, 4 }, { 0x1B123, 29 }, { 0x1B150, 4 }, { 0x1B153, 29 }, { 0x1B164, 4 },
+			{ 0x1B168, 29 }, { 0x1B170, 4 }, { 0x1B2FC, 29 }, { 0x1BC00, 4 }, { 0x1BC6B, 29 }, { 0x1BC70, 4 }, { 0x1BC7D, 29 }, { 0x1BC80, 4 },
+			{ 0x1BC89, 29 }, { 0x1BC90, 4 }, { 0x1BC9A, 29 }, { 0x1BC9C, 21 }, { 0x1BC9D, 5 }, { 0x1BC9F, 17 }, { 0x1BCA0, 26 }, { 0x1BCA4, 29 },
+			{ 0x1CF00, 5 }, { 0x1CF2E, 29 }, { 0x1CF30, 5 }, { 0x1CF47, 29 }, { 0x1CF50, 21 }, { 0x1CFC4, 29 }, { 0x1D000, 21 }, { 0x1D0F6, 29 },
+			{ 0x1D100, 21 }, { 0x1D127, 29 }, { 0x1D129, 21 }, { 0x1D165, 6 }, { 0x1D167, 5 }, { 0x1D16A, 21 }, { 0x1D16D, 6 }, { 0x1D173, 26 },
+			{ 0x1D17B, 5 }, { 0x1D183, 21 }, { 0x1D185, 5 }, { 0x1D18C, 21 }, { 0x1D1AA, 5 }, { 0x1D1AE, 21 }, { 0x1D1EB, 29 }, { 0x1D200, 21 },
+			{ 0x1D242, 5 }, { 0x1D245, 21 }, { 0x1D246, 29 }, { 0x1D2E0, 10 }, { 0x1D2F4, 29 }, { 0x1D300, 21 }, { 0x1D357, 29 }, { 0x1D360, 10 },
+			{ 0x1D379, 29 }, { 0x1D400, 0 }, { 0x1D41A, 1 }, { 0x1D434, 0 }, { 0x1D44E, 1 }, { 0x1D455, 29 }, { 0x1D456, 1 }, { 0x1D468, 0 },
+			{ 0x1D482, 1 }, { 0x1D49C, 0 }, { 0x1D49D, 29 }, { 0x1D49E, 0 }, { 0x1D4A0, 29 }, { 0x1D4A2, 0 }, { 0x1D4A3, 29 }, { 0x1D4A5, 0 },
+			{ 0x1D4A7, 29 }, { 0x1D4A9, 0 }, { 0x1D4AD, 29 }, { 0x1D4AE, 0 }, { 0x1D4B6, 1 }, { 0x1D4BA, 29 }, { 0x1D4BB, 1 }, { 0x1D4BC, 29 },
+			{ 0x1D4BD, 1 }, { 0x1D4C4, 29 }, { 0x1D4C5, 1 }, { 0x1D4D0, 0 }, { 0x1D4EA, 1 }, { 0x1D504, 0 }, { 0x1D506, 29 }, { 0x1D507, 0 },
+			{ 0x1D50B, 29 }, { 0x1D50D, 0 }, { 0x1D515, 29 }, { 0x1D516, 0 }, { 0x1D51D, 29 }, { 0x1D51E, 1 }, { 0x1D538, 0 }, { 0x1D53A, 29 },
+			{ 0x1D53B, 0 }, { 0x1D53F, 29 }, { 0x1D540, 0 }, { 0x1D545, 29 }, { 0x1D546, 0 }, { 0x1D547, 29 }, { 0x1D54A, 0 }, { 0x1D551, 29 },
+			{ 0x1D552, 1 }, { 0x1D56C, 0 }, { 0x1D586, 1 }, { 0x1D5A0, 0 }, { 0x1D5BA, 1 }, { 0x1D5D4, 0 }, { 0x1D5EE, 1 }, { 0x1D608, 0 },
+			{ 0x1D622, 1 }, { 0x1D63C, 0 }, { 0x1D656, 1 }, { 0x1D670, 0 }, { 0x1D68A, 1 }, { 0x1D6A6, 29 }, { 0x1D6A8, 0 }, { 0x1D6C1, 18 },
+			{ 0x1D6C2, 1 }, { 0x1D6DB, 18 }, { 0x1D6DC, 1 }, { 0x1D6E2, 0 }, { 0x1D6FB, 18 }, { 0x1D6FC, 1 }, { 0x1D715, 18 }, { 0x1D716, 1 },
+			{ 0x1D71C, 0 }, { 0x1D735, 18 }, { 0x1D736, 1 }, { 0x1D74F, 18 }, { 0x1D750, 1 }, { 0x1D756, 0 }, { 0x1D76F, 18 }, { 0x1D770, 1 },
+			{ 0x1D789, 18 }, { 0x1D78A, 1 }, { 0x1D790, 0 }, { 0x1D7A9, 18 }, { 0x1D7AA, 1 }, { 0x1D7C3, 18 }, { 0x1D7C4, 1 }, { 0x1D7CA, 0 },
+			{ 0x1D7CB, 1 }, { 0x1D7CC, 29 }, { 0x1D7CE, 8 }, { 0x1D800, 21 }, { 0x1DA00, 5 }, { 0x1DA37, 21 }, { 0x1DA3B, 5 }, { 0x1DA6D, 21 },
+			{ 0x1DA75, 5 }, { 0x1DA76, 21 }, { 0x1DA84, 5 }, { 0x1DA85, 21 }, { 0x1DA87, 17 }, { 0x1DA8C, 29 }, { 0x1DA9B, 5 }, { 0x1DAA0, 29 },
+			{ 0x1DAA1, 5 }, { 0x1DAB0, 29 }, { 0x1DF00, 1 }, { 0x1DF0A, 4 }, { 0x1DF0B, 1 }, { 0x1DF1F, 29 }, { 0x1E000, 5 }, { 0x1E007, 29 },
+			{ 0x1E008, 5 }, { 0x1E019, 29 }, { 0x1E01B, 5 }, { 0x1E022, 29 }, { 0x1E023, 5 }, { 0x1E025, 29 }, { 0x1E026, 5 }, { 0x1E02B, 29 },
+			{ 0x1E100, 4 }, { 0x1E12D, 29 }, { 0x1E130, 5 }, { 0x1E137, 3 }, { 0x1E13E, 29 }, { 0x1E140, 8 }, { 0x1E14A, 29 }, { 0x1E14E, 4 },
+			{ 0x1E14F, 21 }, { 0x1E150, 29 }, { 0x1E290, 4 }, { 0x1E2AE, 5 }, { 0x1E2AF, 29 }, { 0x1E2C0, 4 }, { 0x1E2EC, 5 }, { 0x1E2F0, 8 },
+			{ 0x1E2FA, 29 }, { 0x1E2FF, 19 }, { 0x1E300, 29 }, { 0x1E7E0, 4 }, { 0x1E7E7, 29 }, { 0x1E7E8, 4 }, { 0x1E7EC, 29 }, { 0x1E7ED, 4 },
+			{ 0x1E7EF, 29 }, { 0x1E7F0, 4 }, { 0x1E7FF, 29 }, { 0x1E800, 4 }, { 0x1E8C5, 29 }, { 0x1E8C7, 10 }, { 0x1E8D0, 5 }, { 0x1E8D7, 29 },
+			{ 0x1E900, 0 }, { 0x1E922, 1 }, { 0x1E944, 5 }, { 0x1E94B, 3 }, { 0x1E94C, 29 }, { 0x1E950, 8 }, { 0x1E95A, 29 }, { 0x1E95E, 17 },
+			{ 0x1E960, 29 }, { 0x1EC71, 10 }, { 0x1ECAC, 21 }, { 0x1ECAD, 10 }, { 0x1ECB0, 19 }, { 0x1ECB1, 10 }, { 0x1ECB5, 29 }, { 0x1ED01, 10 },
+			{ 0x1ED2E, 21 }, { 0x1ED2F, 10 }, { 0x1ED3E, 29 }, { 0x1EE00, 4 }, { 0x1EE04, 29 }, { 0x1EE05, 4 }, { 0x1EE20, 29 }, { 0x1EE21, 4 },
+			{ 0x1EE23, 29 }, { 0x1EE24, 4 }, { 0x1EE25, 29 }, { 0x1EE27, 4 }, { 0x1EE28, 29 }, { 0x1EE29, 4 }, { 0x1EE33, 29 }, { 0x1EE34, 4 },
+			{ 0x1EE38, 29 }, { 0x1EE39, 4 }, { 0x1EE3A, 29 }, { 0x1EE3B, 4 }, { 0x1EE3C, 29 }, { 0x1EE42, 4 }, { 0x1EE43, 29 }, { 0x1EE47, 4 },
+			{ 0x1EE48, 29 }, { 0x1EE49, 4 }, { 0x1EE4A, 29 }, { 0x1EE4B, 4 }, { 0x1EE4C, 29 }, { 0x1EE4D, 4 }, { 0x1EE50, 29 }, { 0x1EE51, 4 },
+			{ 0x1EE53, 29 }, { 0x1EE54, 4 }, { 0x1EE55, 29 }, { 0x1EE57, 4 }, { 0x1EE58, 29 }, { 0x1EE59, 4 }, { 0x1EE5A, 29 }, { 0x1EE5B, 4 },
+			{ 0x1EE5C, 29 }, { 0x1EE5D, 4 }, { 0x1EE5E, 29 }, { 0x1EE5F, 4 }, { 0x1EE60, 29 }, { 0x1EE61, 4 }, { 0x1EE63, 29 }, { 0x1EE64, 4 },
+			{ 0x1EE65, 29 }, { 0x1EE67, 4 }, { 0x1EE6B, 29 }, { 0x1EE6C, 4 }, { 0x1EE73, 29 }, { 0x1EE74, 4 }, { 0x1EE78, 29 }, { 0x1EE79, 4 },
+			{ 0x1EE7D, 29 }, { 0x1EE7E, 4 }, { 0x1EE7F, 29 }, { 0x1EE80, 4 }, { 0x1EE8A, 29 }, { 0x1EE8B, 4 }, { 0x1EE9C, 29 }, { 0x1EEA1, 4 },
+			{ 0x1EEA4, 29 }, { 0x1EEA5, 4 }, { 0x1EEAA, 29 }, { 0x1EEAB, 4 }, { 0x1EEBC, 29 }, { 0x1EEF0, 18 }, { 0x1EEF2, 29 }, { 0x1F000, 21 },
+			{ 0x1F02C, 29 }, { 0x1F030, 21 }, { 0x1F094, 29 }, { 0x1F0A0, 21 }, { 0x1F0AF, 29 }, { 0x1F0B1, 21 }, { 0x1F0C0, 29 }, { 0x1F0C1, 21 },
+			{ 0x1F0D0, 29 }, { 0x1F0D1, 21 }, { 0x1F0F6, 29 }, { 0x1F100, 10 }, { 0x1F10D, 21 }, { 0x1F1AE, 29 }, { 0x1F1E6, 21 }, { 0x1F203, 29 },
+			{ 0x1F210, 21 }, { 0x1F23C, 29 }, { 0x1F240, 21 }, { 0x1F249, 29 }, { 0x1F250, 21 }, { 0x1F252, 29 }, { 0x1F260, 21 }, { 0x1F266, 29 },
+			{ 0x1F300, 21 }, { 0x1F3FB, 20 }, { 0x1F400, 21 }, { 0x1F6D8, 29 }, { 0x1F6DD, 21 }, { 0x1F6ED, 29 }, { 0x1F6F0, 21 }, { 0x1F6FD, 29 },
+			{ 0x1F700, 21 }, { 0x1F774, 29 }, { 0x1F780, 21 }, { 0x1F7D9, 29 }, { 0x1F7E0, 21 }, { 0x1F7EC, 29 }, { 0x1F7F0, 21 }, { 0x1F7F1, 29 },
+			{ 0x1F800, 21 }, { 0x1F80C, 29 }, { 0x1F810, 21 }, { 0x1F848, 29 }, { 0x1F850, 21 }, { 0x1F85A, 29 }, { 0x1F860, 21 }, { 0x1F888, 29 },
+			{ 0x1F890, 21 }, { 0x1F8AE, 29 }, { 0x1F8B0, 21 }, { 0x1F8B2, 29 }, { 0x1F900, 21 }, { 0x1FA54, 29 }, { 0x1FA60, 21 }, { 0x1FA6E, 29 },
+			{ 0x1FA70, 21 }, { 0x1FA75, 29 }, { 0x1FA78, 21 }, { 0x1FA7D, 29 }, { 0x1FA80, 21 }, { 0x1FA87, 29 }, { 0x1FA90, 21 }, { 0x1FAAD, 29 },
+			{ 0x1FAB0, 21 }, { 0x1FABB, 29 }, { 0x1FAC0, 21 }, { 0x1FAC6, 29 }, { 0x1FAD0, 21 }, { 0x1FADA, 29 }, { 0x1FAE0, 21 }, { 0x1FAE8, 29 },
+			{ 0x1FAF0, 21 }, { 0x1FAF7, 29 }, { 0x1FB00, 21 }, { 0x1FB93, 29 }, { 0x1FB94, 21 }, { 0x1FBCB, 29 }, { 0x1FBF0, 8 }, { 0x1FBFA, 29 },
+			{ 0x20000, 4 }, { 0x2A6E0, 29 }, { 0x2A700, 4 }, { 0x2B739, 29 }, { 0x2B740, 4 }, { 0x2B81E, 29 }, { 0x2B820, 4 }, { 0x2CEA2, 29 },
+			{ 0x2CEB0, 4 }, { 0x2EBE1, 29 }, { 0x2F800, 4 }, { 0x2FA1E, 29 }, { 0x30000, 4 }, { 0x3134B, 29 }, { 0xE0001, 26 }, { 0xE0002, 29 },
+			{ 0xE0020, 26 }, { 0xE0080, 29 }, { 0xE0100, 5 }, { 0xE01F0, 29 }, { 0xF0000, 28 }, { 0xFFFFE, 29 }, { 0x100000, 28 }, { 0x10FFFE, 29 }
+		};
+
+		static const UnicodeRange scriptRanges[] =
+		{
+			{ 0x0000, 1 }, { 0x0041, 70 }, { 0x005B, 1 }, { 0x0061, 70 }, { 0x007B, 1 }, { 0x00AA, 70 }, { 0x00AB, 1 }, { 0x00BA, 70 },
+			{ 0x00BB, 1 }, { 0x00C0, 70 }, { 0x00D7, 1 }, { 0x00D8, 70 }, { 0x00F7, 1 }, { 0x00F8, 70 }, { 0x02B9, 1 }, { 0x02E0, 70 },
+			{ 0x02E5, 1 }, { 0x02EA, 15 }, { 0x02EC, 1 }, { 0x0300, 2 }, { 0x0370, 45 }, { 0x0374, 1 }, { 0x0375, 45 }, { 0x0378, 0 },
+			{ 0x037A, 45 }, { 0x037E, 1 }, { 0x037F, 45 }, { 0x0380, 0 }, { 0x0384, 45 }, { 0x0385, 1 }, { 0x0386, 45 }, { 0x0387, 1 },
+			{ 0x0388, 45 }, { 0x038B, 0 }, { 0x038C, 45 }, { 0x038D, 0 }, { 0x038E, 45 }, { 0x03A2, 0 }, { 0x03A3, 45 }, { 0x03E2, 27 },
+			{ 0x03F0, 45 }, { 0x0400, 31 }, { 0x0485, 2 }, { 0x0487, 31 }, { 0x0530, 0 }, { 0x0531, 7 }, { 0x0557, 0 }, { 0x0559, 7 },
+			{ 0x058B, 0 }, { 0x058D, 7 }, { 0x0590, 0 }, { 0x0591, 54 }, { 0x05C8, 0 }, { 0x05D0, 54 }, { 0x05EB, 0 }, { 0x05EF, 54 },
+			{ 0x05F5, 0 }, { 0x0600, 6 }, { 0x0605, 1 }, { 0x0606, 6 }, { 0x060C, 1 }, { 0x060D, 6 }, { 0x061B, 1 }, { 0x061C, 6 },
+			{ 0x061F, 1 }, { 0x0620, 6 }, { 0x0640, 1 }, { 0x0641, 6 }, { 0x064B, 2 }, { 0x0656, 6 }, { 0x0670, 2 }, { 0x0671, 6 },
+			{ 0x06DD, 1 }, { 0x06DE, 6 }, { 0x0700, 137 }, { 0x070E, 0 }, { 0x070F, 137 }, { 0x074B, 0 }, { 0x074D, 137 }, { 0x0750, 6 },
+			{ 0x0780, 148 }, { 0x07B2, 0 }, { 0x07C0, 100 }, { 0x07FB, 0 }, { 0x07FD, 100 }, { 0x0800, 125 }, { 0x082E, 0 }, { 0x0830, 125 },
+			{ 0x083F, 0 }, { 0x0840, 81 }, { 0x085C, 0 }, { 0x085E, 81 }, { 0x085F, 0 }, { 0x0860, 137 }, { 0x086B, 0 }, { 0x0870, 6 },
+			{ 0x088F, 0 }, { 0x0890, 6 }, { 0x0892, 0 }, { 0x0898, 6 }, { 0x08E2, 1 }, { 0x08E3, 6 }, { 0x0900, 33 }, { 0x0951, 2 },
+			{ 0x0955, 33 }, { 0x0964, 1 }, { 0x0966, 33 }, { 0x0980, 13 }, { 0x0984, 0 }, { 0x0985, 13 }, { 0x098D, 0 }, { 0x098F, 13 },
+			{ 0x0991, 0 }, { 0x0993, 13 }, { 0x09A9, 0 }, { 0x09AA, 13 }, { 0x09B1, 0 }, { 0x09B2, 13 }, { 0x09B3, 0 }, { 0x09B6, 13 },
+			{ 0x09BA, 0 }, { 0x09BC, 13 }, { 0x09C5, 0 }, { 0x09C7, 13 }, { 0x09C9, 0 }, { 0x09CB, 13 }, { 0x09CF, 0 }, { 0x09D7, 13 },
+			{ 0x09D8, 0 }, { 0x09DC, 13 }, { 0x09DE, 0 }, { 0x09DF, 13 }, { 0x09E4, 0 }, { 0x09E6, 13 }, { 0x09FF, 0 }, { 0x0A01, 48 },
+			{ 0x0A04, 0 }, { 0x0A05, 48 }, { 0x0A0B, 0 }, { 0x0A0F, 48 }, { 0x0A11, 0 }, { 0x0A13, 48 }, { 0x0A29, 0 }, { 0x0A2A, 48 },
+			{ 0x0A31, 0 }, { 0x0A32, 48 }, { 0x0A34, 0 }, { 0x0A35, 48 }, { 0x0A37, 0 }, { 0x0A38, 48 }, { 0x0A3A, 0 }, { 0x0A3C, 48 },
+			{ 0x0A3D, 0 }, { 0x0A3E, 48 }, { 0x0A43, 0 }, { 0x0A47, 48 }, { 0x0A49, 0 }, { 0x0A4B, 48 }, { 0x0A4E, 0 }, { 0x0A51, 48 },
+			{ 0x0A52, 0 }, { 0x0A59, 48 }, { 0x0A5D, 0 }, { 0x0A5E, 48 }, { 0x0A5F, 0 }, { 0x0A66, 48 }, { 0x0A77, 0 }, { 0x0A81, 46 },
+			{ 0x0A84, 0 }, { 0x0A85, 46 }, { 0x0A8E, 0 }, { 0x0A8F, 46 }, { 0x0A92, 0 }, { 0x0A93, 46 }, { 0x0AA9, 0 }, { 0x0AAA, 46 },
+			{ 0x0AB1, 0 }, { 0x0AB2, 46 }, { 0x0AB4, 0 }, { 0x0AB5, 46 }, { 0x0ABA, 0 }, { 0x0ABC, 46 }, { 0x0AC6, 0 }, { 0x0AC7, 46 },
+			{ 0x0ACA, 0 }, { 0x0ACB, 46 }, { 0x0ACE, 0 }, { 0x0AD0, 46 }, { 0x0AD1, 0 }, { 0x0AE0, 46 }, { 0x0AE4, 0 }, { 0x0AE6, 46 },
+			{ 0x0AF2, 0 }, { 0x0AF9, 46 }, { 0x0B00, 0 }, { 0x0B01, 114 }, { 0x0B04, 0 }, { 0x0B05, 114 }, { 0x0B0D, 0 }, { 0x0B0F, 114 },
+			{ 0x0B11, 0 }, { 0x0B13, 114 }, { 0x0B29, 0 }, { 0x0B2A, 114 }, { 0x0B31, 0 }, { 0x0B32, 114 }, { 0x0B34, 0 }, { 0x0B35, 114 },
+			{ 0x0B3A, 0 }, { 0x0B3C, 114 }, { 0x0B45, 0 }, { 0x0B47, 114 }, { 0x0B49, 0 }, { 0x0B4B, 114 }, { 0x0B4E, 0 }, { 0x0B55, 114 },
+			{ 0x0B58, 0 }, { 0x0B5C, 114 }, { 0x0B5E, 0 }, { 0x0B5F, 114 }, { 0x0B64, 0 }, { 0x0B66, 114 }, { 0x0B78, 0 }, { 0x0B82, 144 },
+			{ 0x0B84, 0 }, { 0x0B85, 144 }, { 0x0B8B, 0 }, { 0x0B8E, 144 }, { 0x0B91, 0 }, { 0x0B92, 144 }, { 0x0B96, 0 }, { 0x0B99, 144 },
+			{ 0x0B9B, 0 }, { 0x0B9C, 144 }, { 0x0B9D, 0 }, { 0x0B9E, 144 }, { 0x0BA0, 0 }, { 0x0BA3, 144 }, { 0x0BA5, 0 }, { 0x0BA8, 144 },
+			{ 0x0BAB, 0 }, { 0x0BAE, 144 }, { 0x0BBA, 0 }, { 0x0BBE, 144 }, { 0x0BC3, 0 }, { 0x0BC6, 144 }, { 0x0BC9, 0 }, { 0x0BCA, 144 },
+			{ 0x0BCE, 0 }, { 0x0BD0, 144 }, { 0x0BD1, 0 }, { 0x0BD7, 144 }, { 0x0BD8, 0 }, { 0x0BE6, 144 }, { 0x0BFB, 0 }, { 0x0C00, 147 },
+			{ 0x0C0D, 0 }, { 0x0C0E, 147 }, { 0x0C11, 0 }, { 0x0C12, 147 }, { 0x0C29, 0 }, { 0x0C2A, 147 }, { 0x0C3A, 0 }, { 0x0C3C, 147 },
+			{ 0x0C45, 0 }, { 0x0C46, 147 }, { 0x0C49, 0 }, { 0x0C4A, 147 }, { 0x0C4E, 0 }, { 0x0C55, 147 }, { 0x0C57, 0 }, { 0x0C58, 147 },
+			{ 0x0C5B, 0 }, { 0x0C5D, 147 }, { 0x0C5E, 0 }, { 0x0C60, 147 }, { 0x0C64, 0 }, { 0x0C66, 147 }, { 0x0C70, 0 }, { 0x0C77, 147 },
+			{ 0x0C80, 61 }, { 0x0C8D, 0 }, { 0x0C8E, 61 }, { 0x0C91, 0 }, { 0x0C92, 61 }, { 0x0CA9, 0 }, { 0x0CAA, 61 }, { 0x0CB4, 0 },
+			{ 0x0CB5, 61 }, { 0x0CBA, 0 }, { 0x0CBC, 61 }, { 0x0CC5, 0 }, { 0x0CC6, 61 }, { 0x0CC9, 0 }, { 0x0CCA, 61 }, { 0x0CCE, 0 },
+			{ 0x0CD5, 61 }, { 0x0CD7, 0 }, { 0x0CDD, 61 }, { 0x0CDF, 0 }, { 0x0CE0, 61 }, { 0x0CE4, 0 }, { 0x0CE6, 61 }, { 0x0CF0, 0 },
+			{ 0x0CF1, 61 }, { 0x0CF3, 0 }, { 0x0D00, 80 }, { 0x0D0D, 0 }, { 0x0D0E, 80 }, { 0x0D11, 0 }, { 0x0D12, 80 }, { 0x0D45, 0 },
+			{ 0x0D46, 80 }, { 0x0D49, 0 }, { 0x0D4A, 80 }, { 0x0D50, 0 }, { 0x0D54, 80 }, { 0x0D64, 0 }, { 0x0D66, 80 }, { 0x0D80, 0 },
+			{ 0x0D81, 131 }, { 0x0D84, 0 }, { 0x0D85, 131 }, { 0x0D97, 0 }, { 0x0D9A, 131 }, { 0x0DB2, 0 }, { 0x0DB3, 131 }, { 0x0DBC, 0 },
+			{ 0x0DBD, 131 }, { 0x0DBE, 0 }, { 0x0DC0, 131 }, { 0x0DC7, 0 }, { 0x0DCA, 131 }, { 0x0DCB, 0 }, { 0x0DCF, 131 }, { 0x0DD5, 0 },
+			{ 0x0DD6, 131 }, { 0x0DD7, 0 }, { 0x0DD8, 131 }, { 0x0DE0, 0 }, { 0x0DE6, 131 }, { 0x0DF0, 0 }, { 0x0DF2, 131 }, { 0x0DF5, 0 },
+			{ 0x0E01, 149 }, { 0x0E3B, 0 }, { 0x0E3F, 1 }, { 0x0E40, 149 }, { 0x0E5C, 0 }, { 0x0E81, 69 }, { 0x0E83, 0 }, { 0x0E84, 69 },
+			{ 0x0E85, 0 }, { 0x0E86, 69 }, { 0x0E8B, 0 }, { 0x0E8C, 69 }, { 0x0EA4, 0 }, { 0x0EA5, 69 }, { 0x0EA6, 0 }, { 0x0EA7, 69 },
+			{ 0x0EBE, 0 }, { 0x0EC0, 69 }, { 0x0EC5, 0 }, { 0x0EC6, 69 }, { 0x0EC7, 0 }, { 0x0EC8, 69 }, { 0x0ECE, 0 }, { 0x0ED0, 69 },
+			{ 0x0EDA, 0 }, { 0x0EDC, 69 }, { 0x0EE0, 0 }, { 0x0F00, 150 }, { 0x0F48, 0 }, { 0x0F49, 150 }, { 0x0F6D, 0 }, { 0x0F71, 150 },
+			{ 0x0F98, 0 }, { 0x0F99, 150 }, { 0x0FBD, 0 }, { 0x0FBE, 150 }, { 0x0FCD, 0 }, { 0x0FCE, 150 }, { 0x0FD5, 1 }, { 0x0FD9, 150 },
+			{ 0x0FDB, 0 }, { 0x1000, 95 }, { 0x10A0, 41 }, { 0x10C6, 0 }, { 0x10C7, 41 }, { 0x10C8, 0 }, { 0x10CD, 41 }, { 0x10CE, 0 },
+			{ 0x10D0, 41 }, { 0x10FB, 1 }, { 0x10FC, 41 }, { 0x1100, 50 }, { 0x1200, 40 }, { 0x1249, 0 }, { 0x124A, 40 }, { 0x124E, 0 },
+			{ 0x1250, 40 }, { 0x1257, 0 }, { 0x1258, 40 }, { 0x1259, 0 }, { 0x125A, 40 }, { 0x125E, 0 }, { 0x1260, 40 }, { 0x1289, 0 },
+			{ 0x128A, 40 }, { 0x128E, 0 }, { 0x1290, 40 }, { 0x12B1, 0 }, { 0x12B2, 40 }, { 0x12B6, 0 }, { 0x12B8, 40 }, { 0x12BF, 0 },
+			{ 0x12C0, 40 }, { 0x12C1, 0 }, { 0x12C2, 40 }, { 0x12C6, 0 }, { 0x12C8, 40 }, { 0x12D7, 0 }, { 0x12D8, 40 }, { 0x1311, 0 },
+			{ 0x1312, 40 }, { 0x1316, 0 }, { 0x1318, 40 }, { 0x135B, 0 }, { 0x135D, 40 }, { 0x137D, 0 }, { 0x1380, 40 }, { 0x139A, 0 },
+			{ 0x13A0, 25 }, { 0x13F6, 0 }, { 0x13F8, 25 }, { 0x13FE, 0 }, { 0x1400, 20 }, { 0x1680, 103 }, { 0x169D, 0 }, { 0x16A0, 124 },
+			{ 0x16EB, 1 }, { 0x16EE, 124 }, { 0x16F9, 0 }, { 0x1700, 138 }, { 0x1716, 0 }, { 0x171F, 138 }, { 0x1720, 52 }, { 0x1735, 1 },
+			{ 0x1737, 0 }, { 0x1740, 19 }, { 0x1754, 0 }, { 0x1760, 139 }, { 0x176D, 0 }, { 0x176E, 139 }, { 0x1771, 0 }, { 0x1772, 139 },
+			{ 0x1774, 0 }, { 0x1780, 66 }, { 0x17DE, 0 }, { 0x17E0, 66 }, { 0x17EA, 0 }, { 0x17F0, 66 }, { 0x17FA, 0 }, { 0x1800, 92 },
+			{ 0x1802, 1 }, { 0x1804, 92 }, { 0x1805, 1 }, { 0x1806, 92 }, { 0x181A, 0 }, { 0x1820, 92 }, { 0x1879, 0 }, { 0x1880, 92 },
+			{ 0x18AB, 0 }, { 0x18B0, 20 }, { 0x18F6, 0 }, { 0x1900, 72 }, { 0x191F, 0 }, { 0x1920, 72 }, { 0x192C, 0 }, { 0x1930, 72 },
+			{ 0x193C, 0 }, { 0x1940, 72 }, { 0x1941, 0 }, { 0x1944, 72 }, { 0x1950, 140 }, { 0x196E, 0 }, { 0x1970, 140 }, { 0x1975, 0 },
+			{ 0x1980, 98 }, { 0x19AC, 0 }, { 0x19B0, 98 }, { 0x19CA, 0 }, { 0x19D0, 98 }, { 0x19DB, 0 }, { 0x19DE, 98 }, { 0x19E0, 66 },
+			{ 0x1A00, 18 }, { 0x1A1C, 0 }, { 0x1A1E, 18 }, { 0x1A20, 141 }, { 0x1A5F, 0 }, { 0x1A60, 141 }, { 0x1A7D, 0 }, { 0x1A7F, 141 },
+			{ 0x1A8A, 0 }, { 0x1A90, 141 }, { 0x1A9A, 0 }, { 0x1AA0, 141 }, { 0x1AAE, 0 }, { 0x1AB0, 2 }, { 0x1ACF, 0 }, { 0x1B00, 9 },
+			{ 0x1B4D, 0 }, { 0x1B50, 9 }, { 0x1B7F, 0 }, { 0x1B80, 135 }, { 0x1BC0, 12 }, { 0x1BF4, 0 }, { 0x1BFC, 12 }, { 0x1C00, 71 },
+			{ 0x1C38, 0 }, { 0x1C3B, 71 }, { 0x1C4A, 0 }, { 0x1C4D, 71 }, { 0x1C50, 104 }, { 0x1C80, 31 }, { 0x1C89, 0 }, { 0x1C90, 41 },
+			{ 0x1CBB, 0 }, { 0x1CBD, 41 }, { 0x1CC0, 135 }, { 0x1CC8, 0 }, { 0x1CD0, 2 }, { 0x1CD3, 1 }, { 0x1CD4, 2 }, { 0x1CE1, 1 },
+			{ 0x1CE2, 2 }, { 0x1CE9, 1 }, { 0x1CED, 2 }, { 0x1CEE, 1 }, { 0x1CF4, 2 }, { 0x1CF5, 1 }, { 0x1CF8, 2 }, { 0x1CFA, 1 },
+			{ 0x1CFB, 0 }, { 0x1D00, 70 }, { 0x1D26, 45 }, { 0x1D2B, 31 }, { 0x1D2C, 70 }, { 0x1D5D, 45 }, { 0x1D62, 70 }, { 0x1D66, 45 },
+			{ 0x1D6B, 70 }, { 0x1D78, 31 }, { 0x1D79, 70 }, { 0x1DBF, 45 }, { 0x1DC0, 2 }, { 0x1E00, 70 }, { 0x1F00, 45 }, { 0x1F16, 0 },
+			{ 0x1F18, 45 }, { 0x1F1E, 0 }, { 0x1F20, 45 }, { 0x1F46, 0 }, { 0x1F48, 45 }, { 0x1F4E, 0 }, { 0x1F50, 45 }, { 0x1F58, 0 },
+			{ 0x1F59, 45 }, { 0x1F5A, 0 }, { 0x1F5B, 45 }, { 0x1F5C, 0 }, { 0x1F5D, 45 }, { 0x1F5E, 0 }, { 0x1F5F, 45 }, { 0x1F7E, 0 },
+			{ 0x1F80, 45 }, { 0x1FB5, 0 }, { 0x1FB6, 45 }, { 0x1FC5, 0 }, { 0x1FC6, 45 }, { 0x1FD4, 0 }, { 0x1FD6, 45 }, { 0x1FDC, 0 },
+			{ 0x1FDD, 45 }, { 0x1FF0, 0 }, { 0x1FF2, 45 }, { 0x1FF5, 0 }, { 0x1FF6, 45 }, { 0x1FFF, 0 }, { 0x2000, 1 }, { 0x200C, 2 },
+			{ 0x200E, 1 }, { 0x2065, 0 }, { 0x2066, 1 }, { 0x2071, 70 }, { 0x2072, 0 }, { 0x2074, 1 }, { 0x207F, 70 }, { 0x2080, 1 },
+			{ 0x208F, 0 }, { 0x2090, 70 }, { 0x209D, 0 }, { 0x20A0, 1 }, { 0x20C1, 0 }, { 0x20D0, 2 }, { 0x20F1, 0 }, { 0x2100, 1 },
+			{ 0x2126, 45 }, { 0x2127, 1 }, { 0x212A, 70 }, { 0x212C, 1 }, { 0x2132, 70 }, { 0x2133, 1 }, { 0x214E, 70 }, { 0x214F, 1 },
+			{ 0x2160, 70 }, { 0x2189, 1 }, { 0x218C, 0 }, { 0x2190, 1 }, { 0x2427, 0 }, { 0x2440, 1 }, { 0x244B, 0 }, { 0x2460, 1 },
+			{ 0x2800, 17 }, { 0x2900, 1 }, { 0x2B74, 0 }, { 0x2B76, 1 }, { 0x2B96, 0 }, { 0x2B97, 1 }, { 0x2C00, 42 }, { 0x2C60, 70 },
+			{ 0x2C80, 27 }, { 0x2CF4, 0 }, { 0x2CF9, 27 }, { 0x2D00, 41 }, { 0x2D26, 0 }, { 0x2D27, 41 }, { 0x2D28, 0 }, { 0x2D2D, 41 },
+			{ 0x2D2E, 0 }, { 0x2D30, 151 }, { 0x2D68, 0 }, { 0x2D6F, 151 }, { 0x2D71, 0 }, { 0x2D7F, 151 }, { 0x2D80, 40 }, { 0x2D97, 0 },
+			{ 0x2DA0, 40 }, { 0x2DA7, 0 }, { 0x2DA8, 40 }, { 0x2DAF, 0 }, { 0x2DB0, 40 }, { 0x2DB7, 0 }, { 0x2DB8, 40 }, { 0x2DBF, 0 },
+			{ 0x2DC0, 40 }, { 0x2DC7, 0 }, { 0x2DC8, 40 }, { 0x2DCF, 0 }, { 0x2DD0, 40 }, { 0x2DD7, 0 }, { 0x2DD8, 40 }, { 0x2DDF, 0 },
+			{ 0x2DE0, 31 }, { 0x2E00, 1 }, { 0x2E5E, 0 }, { 0x2E80, 49 }, { 0x2E9A, 0 }, { 0x2E9B, 49 }, { 0x2EF4, 0 }, { 0x2F00, 49 },
+			{ 0x2FD6, 0 }, { 0x2FF0, 1 }, { 0x2FFC, 0 }, { 0x3000, 1 }, { 0x3005, 49 }, { 0x3006, 1 }, { 0x3007, 49 }, { 0x3008, 1 },
+			{ 0x3021, 49 }, { 0x302A, 2 }, { 0x302E, 50 }, { 0x3030, 1 }, { 0x3038, 49 }, { 0x303C, 1 }, { 0x3040, 0 }, { 0x3041, 55 },
+			{ 0x3097, 0 }, { 0x3099, 2 }, { 0x309B, 1 }, { 0x309D, 55 }, { 0x30A0, 1 }, { 0x30A1, 62 }, { 0x30FB, 1 }, { 0x30FD, 62 },
+			{ 0x3100, 0 }, { 0x3105, 15 }, { 0x3130, 0 }, { 0x3131, 50 }, { 0x318F, 0 }, { 0x3190, 1 }, { 0x31A0, 15 }, { 0x31C0, 1 },
+			{ 0x31E4, 0 }, { 0x31F0, 62 }, { 0x3200, 50 }, { 0x321F, 0 }, { 0x3220, 1 }, { 0x3260, 50 }, { 0x327F, 1 }, { 0x32D0, 62 },
+			{ 0x32FF, 1 }, { 0x3300, 62 }, { 0x3358, 1 }, { 0x3400, 49 }, { 0x4DC0, 1 }, { 0x4E00, 49 }, { 0xA000, 160 }, { 0xA48D, 0 },
+			{ 0xA490, 160 }, { 0xA4C7, 0 }, { 0xA4D0, 75 }, { 0xA500, 155 }, { 0xA62C, 0 }, { 0xA640, 31 }, { 0xA6A0, 10 }, { 0xA6F8, 0 },
+			{ 0xA700, 1 }, { 0xA722, 70 }, { 0xA788, 1 }, { 0xA78B, 70 }, { 0xA7CB, 0 }, { 0xA7D0, 70 }, { 0xA7D2, 0 }, { 0xA7D3, 70 },
+			{ 0xA7D4, 0 }, { 0xA7D5, 70 }, { 0xA7DA, 0 }, { 0xA7F2, 70 }, { 0xA800, 136 }, { 0xA82D, 0 }, { 0xA830, 1 }, { 0xA83A, 0 },
+			{ 0xA840, 120 }, { 0xA878, 0 }, { 0xA880, 126 }, { 0xA8C6, 0 }, { 0xA8CE, 126 }, { 0xA8DA, 0 }, { 0xA8E0, 33 }, { 0xA900, 63 },
+			{ 0xA92E, 1 }, { 0xA92F, 63 }, { 0xA930, 123 }, { 0xA954, 0 }, { 0xA95F, 123 }, { 0xA960, 50 }, { 0xA97D, 0 }, { 0xA980, 59 },
+			{ 0xA9CE, 0 }, { 0xA9CF, 1 }, { 0xA9D0, 59 }, { 0xA9DA, 0 }, { 0xA9DE, 59 }, { 0xA9E0, 95 }, { 0xA9FF, 0 }, { 0xAA00, 24 },
+			{ 0xAA37, 0 }, { 0xAA40, 24 }, { 0xAA4E, 0 }, { 0xAA50, 24 }, { 0xAA5A, 0 }, { 0xAA5C, 24 }, { 0xAA60, 95 }, { 0xAA80, 142 },
+			{ 0xAAC3, 0 }, { 0xAADB, 142 }, { 0xAAE0, 86 }, { 0xAAF7, 0 }, { 0xAB01, 40 }, { 0xAB07, 0 }, { 0xAB09, 40 }, { 0xAB0F, 0 },
+			{ 0xAB11, 40 }, { 0xAB17, 0 }, { 0xAB20, 40 }, { 0xAB27, 0 }, { 0xAB28, 40 }, { 0xAB2F, 0 }, { 0xAB30, 70 }, { 0xAB5B, 1 },
+			{ 0xAB5C, 70 }, { 0xAB65, 45 }, { 0xAB66, 70 }, { 0xAB6A, 1 }, { 0xAB6C, 0 }, { 0xAB70, 25 }, { 0xABC0, 86 }, { 0xABEE, 0 },
+			{ 0xABF0, 86 }, { 0xABFA, 0 }, { 0xAC00, 50 }, { 0xD7A4, 0 }, { 0xD7B0, 50 }, { 0xD7C7, 0 }, { 0xD7CB, 50 }, { 0xD7FC, 0 },
+			{ 0xF900, 49 }, { 0xFA6E, 0 }, { 0xFA70, 49 }, { 0xFADA, 0 }, { 0xFB00, 70 }, { 0xFB07, 0 }, { 0xFB13, 7 }, { 0xFB18, 0 },
+			{ 0xFB1D, 54 }, { 0xFB37, 0 }, { 0xFB38, 54 }, { 0xFB3D, 0 }, { 0xFB3E, 54 }, { 0xFB3F, 0 }, { 0xFB40, 54 }, { 0xFB42, 0 },
+			{ 0xFB43, 54 }, { 0xFB45, 0 }, { 0xFB46, 54 }, { 0xFB50, 6 }, { 0xFBC3, 0 }, { 0xFBD3, 6 }, { 0xFD3E, 1 }, { 0xFD40, 6 },
+			{ 0xFD90, 0 }, { 0xFD92, 6 }, { 0xFDC8, 0 }, { 0xFDCF, 6 }, { 0xFDD0, 0 }, { 0xFDF0, 6 }, { 0xFE00, 2 }, { 0xFE10, 1 },
+			{ 0xFE1A, 0 }, { 0xFE20, 2 }, { 0xFE2E, 31 }, { 0xFE30, 1 }, { 0xFE53, 0 }, { 0xFE54, 1 }, { 0xFE67, 0 }, { 0xFE68, 1 },
+			{ 0xFE6C, 0 }, { 0xFE70, 6 }, { 0xFE75, 0 }, { 0xFE76, 6 }, { 0xFEFD, 0 }, { 0xFEFF, 1 }, { 0xFF00, 0 }, { 0xFF01, 1 },
+			{ 0xFF21, 70 }, { 0xFF3B, 1 }, { 0xFF41, 70 }, { 0xFF5B, 1 }, { 0xFF66, 62 }, { 0xFF70, 1 }, { 0xFF71, 62 }, { 0xFF9E, 1 },
+			{ 0xFFA0, 50 }, { 0xFFBF, 0 }, { 0xFFC2, 50 }, { 0xFFC8, 0 }, { 0xFFCA, 50 }, { 0xFFD0, 0 }, { 0xFFD2, 50 }, { 0xFFD8, 0 },
+			{ 0xFFDA, 50 }, { 0xFFDD, 0 }, { 0xFFE0, 1 }, { 0xFFE7, 0 }, { 0xFFE8, 1 }, { 0xFFEF, 0 }, { 0xFFF9, 1 }, { 0xFFFE, 0 },
+			{ 0x10000, 74 }, { 0x1000C, 0 }, { 0x1000D, 74 }, { 0x10027, 0 }, { 0x10028, 74 }, { 0x1003B, 0 }, { 0x1003C, 74 }, { 0x1003E, 0 },
+			{ 0x1003F, 74 }, { 0x1004E, 0 }, { 0x10050, 74 }, { 0x1005E, 0 }, { 0x10080, 74 }, { 0x100FB, 0 }, { 0x10100, 1 }, { 0x10103, 0 },
+			{ 0x10107, 1 }, { 0x10134, 0 }, { 0x10137, 1 }, { 0x10140, 45 }, { 0x1018F, 0 }, { 0x10190, 1 }, { 0x1019D, 0 }, { 0x101A0, 45 },
+			{ 0x101A1, 0 }, { 0x101D0, 1 }, { 0x101FD, 2 }, { 0x101FE, 0 }, { 0x10280, 76 }, { 0x1029D, 0 }, { 0x102A0, 21 }, { 0x102D1, 0 },
+			{ 0x102E0, 2 }, { 0x102E1, 1 }, { 0x102FC, 0 }, { 0x10300, 106 }, { 0x10324, 0 }, { 0x1032D, 106 }, { 0x10330, 43 }, { 0x1034B, 0 },
+			{ 0x10350, 108 }, { 0x1037B, 0 }, { 0x10380, 154 }, { 0x1039E, 0 }, { 0x1039F, 154 }, { 0x103A0, 109 }, { 0x103C4, 0 }, { 0x103C8, 109 },
+			{ 0x103D6, 0 }, { 0x10400, 32 }, { 0x10450, 128 }, { 0x10480, 116 }, { 0x1049E, 0 }, { 0x104A0, 116 }, { 0x104AA, 0 }, { 0x104B0, 115 },
+			{ 0x104D4, 0 }, { 0x104D8, 115 }, { 0x104FC, 0 }, { 0x10500, 38 }, { 0x10528, 0 }, { 0x10530, 22 }, { 0x10564, 0 }, { 0x1056F, 22 },
+			{ 0x10570, 156 }, { 0x1057B, 0 }, { 0x1057C, 156 }, { 0x1058B, 0 }, { 0x1058C, 156 }, { 0x10593, 0 }, { 0x10594, 156 }, { 0x10596, 0 },
+			{ 0x10597, 156 }, { 0x105A2, 0 }, { 0x105A3, 156 }, { 0x105B2, 0 }, { 0x105B3, 156 }, { 0x105BA, 0 }, { 0x105BB, 156 }, { 0x105BD, 0 },
+			{ 0x10600, 73 }, { 0x10737, 0 }, { 0x10740, 73 }, { 0x10756, 0 }, { 0x10760, 73 }, { 0x10768, 0 }, { 0x10780, 70 }, { 0x10786, 0 },
+			{ 0x10787, 70 }, { 0x107B1, 0 }, { 0x107B2, 70 }, { 0x107BB, 0 }, { 0x10800, 29 }, { 0x10806, 0 }, { 0x10808, 29 }, { 0x10809, 0 },
+			{ 0x1080A, 29 }, { 0x10836, 0 }, { 0x10837, 29 }, { 0x10839, 0 }, { 0x1083C, 29 }, { 0x1083D, 0 }, { 0x1083F, 29 }, { 0x10840, 56 },
+			{ 0x10856, 0 }, { 0x10857, 56 }, { 0x10860, 118 }, { 0x10880, 96 }, { 0x1089F, 0 }, { 0x108A7, 96 }, { 0x108B0, 0 }, { 0x108E0, 53 },
+			{ 0x108F3, 0 }, { 0x108F4, 53 }, { 0x108F6, 0 }, { 0x108FB, 53 }, { 0x10900, 121 }, { 0x1091C, 0 }, { 0x1091F, 121 }, { 0x10920, 77 },
+			{ 0x1093A, 0 }, { 0x1093F, 77 }, { 0x10940, 0 }, { 0x10980, 89 }, { 0x109A0, 88 }, { 0x109B8, 0 }, { 0x109BC, 88 }, { 0x109D0, 0 },
+			{ 0x109D2, 88 }, { 0x10A00, 64 }, { 0x10A04, 0 }, { 0x10A05, 64 }, { 0x10A07, 0 }, { 0x10A0C, 64 }, { 0x10A14, 0 }, { 0x10A15, 64 },
+			{ 0x10A18, 0 }, { 0x10A19, 64 }, { 0x10A36, 0 }, { 0x10A38, 64 }, { 0x10A3B, 0 }, { 0x10A3F, 64 }, { 0x10A49, 0 }, { 0x10A50, 64 },
+			{ 0x10A59, 0 }, { 0x10A60, 111 }, { 0x10A80, 107 }, { 0x10AA0, 0 }, { 0x10AC0, 82 }, { 0x10AE7, 0 }, { 0x10AEB, 82 }, { 0x10AF7, 0 },
+			{ 0x10B00, 8 }, { 0x10B36, 0 }, { 0x10B39, 8 }, { 0x10B40, 58 }, { 0x10B56, 0 }, { 0x10B58, 58 }, { 0x10B60, 57 }, { 0x10B73, 0 },
+			{ 0x10B78, 57 }, { 0x10B80, 122 }, { 0x10B92, 0 }, { 0x10B99, 122 }, { 0x10B9D, 0 }, { 0x10BA9, 122 }, { 0x10BB0, 0 }, { 0x10C00, 112 },
+			{ 0x10C49, 0 }, { 0x10C80, 105 }, { 0x10CB3, 0 }, { 0x10CC0, 105 }, { 0x10CF3, 0 }, { 0x10CFA, 105 }, { 0x10D00, 51 }, { 0x10D28, 0 },
+			{ 0x10D30, 51 }, { 0x10D3A, 0 }, { 0x10E60, 6 }, { 0x10E7F, 0 }, { 0x10E80, 159 }, { 0x10EAA, 0 }, { 0x10EAB, 159 }, { 0x10EAE, 0 },
+			{ 0x10EB0, 159 }, { 0x10EB2, 0 }, { 0x10F00, 110 }, { 0x10F28, 0 }, { 0x10F30, 132 }, { 0x10F5A, 0 }, { 0x10F70, 113 }, { 0x10F8A, 0 },
+			{ 0x10FB0, 26 }, { 0x10FCC, 0 }, { 0x10FE0, 39 }, { 0x10FF7, 0 }, { 0x11000, 16 }, { 0x1104E, 0 }, { 0x11052, 16 }, { 0x11076, 0 },
+			{ 0x1107F, 16 }, { 0x11080, 60 }, { 0x110C3, 0 }, { 0x110CD, 60 }, { 0x110CE, 0 }, { 0x110D0, 133 }, { 0x110E9, 0 }, { 0x110F0, 133 },
+			{ 0x110FA, 0 }, { 0x11100, 23 }, { 0x11135, 0 }, { 0x11136, 23 }, { 0x11148, 0 }, { 0x11150, 78 }, { 0x11177, 0 }, { 0x11180, 127 },
+			{ 0x111E0, 0 }, { 0x111E1, 131 }, { 0x111F5, 0 }, { 0x11200, 67 }, { 0x11212, 0 }, { 0x11213, 67 }, { 0x1123F, 0 }, { 0x11280, 94 },
+			{ 0x11287, 0 }, { 0x11288, 94 }, { 0x11289, 0 }, { 0x1128A, 94 }, { 0x1128E, 0 }, { 0x1128F, 94 }, { 0x1129E, 0 }, { 0x1129F, 94 },
+			{ 0x112AA, 0 }, { 0x112B0, 68 }, { 0x112EB, 0 }, { 0x112F0, 68 }, { 0x112FA, 0 }, { 0x11300, 44 }, { 0x11304, 0 }, { 0x11305, 44 },
+			{ 0x1130D, 0 }, { 0x1130F, 44 }, { 0x11311, 0 }, { 0x11313, 44 }, { 0x11329, 0 }, { 0x1132A, 44 }, { 0x11331, 0 }, { 0x11332, 44 },
+			{ 0x11334, 0 }, { 0x11335, 44 }, { 0x1133A, 0 }, { 0x1133B, 2 }, { 0x1133C, 44 }, { 0x11345, 0 }, { 0x11347, 44 }, { 0x11349, 0 },
+			{ 0x1134B, 44 }, { 0x1134E, 0 }, { 0x11350, 44 }, { 0x11351, 0 }, { 0x11357, 44 }, { 0x11358, 0 }, { 0x1135D, 44 }, { 0x11364, 0 },
+			{ 0x11366, 44 }, { 0x1136D, 0 }, { 0x11370, 44 }, { 0x11375, 0 }, { 0x11400, 99 }, { 0x1145C, 0 }, { 0x1145D, 99 }, { 0x11462, 0 },
+			{ 0x11480, 152 }, { 0x114C8, 0 }, { 0x114D0, 152 }, { 0x114DA, 0 }, { 0x11580, 129 }, { 0x115B6, 0 }, { 0x115B8, 129 }, { 0x115DE, 0 },
+			{ 0x11600, 91 }, { 0x11645, 0 }, { 0x11650, 91 }, { 0x1165A, 0 }, { 0x11660, 92 }, { 0x1166D, 0 }, { 0x11680, 143 }, { 0x116BA, 0 },
+			{ 0x116C0, 143 }, { 0x116CA, 0 }, { 0x11700, 4 }, { 0x1171B, 0 }, { 0x1171D, 4 }, { 0x1172C, 0 }, { 0x11730, 4 }, { 0x11747, 0 },
+			{ 0x11800, 35 }, { 0x1183C, 0 }, { 0x118A0, 158 }, { 0x118F3, 0 }, { 0x118FF, 158 }, { 0x11900, 34 }, { 0x11907, 0 }, { 0x11909, 34 },
+			{ 0x1190A, 0 }, { 0x1190C, 34 }, { 0x11914, 0 }, { 0x11915, 34 }, { 0x11917, 0 }, { 0x11918, 34 }, { 0x11936, 0 }, { 0x11937, 34 },
+			{ 0x11939, 0 }, { 0x1193B, 34 }, { 0x11947, 0 }, { 0x11950, 34 }, { 0x1195A, 0 }, { 0x119A0, 97 }, { 0x119A8, 0 }, { 0x119AA, 97 },
+			{ 0x119D8, 0 }, { 0x119DA, 97 }, { 0x119E5, 0 }, { 0x11A00, 161 }, { 0x11A48, 0 }, { 0x11A50, 134 }, { 0x11AA3, 0 }, { 0x11AB0, 20 },
+			{ 0x11AC0, 119 }, { 0x11AF9, 0 }, { 0x11C00, 14 }, { 0x11C09, 0 }, { 0x11C0A, 14 }, { 0x11C37, 0 }, { 0x11C38, 14 }, { 0x11C46, 0 },
+			{ 0x11C50, 14 }, { 0x11C6D, 0 }, { 0x11C70, 83 }, { 0x11C90, 0 }, { 0x11C92, 83 }, { 0x11CA8, 0 }, { 0x11CA9, 83 }, { 0x11CB7, 0 },
+			{ 0x11D00, 84 }, { 0x11D07, 0 }, { 0x11D08, 84 }, { 0x11D0A, 0 }, { 0x11D0B, 84 }, { 0x11D37, 0 }, { 0x11D3A, 84 }, { 0x11D3B, 0 },
+			{ 0x11D3C, 84 }, { 0x11D3E, 0 }, { 0x11D3F, 84 }, { 0x11D48, 0 }, { 0x11D50, 84 }, { 0x11D5A, 0 }, { 0x11D60, 47 }, { 0x11D66, 0 },
+			{ 0x11D67, 47 }, { 0x11D69, 0 }, { 0x11D6A, 47 }, { 0x11D8F, 0 }, { 0x11D90, 47 }, { 0x11D92, 0 }, { 0x11D93, 47 }, { 0x11D99, 0 },
+			{ 0x11DA0, 47 }, { 0x11DAA, 0 }, { 0x11EE0, 79 }, { 0x11EF9, 0 }, { 0x11FB0, 75 }, { 0x11FB1, 0 }, { 0x11FC0, 144 }, { 0x11FF2, 0 },
+			{ 0x11FFF, 144 }, { 0x12000, 28 }, { 0x1239A, 0 }, { 0x12400, 28 }, { 0x1246F, 0 }, { 0x12470, 28 }, { 0x12475, 0 }, { 0x12480, 28 },
+			{ 0x12544, 0 }, { 0x12F90, 30 }, { 0x12FF3, 0 }, { 0x13000, 37 }, { 0x1342F, 0 }, { 0x13430, 37 }, { 0x13439, 0 }, { 0x14400, 5 },
+			{ 0x14647, 0 }, { 0x16800, 10 }, { 0x16A39, 0 }, { 0x16A40, 93 }, { 0x16A5F, 0 }, { 0x16A60, 93 }, { 0x16A6A, 0 }, { 0x16A6E, 93 },
+			{ 0x16A70, 145 }, { 0x16ABF, 0 }, { 0x16AC0, 145 }, { 0x16ACA, 0 }, { 0x16AD0, 11 }, { 0x16AEE, 0 }, { 0x16AF0, 11 }, { 0x16AF6, 0 },
+			{ 0x16B00, 117 }, { 0x16B46, 0 }, { 0x16B50, 117 }, { 0x16B5A, 0 }, { 0x16B5B, 117 }, { 0x16B62, 0 }, { 0x16B63, 117 }, { 0x16B78, 0 },
+			{ 0x16B7D, 117 }, { 0x16B90, 0 }, { 0x16E40, 85 }, { 0x16E9B, 0 }, { 0x16F00, 90 }, { 0x16F4B, 0 }, { 0x16F4F, 90 }, { 0x16F88, 0 },
+			{ 0x16F8F, 90 }, { 0x16FA0, 0 }, { 0x16FE0, 146 }, { 0x16FE1, 101 }, { 0x16FE2, 49 }, { 0x16FE4, 65 }, { 0x16FE5, 0 }, { 0x16FF0, 49 },
+			{ 0x16FF2, 0 }, { 0x17000, 146 }, { 0x187F8, 0 }, { 0x18800, 146 }, { 0x18B00, 65 }, { 0x18CD6, 0 }, { 0x18D00, 146 }, { 0x18D09, 0 },
+			{ 0x1AFF0, 62 }, { 0x1AFF4, 0 }, { 0x1AFF5, 62 }, { 0x1AFFC, 0 }, { 0x1AFFD, 62 }, { 0x1AFFF, 0 }, { 0x1B000, 62 }, { 0x1B001, 55 },
+			{ 0x1B120, 62 }, { 0x1B123, 0 }, { 0x1B150, 55 }, { 0x1B153, 0 }, { 0x1B164, 62 }, { 0x1B168, 0 }, { 0x1B170, 101 }, { 0x1B2FC, 0 },
+			{ 0x1BC00, 36 }, { 0x1BC6B, 0 }, { 0x1BC70, 36 }, { 0x1BC7D, 0 }, { 0x1BC80, 36 }, { 0x1BC89, 0 }, { 0x1BC90, 36 }, { 0x1BC9A, 0 },
+			{ 0x1BC9C, 36 }, { 0x1BCA0, 1 }, { 0x1BCA4, 0 }, { 0x1CF00, 2 }, { 0x1CF2E, 0 }, { 0x1CF30, 2 }, { 0x1CF47, 0 }, { 0x1CF50, 1 },
+			{ 0x1CFC4, 0 }, { 0x1D000, 1 }, { 0x1D0F6, 0 }, { 0x1D100, 1 }, { 0x1D127, 0 }, { 0x1D129, 1 }, { 0x1D167, 2 }, { 0x1D16A, 1 },
+			{ 0x1D17B, 2 }, { 0x1D183, 1 }, { 0x1D185, 2 }, { 0x1D18C, 1 }, { 0x1D1AA, 2 }, { 0x1D1AE, 1 }, { 0x1D1EB, 0 }, { 0x1D200, 45 },
+			{ 0x1D246, 0 }, { 0x1D2E0, 1 }, { 0x1D2F4, 0 }, { 0x1D300, 1 }, { 0x1D357, 0 }, { 0x1D360, 1 }, { 0x1D379, 0 }, { 0x1D400, 1 },
+			{ 0x1D455, 0 }, { 0x1D456, 1 }, { 0x1D49D, 0 }, { 0x1D49E, 1 }, { 0x1D4A0, 0 }, { 0x1D4A2, 1 }, { 0x1D4A3, 0 }, { 0x1D4A5, 1 },
+			{ 0x1D4A7, 0 }, { 0x1D4A9, 1 }, { 0x1D4AD, 0 }, { 0x1D4AE, 1 }, { 0x1D4BA, 0 }, { 0x1D4BB, 1 }, { 0x1D4BC, 0 }, { 0x1D4BD, 1 },
+			{ 0x1D4C4, 0 }, { 0x1D4C5, 1 }, { 0x1D506, 0 }, { 0x1D507, 1 }, { 0x1D50B, 0 }, { 0x1D50D, 1 }, { 0x1D515, 0 }, { 0x1D516, 1 },
+			{ 0x1D51D, 0 }, { 0x1D51E, 1 }, { 0x1D53A, 0 }, { 0x1D53B, 1 }, { 0x1D53F, 0 }, { 0x1D540, 1 }, { 0x1D545, 0 }, { 0x1D546, 1 },
+			{ 0x1D547, 0 }, { 0x1D54A, 1 }, { 0x1D551, 0 }, { 0x1D552, 1 }, { 0x1D6A6, 0 }, { 0x1D6A8, 1 }, { 0x1D7CC, 0 }, { 0x1D7CE, 1 },
+			{ 0x1D800, 130 }, { 0x1DA8C, 0 }, { 0x1DA9B, 130 }, { 0x1DAA0, 0 }, { 0x1DAA1, 130 }, { 0x1DAB0, 0 }, { 0x1DF00, 70 }, { 0x1DF1F, 0 },
+			{ 0x1E000, 42 }, { 0x1E007, 0 }, { 0x1E008, 42 }, { 0x1E019, 0 }, { 0x1E01B, 42 }, { 0x1E022, 0 }, { 0x1E023, 42 }, { 0x1E025, 0 },
+			{ 0x1E026, 42 }, { 0x1E02B, 0 }, { 0x1E100, 102 }, { 0x1E12D, 0 }, { 0x1E130, 102 }, { 0x1E13E, 0 }, { 0x1E140, 102 }, { 0x1E14A, 0 },
+			{ 0x1E14E, 102 }, { 0x1E150, 0 }, { 0x1E290, 153 }, { 0x1E2AF, 0 }, { 0x1E2C0, 157 }, { 0x1E2FA, 0 }, { 0x1E2FF, 157 }, { 0x1E300, 0 },
+			{ 0x1E7E0, 40 }, { 0x1E7E7, 0 }, { 0x1E7E8, 40 }, { 0x1E7EC, 0 }, { 0x1E7ED, 40 }, { 0x1E7EF, 0 }, { 0x1E7F0, 40 }, { 0x1E7FF, 0 },
+			{ 0x1E800, 87 }, { 0x1E8C5, 0 }, { 0x1E8C7, 87 }, { 0x1E8D7, 0 }, { 0x1E900, 3 }, { 0x1E94C, 0 }, { 0x1E950, 3 }, { 0x1E95A, 0 },
+			{ 0x1E95E, 3 }, { 0x1E960, 0 }, { 0x1EC71, 1 }, { 0x1ECB5, 0 }, { 0x1ED01, 1 }, { 0x1ED3E, 0 }, { 0x1EE00, 6 }, { 0x1EE04, 0 },
+			{ 0x1EE05, 6 }, { 0x1EE20, 0 }, { 0x1EE21, 6 }, { 0x1EE23, 0 }, { 0x1EE24, 6 }, { 0x1EE25, 0 }, { 0x1EE27, 6 }, { 0x1EE28, 0 },
+			{ 0x1EE29, 6 }, { 0x1EE33, 0 }, { 0x1EE34, 6 }, { 0x1EE38, 0 }, { 0x1EE39, 6 }, { 0x1EE3A, 0 }, { 0x1EE3B, 6 }, { 0x1EE3C, 0 },
+			{ 0x1EE42, 6 }, { 0x1EE43, 0 }, { 0x1EE47, 6 }, { 0x1EE48, 0 }, { 0x1EE49, 6 }, { 0x1EE4A, 0 }, { 0x1EE4B, 6 }, { 0x1EE4C, 0 },
+			{ 0x1EE4D, 6 }, { 0x1EE50, 0 }, { 0x1EE51, 6 }, { 0x1EE53, 0 }, { 0x1EE54, 6 }, { 0x1EE55, 0 }, { 0x1EE57, 6 }, { 0x1EE58, 0 },
+			{ 0x1EE59, 6 }, { 0x1EE5A, 0 }, { 0x1EE5B, 6 }, { 0x1EE5C, 0 }, { 0x1EE5D, 6 }, { 0x1EE5E, 0 }, { 0x1EE5F, 6 }, { 0x1EE60, 0 },
+			{ 0x1EE61, 6 }, { 0x1EE63, 0 }, { 0x1EE64, 6 }, { 0x1EE65, 0 }, { 0x1EE67, 6 }, { 0x1EE6B, 0 }, { 0x1EE6C, 6 }, { 0x1EE73, 0 },
+			{ 0x1EE74, 6 }, { 0x1EE78, 0 }, { 0x1EE79, 6 }, { 0x1EE7D, 0 }, { 0x1EE7E, 6 }, { 0x1EE7F, 0 }, { 0x1EE80, 6 }, { 0x1EE8A, 0 },
+			{ 0x1EE8B, 6 }, { 0x1EE9C, 0 }, { 0x1EEA1, 6 }, { 0x1EEA4, 0 }, { 0x1EEA5, 6 }, { 0x1EEAA, 0 }, { 0x1EEAB, 6 }, { 0x1EEBC, 0 },
+			{ 0x1EEF0, 6 }, { 0x1EEF2, 0 }, { 0x1F000, 1 }, { 0x1F02C, 0 }, { 0x1F030, 1 }, { 0x1F094, 0 }, { 0x1F0A0, 1 }, { 0x1F0AF, 0 },
+			{ 0x1F0B1, 1 }, { 0x1F0C0, 0 }, { 0x1F0C1, 1 }, { 0x1F0D0, 0 }, { 0x1F0D1, 1 }, { 0x1F0F6, 0 }, { 0x1F100, 1 }, { 0x1F1AE, 0 },
+			{ 0x1F1E6, 1 }, { 0x1F200, 55 }, { 0x1F201, 1 }, { 0x1F203, 0 }, { 0x1F210, 1 }, { 0x1F23C, 0 }, { 0x1F240, 1 }, { 0x1F249, 0 },
+			{ 0x1F250, 1 }, { 0x1F252, 0 }, { 0x1F260, 1 }, { 0x1F266, 0 }, { 0x1F300, 1 }, { 0x1F6D8, 0 }, { 0x1F6DD, 1 }, { 0x1F6ED, 0 },
+			{ 0x1F6F0, 1 }, { 0x1F6FD, 0 }, { 0x1F700, 1 }, { 0x1F774, 0 }, { 0x1F780, 1 }, { 0x1F7D9, 0 }, { 0x1F7E0, 1 }, { 0x1F7EC, 0 },
+			{ 0x1F7F0, 1 }, { 0x1F7F1, 0 }, { 0x1F800, 1 }, { 0x1F80C, 0 }, { 0x1F810, 1 }, { 0x1F848, 0 }, { 0x1F850, 1 }, { 0x1F85A, 0 },
+			{ 0x1F860, 1 }, { 0x1F888, 0 }, { 0x1F890, 1 }, { 0x1F8AE, 0 }, { 0x1F8B0, 1 }, { 0x1F8B2, 0 }, { 0x1F900, 1 }, { 0x1FA54, 0 },
+			{ 0x1FA60, 1 }, { 0x1FA6E, 0 }, { 0x1FA70, 1 }, { 0x1FA75, 0 }, { 0x1FA78, 1 }, { 0x1FA7D, 0 }, { 0x1FA80, 1 }, { 0x1FA87, 0 },
+			{ 0x1FA90, 1 }, { 0x1FAAD, 0 }, { 0x1FAB0, 1 }, { 0x1FABB, 0 }, { 0x1FAC0, 1 }, { 0x1FAC6, 0 }, { 0x1FAD0, 1 }, { 0x1FADA, 0 },
+			{ 0x1FAE0, 1 }, { 0x1FAE8, 0 }, { 0x1FAF0, 1 }, { 0x1FAF7, 0 }, { 0x1FB00, 1 }, { 0x1FB93, 0 }, { 0x1FB94, 1 }, { 0x1FBCB, 0 },
+			{ 0x1FBF0, 1 }, { 0x1FBFA, 0 }, { 0x20000, 49 }, { 0x2A6E0, 0 }, { 0x2A700, 49 }, { 0x2B739, 0 }, { 0x2B740, 49 }, { 0x2B81E, 0 },
+			{ 0x2B820, 49 }, { 0x2CEA2, 0 }, { 0x2CEB0, 49 }, { 0x2EBE1, 0 }, { 0x2F800, 49 }, { 0x2FA1E, 0 }, { 0x30000, 49 }, { 0x3134B, 0 },
+			{ 0xE0001, 1 }, { 0xE0002, 0 }, { 0xE0020, 1 }, { 0xE0080, 0 }, { 0xE0100, 2 }, { 0xE01F0, 0 }
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,452 @@
+#ifndef MoeLP_Base_Utf8Text
+#define MoeLP_Base_Utf8Text
+
+#include "../Base.hpp"
+#include "../Memory.hpp"
+#include "CodeConvert.hpp"
+#include "NumberConvert.hpp"
+#include "Text.hpp"
+#include "Utf8View.hpp"
+
+#include <cstring>
+
+namespace MoeLP
+{
+	namespace Utf8Text_Internal
+	{
+		/**
+		 * @brief the header of a shared buffer, followed by length bytes and a zero terminator
+		 */
+		struct Storage
+		{
+			volatile mint	references;
+			size_t			length;
+		};
+
+	}
+
+	/**
+	 * @brief an immutable utf-8 text
+	 * @example:
+	 * Utf8Text line = "2024\t中文";
+	 * for (Utf8View field : line.split('\t')) {...}
+	 * Text t = line.toText();
+	 * @detail the bytes are stored once and shared by the copies with a reference counter,
+	 * and they are always zero terminated. Positions and lengths count bytes. A text holds
+	 * half the memory of a Text for most corpora and needs no conversion to be written
+	 * into an utf-8 file. The conversions from and to Text are explicit.
+	 */
+	class Utf8Text
+	{
+	public:
+		/**
+		 * @brief create an empty text
+		 */
+		Utf8Text()
+			: storage(0)
+		{
+		}
+
+		/**
+		 * @brief copy a zero terminated utf-8 string
+		 */
+		Utf8Text(const char* str)
+			: storage(0)
+		{
+			assign(str, strlen(str));
+		}
+
+		/**
+		 * @brief copy utf-8 bytes
+		 * @param str: the bytes
+		 * @param length: the number of bytes
+		 */
+		Utf8Text(const char* str, size_t length)
+			: storage(0)
+		{
+			assign(str, length);
+		}
+
+		explicit Utf8Text(const Utf8View& view)
+			: storage(0)
+		{
+			assign(view.data(), view.length());
+		}
+
+		/**
+		 * @brief convert a text into utf-8, an unpaired surrogate becomes U+FFFD
+		 */
+		explicit Utf8Text(const Text& text)
+			: storage(0)
+		{
+			const muint16* p = text.data();
+			size_t length = utf8LengthOfUtf16(p, text.length());
+			if (length == 0)
+				return;
+			storage = allocate(length);
+			utf16ToUtf8(p, text.length(), buffer());
+		}
+
+		Utf8Text(const Utf8Text& text)
+			: storage(text.storage)
+		{
+			if (storage)
+				ATOMIC_INCREMENT(&storage->references);
+		}
+
+		Utf8Text(Utf8Text&& text)
+			: storage(text.storage)
+		{
+			text.storage = 0;
+		}
+
+		~Utf8Text()
+		{
+			release();
+		}
+
+		Utf8Text& operator=(const Utf8Text& text)
+		{
+			if (storage != text.storage)
+			{
+				if (text.storage)
+					ATOMIC_INCREMENT(&text.storage->references);
+				release();
+				storage = text.storage;
+			}
+			return *this;
+		}
+
+		Utf8Text& operator=(Utf8Text&& text)
+		{
+			if (this != &text)
+			{
+				release();
+				storage = text.storage;
+				text.storage = 0;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief compare two texts by bytes, which is the order of code points
+		 */
+		static mint compare(const Utf8Text& text1, const Utf8Text& text2)
+		{
+			return Utf8View::compare(text1.view(), text2.view());
+		}
+
+		/**
+		 * @brief convert the text into utf-16, an ill-formed sequence becomes U+FFFD
+		 */
+		Text toText() const
+		{
+			return Text::fromUTF8(data(), length());
+		}
+
+		/**
+		 * @brief return the zero terminated bytes
+		 */
+		const char* data() const
+		{
+			return storage ? (const char*)(storage + 1) : "";
+		}
+
+		const char* c_str() const
+		{
+			return data();
+		}
+
+		/**
+		 * @brief return the number of bytes
+		 */
+		size_t length() const
+		{
+			return storage ? storage->length : 0;
+		}
+
+		bool empty() const
+		{
+			return length() == 0;
+		}
+
+		/**
+		 * @brief return a view of the bytes without copying
+		 * @detail the view is valid while the text or one of its copies lives.
+		 */
+		Utf8View view() const
+		{
+			return Utf8View(data(), length());
+		}
+
+		Utf8View::CodePointRange codePoints() const
+		{
+			return view().codePoints();
+		}
+
+		size_t codePointCount() const
+		{
+			return view().codePointCount();
+		}
+
+		TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> split(char delimiter) const
+		{
+			return view().split(delimiter);
+		}
+
+		TextSplitRange<Utf8View_Internal::TextDelimiter, Utf8View> split(const Utf8View& delimiter) const
+		{
+			return view().split(delimiter);
+		}
+
+		template<typename Predicate>
+		TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>, Utf8View> splitIf(Predicate predicate) const
+		{
+			return view().splitIf(predicate);
+		}
+
+		TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> lines() const
+		{
+			return view().lines();
+		}
+
+		TextSplitRange<Utf8View_Internal::SpaceDelimiter, Utf8View> tokens() const
+		{
+			return view().tokens();
+		}
+
+		mint find(char c, size_t from = 0) const
+		{
+			return view().find(c, from);
+		}
+
+		mint find(const Utf8View& text, size_t from = 0) const
+		{
+			return view().find(text, from);
+		}
+
+		mint findLast(char c) const
+		{
+			return view().findLast(c);
+		}
+
+		bool startsWith(const Utf8View& text) const
+		{
+			return view().startsWith(text);
+		}
+
+		bool endsWith(const Utf8View& text) const
+		{
+			return view().endsWith(text);
+		}
+
+		/**
+		 * @brief return a part of the text
+		 * @param index: the begin of the part in bytes
+		 * @param count: the count of bytes from index
+		 */
+		Utf8Text subText(size_t index, size_t count) const
+		{
+			MOE_ERROR(index <= length(), "Utf8Text::subText(size_t index, size_t count): Argument index out of range.");
+			MOE_ERROR(count <= length() - index, "Utf8Text::subText(size_t index, size_t count): Argument count out of range.");
+			if (index == 0 && count == length())
+				return *this;
+			return Utf8Text(data() + index, count);
+		}
+
+		Utf8Text left(size_t count) const
+		{
+			return subText(0, count);
+		}
+
+		Utf8Text right(size_t count) const
+		{
+			MOE_ERROR(count <= length(), "Utf8Text::right(size_t count): Argument count out of range.");
+			return subText(length() - count, count);
+		}
+
+		double toDouble() const
+		{
+			return parseDouble(data(), data() + length());
+		}
+
+		long double toLongDouble() const
+		{
+			return parseLongDouble(data(), data() + length());
+		}
+
+		mint32 toInt32(mint radix = 10) const
+		{
+			return parseInteger<mint32>(data(), data() + length(), radix);
+		}
+
+		mint64 toInt64(mint radix = 10) const
+		{
+			return parseInteger<mint64>(data(), data() + length(), radix);
+		}
+
+		muint32 toUInt32(mint radix = 10) const
+		{
+			return parseInteger<muint32>(data(), data() + length(), radix);
+		}
+
+		muint64 toUInt64(mint radix = 10) const
+		{
+			return parseInteger<muint64>(data(), data() + length(), radix);
+		}
+
+		static Utf8Text number(mint32 n, mint radix = 10)
+		{
+			char buf[maxIntegerLength];
+			return Utf8Text(buf, formatInteger(n, buf, radix));
+		}
+
+		static Utf8Text number(mint64 n, mint radix = 10)
+		{
+			char buf[maxIntegerLength];
+			return Utf8Text(buf, formatInteger(n, buf, radix));
+		}
+
+		static Utf8Text number(muint32 n, mint radix = 10)
+		{
+			char buf[maxIntegerLength];
+			return Utf8Text(buf, formatInteger(n, buf, radix));
+		}
+
+		static Utf8Text number(muint64 n, mint radix = 10)
+		{
+			char buf[maxIntegerLength];
+			return Utf8Text(buf, formatInteger(n, buf, radix));
+		}
+
+		/**
+		 * @brief convert a double number into the shortest text that reads back to the same number
+		 * @param precision: the number of significant digits, 0 means the shortest exact form
+		 */
+		static Utf8Text number(double n, mint precision = 0)
+		{
+			char buf[maxFloatLength];
+			return Utf8Text(buf, formatDouble(n, buf, precision));
+		}
+
+		static Utf8Text number(long double n, mint precision = 0)
+		{
+			char buf[maxFloatLength];
+			return Utf8Text(buf, formatLongDouble(n, buf, precision));
+		}
+
+		Utf8Text operator+(const Utf8View& text) const
+		{
+			Utf8Text result;
+			size_t total = length() + text.length();
+			if (total == 0)
+				return result;
+			result.storage = allocate(total);
+			memcpy(result.buffer(), data(), length());
+			memcpy(result.buffer() + length(), text.data(), text.length());
+			return result;
+		}
+
+		Utf8Text operator+(const Utf8Text& text) const
+		{
+			return *this + text.view();
+		}
+
+		Utf8Text& operator+=(const Utf8View& text)
+		{
+			*this = *this + text;
+			return *this;
+		}
+
+		Utf8Text& operator+=(const Utf8Text& text)
+		{
+			*this = *this + text.view();
+			return *this;
+		}
+
+		bool operator==(const Utf8Text& text) const
+		{
+			return view() == text.view();
+		}
+
+		bool operator!=(const Utf8Text& text) const
+		{
+			return view() != text.view();
+		}
+
+		bool operator<(const Utf8Text& text) const
+		{
+			return view() < text.view();
+		}
+
+		bool operator<=(const Utf8Text& text) const
+		{
+			return view() <= text.view();
+		}
+
+		bool operator>(const Utf8Text& text) const
+		{
+			return view() > text.view();
+		}
+
+		bool operator>=(const Utf8Text& text) const
+		{
+			return view() >= text.view();
+		}
+
+		bool operator==(const char* str) const
+		{
+			return view() == Utf8View(str);
+		}
+
+		bool operator!=(const char* str) const
+		{
+			return view() != Utf8View(str);
+		}
+
+		char operator[](size_t index) const
+		{
+			MOE_ERROR(index < length(), "Utf8Text::operator[](size_t index): Argument index out of range.");
+			return data()[index];
+		}
+
+		mint referenceCount() const
+		{
+			return storage ? storage->references : 0;
+		}
+
+	private:
+		Utf8Text_Internal::Storage* storage;
+
+		char* buffer()
+		{
+			return (char*)(storage + 1);
+		}
+
+		static Utf8Text_Internal::Storage* allocate(size_t length)
+		{
+			Utf8Text_Internal::Storage* s = (Utf8Text_Internal::Storage*)cpuAllocate(sizeof(Utf8Text_Internal::Storage) + length + 1);
+			s->references = 1;
+			s->length = length;
+			((char*)(s + 1))[length] = 0;
+			return s;
+		}
+
+		void assign(const char* str, size_t length)
+		{
+			if (length == 0)
+				return;
+			storage = allocate(length);
+			memcpy(buffer(), str, length);
+		}
+
+		void release()
+		{
+			if (storage && ATOMIC_DECREMENT(&storage->references) == 0)
+				cpuDeallocate(storage, sizeof(Utf8Text_Internal::Storage) + storage->length + 1);
+			storage = 0;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,455 @@
+#ifndef MoeLP_Base_Utf8View
+#define MoeLP_Base_Utf8View
+
+#include "../Base.hpp"
+#include "CodeConvert.hpp"
+#include "TextView.hpp"
+
+#include <iterator>
+#include <utility>
+#include <cstring>
+
+namespace MoeLP
+{
+	class Utf8View;
+
+	namespace Utf8View_Internal
+	{
+		struct ByteDelimiter;
+		struct TextDelimiter;
+		struct SpaceDelimiter;
+	}
+
+	/**
+	 * @brief a read only view of utf-8 bytes owned by someone else
+	 * @detail the view works like TextView but on bytes, positions and lengths count bytes.
+	 * The bytes are not zero terminated. Comparing bytes gives the order of code points.
+	 */
+	class Utf8View
+	{
+	public:
+		/**
+		 * @brief a forward iterator decoding the code points of a view
+		 * @detail an ill-formed sequence is read as U+FFFD.
+		 */
+		class CodePointIterator
+		{
+		public:
+			typedef std::forward_iterator_tag	iterator_category;
+			typedef muint32						value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef const muint32*				pointer;
+			typedef muint32						reference;
+
+			CodePointIterator()
+				: p(0),
+				end(0),
+				length(0),
+				codePoint(0)
+			{
+			}
+
+			CodePointIterator(const char* p, const char* end)
+				: p((const muint8*)p),
+				end((const muint8*)end),
+				length(0),
+				codePoint(0)
+			{
+				decode();
+			}
+
+			muint32 operator*() const
+			{
+				return codePoint;
+			}
+
+			CodePointIterator& operator++()
+			{
+				p += length;
+				decode();
+				return *this;
+			}
+
+			CodePointIterator operator++(int)
+			{
+				CodePointIterator it = *this;
+				++*this;
+				return it;
+			}
+
+			bool operator==(const CodePointIterator& it) const
+			{
+				return p == it.p;
+			}
+
+			bool operator!=(const CodePointIterator& it) const
+			{
+				return p != it.p;
+			}
+
+		private:
+			const muint8*	p;
+			const muint8*	end;
+			size_t			length;
+			muint32			codePoint;
+
+			void decode()
+			{
+				length = p < end ? CodeConvert_Internal::decodeUtf8(p, end, codePoint) : 0;
+			}
+		};
+
+		class CodePointRange
+		{
+		public:
+			CodePointRange(const char* begin, const char* end)
+				: first(begin),
+				last(end)
+			{
+			}
+
+			CodePointIterator begin() const
+			{
+				return CodePointIterator(first, last);
+			}
+
+			CodePointIterator end() const
+			{
+				return CodePointIterator(last, last);
+			}
+
+		private:
+			const char* first;
+			const char* last;
+		};
+
+		Utf8View()
+			: buffer(0),
+			size(0)
+		{
+		}
+
+		Utf8View(const char* buffer, size_t length)
+			: buffer(buffer),
+			size(length)
+		{
+		}
+
+		/**
+		 * @brief view a zero terminated string
+		 */
+		Utf8View(const char* str)
+			: buffer(str),
+			size(strlen(str))
+		{
+		}
+
+		const char* data() const
+		{
+			return buffer;
+		}
+
+		/**
+		 * @brief return the number of bytes
+		 */
+		size_t length() const
+		{
+			return size;
+		}
+
+		bool empty() const
+		{
+			return size == 0;
+		}
+
+		const char* begin() const
+		{
+			return buffer;
+		}
+
+		const char* end() const
+		{
+			return buffer + size;
+		}
+
+		char operator[](size_t index) const
+		{
+			MOE_ERROR(index < size, "Utf8View::operator[](size_t index): Argument index out of range.");
+			return buffer[index];
+		}
+
+		/**
+		 * @brief iterate over the code points
+		 * @example: for (muint32 c : view.codePoints()) {...}
+		 */
+		CodePointRange codePoints() const
+		{
+			return CodePointRange(buffer, buffer + size);
+		}
+
+		/**
+		 * @brief return the number of code points codePoints() yields
+		 * @detail ill-formed bytes are counted the way the iterator decodes them, each maximal
+		 * ill-formed subpart is one U+FFFD.
+		 */
+		size_t codePointCount() const
+		{
+			size_t count = 0;
+			if (validateUtf8(buffer, size))
+			{
+				// every code point of well-formed utf-8 has exactly one byte that is not a continuation byte
+				for (size_t i = 0; i < size; i++)
+					count += ((muint8)buffer[i] & 0xC0) != 0x80;
+				return count;
+			}
+
+			const muint8* p = (const muint8*)buffer;
+			const muint8* end = p + size;
+			while (p < end)
+			{
+				muint32 codePoint;
+				p += CodeConvert_Internal::decodeUtf8(p, end, codePoint);
+				count++;
+			}
+			return count;
+		}
+
+		/**
+		 * @brief return a part of the view
+		 * @param index: the begin of the sub view in bytes
+		 * @param count: the count of bytes from index
+		 */
+		Utf8View subView(size_t index, size_t count) const
+		{
+			MOE_ERROR(index <= size, "Utf8View::subView(size_t index, size_t count): Argument index out of range.");
+			MOE_ERROR(count <= size - index, "Utf8View::subView(size_t index, size_t count): Argument count out of range.");
+			return Utf8View(buffer + index, count);
+		}
+
+		Utf8View left(size_t count) const
+		{
+			return subView(0, count);
+		}
+
+		Utf8View right(size_t count) const
+		{
+			MOE_ERROR(count <= size, "Utf8View::right(size_t count): Argument count out of range.");
+			return Utf8View(buffer + size - count, count);
+		}
+
+		/**
+		 * @brief return the first position of a byte from a position, or -1
+		 */
+		mint find(char c, size_t from = 0) const
+		{
+			if (from >= size)
+				return -1;
+			const char* p = (const char*)memchr(buffer + from, c, size - from);
+			return p ? p - buffer : -1;
+		}
+
+		/**
+		 * @brief return the first position of a text from a position, or -1
+		 */
+		mint find(const Utf8View& text, size_t from = 0) const
+		{
+			if (text.size == 0)
+				return from <= size ? (mint)from : -1;
+			if (text.size > size)
+				return -1;
+
+			const size_t last = size - text.size;
+			for (size_t i = from; i <= last; )
+			{
+				const char* p = (const char*)memchr(buffer + i, text.buffer[0], last - i + 1);
+				if (!p)
+					return -1;
+				i = p - buffer;
+				if (memcmp(p + 1, text.buffer + 1, text.size - 1) == 0)
+					return i;
+				i++;
+			}
+			return -1;
+		}
+
+		/**
+		 * @brief return the last position of a byte, or -1
+		 */
+		mint findLast(char c) const
+		{
+			for (size_t i = size; i > 0; i--)
+			{
+				if (buffer[i - 1] == c)
+					return i - 1;
+			}
+			return -1;
+		}
+
+		bool startsWith(const Utf8View& text) const
+		{
+			return text.size <= size && memcmp(buffer, text.buffer, text.size) == 0;
+		}
+
+		bool endsWith(const Utf8View& text) const
+		{
+			return text.size <= size && memcmp(buffer + size - text.size, text.buffer, text.size) == 0;
+		}
+
+		/**
+		 * @brief compare two views by bytes, which is the order of code points
+		 */
+		static mint compare(const Utf8View& view1, const Utf8View& view2)
+		{
+			size_t len = view1.size < view2.size ? view1.size : view2.size;
+			int difference = len ? memcmp(view1.buffer, view2.buffer, len) : 0;
+			if (difference != 0)
+				return difference;
+			return (mint)view1.size - (mint)view2.size;
+		}
+
+		/**
+		 * @brief split the view by a byte
+		 * @example: for (Utf8View field : line.split('\t')) {...}
+		 */
+		TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> split(char delimiter) const;
+
+		/**
+		 * @brief split the view by a text, the delimiter must outlive the range
+		 */
+		TextSplitRange<Utf8View_Internal::TextDelimiter, Utf8View> split(const Utf8View& delimiter) const;
+
+		/**
+		 * @brief split the view at every byte for which the predicate returns true
+		 */
+		template<typename Predicate>
+		TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>, Utf8View> splitIf(Predicate predicate) const;
+
+		/**
+		 * @brief the lines of the view, "\r\n" is accepted and a final line break does not add an empty line
+		 */
+		TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> lines() const;
+
+		/**
+		 * @brief the non empty pieces of the view separated by white spaces, the same spaces as TextView::tokens
+		 */
+		TextSplitRange<Utf8View_Internal::SpaceDelimiter, Utf8View> tokens() const;
+
+		bool operator==(const Utf8View& view) const
+		{
+			return size == view.size && memcmp(buffer, view.buffer, size) == 0;
+		}
+
+		bool operator!=(const Utf8View& view) const
+		{
+			return !(*this == view);
+		}
+
+		bool operator<(const Utf8View& view) const
+		{
+			return compare(*this, view) < 0;
+		}
+
+		bool operator<=(const Utf8View& view) const
+		{
+			return compare(*this, view) <= 0;
+		}
+
+		bool operator>(const Utf8View& view) const
+		{
+			return compare(*this, view) > 0;
+		}
+
+		bool operator>=(const Utf8View& view) const
+		{
+			return compare(*this, view) >= 0;
+		}
+
+	private:
+		const char*	buffer;
+		size_t		size;
+	};
+
+	namespace Utf8View_Internal
+	{
+		struct ByteDelimiter
+		{
+			char c;
+
+			std::pair<mint, size_t> next(const Utf8View& view, size_t from) const
+			{
+				return std::make_pair(view.find(c, from), (size_t)1);
+			}
+		};
+
+		struct TextDelimiter
+		{
+			Utf8View text;
+
+			std::pair<mint, size_t> next(const Utf8View& view, size_t from) const
+			{
+				if (text.empty())
+					return std::make_pair((mint)-1, (size_t)0);
+				return std::make_pair(view.find(text, from), text.length());
+			}
+		};
+
+		/**
+		 * @brief find the next white space, which can be several bytes long
+		 */
+		struct SpaceDelimiter
+		{
+			std::pair<mint, size_t> next(const Utf8View& view, size_t from) const
+			{
+				const muint8* p = (const muint8*)view.data();
+				const size_t size = view.length();
+				for (size_t i = from; i < size; i++)
+				{
+					muint8 b = p[i];
+					if (b == 0x20 || (b >= 0x09 && b <= 0x0D))
+						return std::make_pair((mint)i, (size_t)1);
+					if (b == 0xC2 && i + 1 < size && p[i + 1] == 0xA0)
+						return std::make_pair((mint)i, (size_t)2);
+					if (i + 2 < size && ((b == 0xE3 && p[i + 1] == 0x80 && p[i + 2] == 0x80)
+						|| (b == 0xE2 && p[i + 1] == 0x80 && (p[i + 2] <= 0x8A || p[i + 2] == 0xA8 || p[i + 2] == 0xA9 || p[i + 2] == 0xAF))
+						|| (b == 0xE2 && p[i + 1] == 0x81 && p[i + 2] == 0x9F)))
+						return std::make_pair((mint)i, (size_t)3);
+				}
+				return std::make_pair((mint)-1, (size_t)1);
+			}
+		};
+	}
+
+	inline TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> Utf8View::split(char delimiter) const
+	{
+		Utf8View_Internal::ByteDelimiter d = { delimiter };
+		return TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View>(*this, d);
+	}
+
+	inline TextSplitRange<Utf8View_Internal::TextDelimiter, Utf8View> Utf8View::split(const Utf8View& delimiter) const
+	{
+		Utf8View_Internal::TextDelimiter d = { delimiter };
+		return TextSplitRange<Utf8View_Internal::TextDelimiter, Utf8View>(*this, d);
+	}
+
+	template<typename Predicate>
+	inline TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>, Utf8View> Utf8View::splitIf(Predicate predicate) const
+	{
+		TextView_Internal::PredicateDelimiter<Predicate> d = { predicate };
+		return TextSplitRange<TextView_Internal::PredicateDelimiter<Predicate>, Utf8View>(*this, d);
+	}
+
+	inline TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> Utf8View::lines() const
+	{
+		typedef TextSplitRange<Utf8View_Internal::ByteDelimiter, Utf8View> Range;
+		Utf8View_Internal::ByteDelimiter d = { '\n' };
+		return Range(*this, d, Range::TrimCarriageReturn | Range::DropLastEmpty);
+	}
+
+	inline TextSplitRange<Utf8View_Internal::SpaceDelimiter, Utf8View> Utf8View::tokens() const
+	{
+		typedef TextSplitRange<Utf8View_Internal::SpaceDelimiter, Utf8View> Range;
+		return Range(*this, Utf8View_Internal::SpaceDelimiter(), Range::SkipEmpty);
+	}
+}
+
+#endif
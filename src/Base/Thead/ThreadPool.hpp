@@ -105,6 +105,9 @@ namespace MoeLP
 						tasks.get(task);
 					}
 
+					// the queue only gives no task once it is stopped
+					if (!task)
+						return;
 					task();
 				}
 			}
@@ -124,10 +127,14 @@ namespace MoeLP
 			std::future<return_type> res = task->get_future();
 			{
 				std::unique_lock<std::mutex> lock(queue_mutex);
-
 				MOE_ERROR(!stop, "Add a task to a stopped threadpool.");
+			}
 
-				tasks.add([task]() { (*task)(); });
+			// the queue blocks while it is full, so it must not be filled under queue_mutex,
+			// which the workers need to take tasks out of it
+			tasks.add([task]() { (*task)(); });
+			{
+				std::unique_lock<std::mutex> lock(queue_mutex);
 			}
 			condition.notify_one();
 			return res;
@@ -140,9 +147,11 @@ namespace MoeLP
 				stop = true;
 			}
 			condition.notify_all();
-			tasks.stop();
+			// the workers run the queued tasks before they return, the queue is stopped
+			// after them, or they would find it stopped but not empty and never return
 			for (std::thread &worker : workers)
 				worker.join();
+			tasks.stop();
 		}
 
 	private: